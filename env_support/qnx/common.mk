@@ -41,6 +41,7 @@ $(SRC_ROOT)/draw/sw/blend \
 $(SRC_ROOT)/draw/sw/blend/helium \
 $(SRC_ROOT)/draw/sw/blend/arm2d \
 $(SRC_ROOT)/draw/sw/blend/neon \
+$(SRC_ROOT)/draw/sw/blend/sse2 \
 $(SRC_ROOT)/misc \
 $(SRC_ROOT)/misc/cache \
 $(SRC_ROOT)/font \
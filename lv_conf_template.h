@@ -81,6 +81,11 @@
         #undef LV_MEM_POOL_INCLUDE
         #undef LV_MEM_POOL_ALLOC
     #endif
+
+    /** Serve small allocations (<= 256 bytes) from fixed size-class slabs instead of TLSF.
+     *  Reduces fragmentation and the cost of allocating small objects (widgets, events, draw tasks, etc.)
+     *  at the price of some memory kept in partially used slab pages. */
+    #define LV_USE_MEM_SLAB 0
 #endif  /*LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN*/
 
 /*====================
@@ -94,6 +99,17 @@
  * (Not so important, you can adjust it to modify default sizes and spaces.) */
 #define LV_DPI_DEF 130              /**< [px/inch] */
 
+/** Extra cost of redrawing an invalidated area in addition to its pixels (e.g. preparing the layer
+ * and flushing), expressed in pixels. Two invalidated areas are joined if their bounding box
+ * is smaller than the sum of their sizes plus this value.
+ * - 0: join only the areas whose bounding box is smaller than the sum of their sizes */
+#define LV_INV_AREA_OVERHEAD 0      /**< [px] */
+
+/** 1: Keep the timers in a min-heap ordered by their next deadline so that `lv_timer_handler()`
+ *  checks only the timers which are due instead of all the timers.
+ *  Useful with many timers. */
+#define LV_USE_TIMER_HEAP 0
+
 /*=================
  * OPERATING SYSTEM
  *=================*/
@@ -156,6 +172,11 @@
  */
 #define LV_DRAW_THREAD_STACK_SIZE    (8 * 1024)         /**< [bytes]*/
 
+/** Allocate the draw tasks of a frame from a bump arena of this size which is reset
+ *  when all the tasks are finished. If the arena is full `lv_malloc()` is used.
+ *  Set it to 0 to allocate every draw task with `lv_malloc()`. */
+#define LV_DRAW_TASK_ARENA_SIZE 0   /**< [bytes]*/
+
 #define LV_USE_DRAW_SW 1
 #if LV_USE_DRAW_SW == 1
     /*
@@ -183,6 +204,13 @@
      *  - > 1 means multiple threads will render the screen in parallel. */
     #define LV_DRAW_SW_DRAW_UNIT_CNT    1
 
+    /** Split large draw tasks into horizontal bands which can be stolen and rendered
+     *  by the idle draw units in parallel. Fills, borders, shadows, images and layers
+     *  covering at least this many pixels are split.
+     *  - Requires `LV_DRAW_SW_DRAW_UNIT_CNT > 1`.
+     *  - 0: disable splitting */
+    #define LV_DRAW_SW_SPLIT_MIN_AREA   0
+
     /** Use Arm-2D to accelerate software (sw) rendering. */
     #define LV_USE_DRAW_ARM2D_SYNC      0
 
@@ -207,6 +235,12 @@
         #define LV_DRAW_SW_CIRCLE_CACHE_SIZE 4
     #endif
 
+    /** Use optimized blending routines:
+     *  - LV_DRAW_SW_ASM_NONE:   portable C implementation
+     *  - LV_DRAW_SW_ASM_NEON:   ARM NEON
+     *  - LV_DRAW_SW_ASM_HELIUM: ARM Helium
+     *  - LV_DRAW_SW_ASM_SSE2:   x86 SSE2 intrinsics (RGB565 and XRGB8888 destinations)
+     *  - LV_DRAW_SW_ASM_CUSTOM: include `LV_DRAW_SW_ASM_CUSTOM_INCLUDE` */
     #define  LV_USE_DRAW_SW_ASM     LV_DRAW_SW_ASM_NONE
 
     #if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_CUSTOM
@@ -427,6 +461,16 @@
  *  The main logic is like `LV_CACHE_DEF_SIZE` but for image headers. */
 #define LV_IMAGE_HEADER_CACHE_DEF_CNT 0
 
+/** Default size of the cache of the decoded tiles of tiled images (in bytes).
+ *  Only the tiles which are drawn are decoded. If size is 0, the tiles are decoded
+ *  every time they are drawn. */
+#define LV_IMAGE_TILE_CACHE_DEF_SIZE 0
+
+/** 1: Decode images which are not in the image cache in the background (on a thread if `LV_USE_OS` is set)
+ *  instead of while drawing. They are not drawn until they are decoded and their area is redrawn then.
+ *  Also enables `lv_image_prefetch()` to warm the image cache. Requires `LV_CACHE_DEF_SIZE > 0`. */
+#define LV_USE_IMAGE_DECODER_ASYNC 0
+
 /** Number of stops allowed per gradient. Increase this to allow more stops.
  *  This adds (sizeof(lv_color_t) + 1) bytes per additional stop. */
 #define LV_GRADIENT_MAX_STOPS   2
@@ -439,9 +483,33 @@
  *  - 254: round up */
 #define LV_COLOR_MIX_ROUND_OFS  0
 
+/** Keep the properties of non-constant styles sorted and find them with binary search.
+ * Makes getting properties from styles with many properties faster, but adding new properties is a little slower. */
+#define LV_STYLE_SORTED_PROPS   0
+
 /** Add 2 x 32-bit variables to each `lv_obj_t` to speed up getting style properties */
 #define LV_OBJ_STYLE_CACHE      0
 
+/** Number of resolved style properties cached per object and (part, state) pair.
+ * The cache is allocated on the first style property read of the object and
+ * it's invalidated when a style of the object changes.
+ * Requires `LV_OBJ_STYLE_CACHE`. It should be a power of 2, e.g. 32 (16 bytes per entry on 64-bit systems).
+ * - 0: disable the value cache */
+#define LV_OBJ_STYLE_VALUE_CACHE_CNT    0
+
+/** Index the children of widgets having at least this many children in a grid by their position.
+ * Input devices then check only the children under the pointer instead of all of them.
+ * The index of a widget is rebuilt on the next search after a child is added, moved or resized.
+ * - 0: disable the index */
+#define LV_OBJ_HIT_INDEX_MIN_CHILD_CNT  0
+
+/** Size of the cache of retained layers in bytes.
+ * Widgets marked with `lv_obj_set_layer_retained()` keep the content of their transform or
+ * opa_layered layer here, so only the blending is redone while the transform or opacity animates.
+ * A layer is rendered again when its widget or one of the children is invalidated.
+ * - 0: disable the cache */
+#define LV_OBJ_LAYER_CACHE_SIZE         0
+
 /** Add `id` field to `lv_obj_t` */
 #define LV_USE_OBJ_ID           0
 
@@ -600,6 +668,16 @@
 /** Enables/disables support for compressed fonts. */
 #define LV_USE_FONT_COMPRESSED 0
 
+/** Number of decoded glyph bitmaps of the built-in (fmt_txt) fonts to keep in an LRU cache.
+ *  Useful for compressed fonts where decompressing a glyph on every draw is expensive.
+ *  - 0: disables caching */
+#define LV_FONT_FMT_TXT_CACHE_CNT 0
+#if LV_FONT_FMT_TXT_CACHE_CNT
+    /** Number of `(font, letter) -> glyph id` pairs to remember for the fonts with sparse cmaps.
+     *  Must be a power of 2. */
+    #define LV_FONT_FMT_TXT_GID_CACHE_CNT 64
+#endif
+
 /** Enable drawing placeholders when glyph dsc is not found. */
 #define LV_USE_FONT_PLACEHOLDER 1
 
@@ -787,6 +865,12 @@
 /** A layout similar to Grid in CSS. */
 #define LV_USE_GRID 1
 
+/** Cache the measurements of the children of flex and grid containers having at least this many children.
+ * When only a few children change, the layouts then reposition only the affected tracks
+ * instead of measuring and placing every child again.
+ * - 0: disable the cache */
+#define LV_LAYOUT_CACHE_MIN_CHILD_CNT 0
+
 /*====================
  * 3RD PARTS LIBRARIES
  *====================*/
@@ -994,7 +1078,7 @@
     /** 1: Enable the built-in profiler */
     #define LV_USE_PROFILER_BUILTIN 1
     #if LV_USE_PROFILER_BUILTIN
-        /** Default profiler trace buffer size */
+        /** Default profiler trace buffer size of each thread */
         #define LV_PROFILER_BUILTIN_BUF_SIZE (16 * 1024)     /**< [bytes] */
     #endif
 
@@ -1145,6 +1229,11 @@
     #define LV_LINUX_FBDEV_RENDER_MODE   LV_DISPLAY_RENDER_MODE_PARTIAL
     #define LV_LINUX_FBDEV_BUFFER_COUNT  0
     #define LV_LINUX_FBDEV_BUFFER_SIZE   60
+
+    /** Render into a screen sized buffer and copy only the changed areas to two framebuffer pages,
+     *  showing them with `FBIOPAN_DISPLAY`. If the driver can't pan, the changed areas are copied
+     *  once per frame to the visible framebuffer. The render mode and buffer count are ignored. */
+    #define LV_LINUX_FBDEV_PAGE_FLIP     0
 #endif
 
 /** Use Nuttx to open window and handle touchscreen */
@@ -37,6 +37,7 @@ extern "C" {
 #include "src/draw/lv_draw_rect_private.h"
 #include "src/draw/lv_draw_image_private.h"
 #include "src/draw/lv_image_decoder_private.h"
+#include "src/draw/lv_image_decoder_async_private.h"
 #include "src/draw/lv_draw_label_private.h"
 #include "src/draw/lv_draw_vector_private.h"
 #include "src/draw/lv_draw_buf_private.h"
@@ -54,6 +55,7 @@ extern "C" {
 #include "src/core/lv_obj_style_private.h"
 #include "src/core/lv_obj_private.h"
 #include "src/core/lv_obj_scroll_private.h"
+#include "src/core/lv_obj_hit_index_private.h"
 #include "src/core/lv_obj_draw_private.h"
 #include "src/core/lv_obj_class_private.h"
 #include "src/core/lv_group_private.h"
@@ -5,7 +5,7 @@ import argparse
 import subprocess
 from os import path
 from enum import Enum
-from typing import List
+from typing import List, Optional, Tuple
 from pathlib import Path
 
 try:
@@ -310,13 +310,16 @@ def write_c_array_file(
         filename: str,
         premultiplied: bool,
         compress: CompressMethod,
-        data: bytes):
+        data: bytes,
+        tiled: bool = False):
     varname = path.basename(filename).split('.')[0]
     varname = varname.replace("-", "_")
     varname = varname.replace(".", "_")
 
     flags = "0"
-    if compress is not CompressMethod.NONE:
+    if tiled:
+        flags += " | LV_IMAGE_FLAGS_TILED"
+    elif compress is not CompressMethod.NONE:
         flags += " | LV_IMAGE_FLAGS_COMPRESSED"
     if premultiplied:
         flags += " | LV_IMAGE_FLAGS_PREMULTIPLIED"
@@ -372,7 +375,7 @@ const lv_image_dsc_t {varname} = {{
     with open(filename, "w+") as f:
         f.write(header)
 
-        if compress != CompressMethod.NONE:
+        if compress != CompressMethod.NONE or tiled:
             write_binary(f, data, 16)
         else:
             # write palette separately
@@ -479,6 +482,7 @@ class LVGLCompressData:
             raise ParameterError(f"Invalid compress method: {self.compress}")
 
         self.compressed_len = len(compressed)
+        self.payload = compressed
 
         bin = bytearray()
         bin += uint32_t(self.compress.value)
@@ -744,9 +748,13 @@ class LVGLImage:
 
     def to_bin(self,
                filename: str,
-               compress: CompressMethod = CompressMethod.NONE):
+               compress: CompressMethod = CompressMethod.NONE,
+               tile: Optional[Tuple[int, int]] = None,
+               align: int = 1):
         """
         Write this image to file, filename should be ended with '.bin'
+        If tile is set as (width, height), the image is split to tiles which
+        are compressed and decoded separately.
         """
         self._check_ext(filename, ".bin")
         self._check_dir(filename)
@@ -754,7 +762,10 @@ class LVGLImage:
         with open(filename, "wb+") as f:
             bin = bytearray()
             flags = 0
-            flags |= 0x08 if compress != CompressMethod.NONE else 0
+            if tile:
+                flags |= 0x40
+            elif compress != CompressMethod.NONE:
+                flags |= 0x08
             flags |= 0x01 if self.premultiplied else 0
 
             header = LVGLImageHeader(self.cf,
@@ -763,8 +774,11 @@ class LVGLImage:
                                      self.stride,
                                      flags=flags)
             bin += header.binary
-            compressed = LVGLCompressData(self.cf, compress, self.data)
-            bin += compressed.compressed
+            if tile:
+                bin += self.to_tiled(tile[0], tile[1], compress, align)
+            else:
+                compressed = LVGLCompressData(self.cf, compress, self.data)
+                bin += compressed.compressed
 
             f.write(bin)
 
@@ -772,17 +786,89 @@ class LVGLImage:
 
     def to_c_array(self,
                    filename: str,
-                   compress: CompressMethod = CompressMethod.NONE):
+                   compress: CompressMethod = CompressMethod.NONE,
+                   tile: Optional[Tuple[int, int]] = None,
+                   align: int = 1):
         self._check_ext(filename, ".c")
         self._check_dir(filename)
 
-        if compress != CompressMethod.NONE:
+        if tile:
+            data = self.to_tiled(tile[0], tile[1], compress, align)
+        elif compress != CompressMethod.NONE:
             data = LVGLCompressData(self.cf, compress, self.data).compressed
         else:
             data = self.data
         write_c_array_file(self.w, self.h, self.stride, self.cf, filename,
                            self.premultiplied,
-                           compress, data)
+                           compress, data, tiled=tile is not None)
+
+    def to_tiled(self,
+                 tile_w: int,
+                 tile_h: int,
+                 compress: CompressMethod = CompressMethod.NONE,
+                 align: int = 1) -> bytearray:
+        """
+        Split the image to tiles of tile_w x tile_h pixels. The tiles on the
+        right and bottom edge are padded with zeros.
+        Return the tiled header, the tile index table and the tile data.
+        """
+        if self.cf.is_indexed or self.cf.bpp < 8:
+            raise ParameterError(f"Tiled image is not supported for {self.cf.name}")
+        if not 0 < tile_w <= 0xffff or not 0 < tile_h <= 0xffff:
+            raise ParameterError(f"Invalid tile size: {tile_w}x{tile_h}")
+
+        tile_stride = LVGLImageHeader(self.cf, tile_w, tile_h, align=align).stride
+        if tile_stride > 0xffff:
+            raise ParameterError(f"Tile stride overflow: {tile_stride}")
+
+        # data, stride, pixel size and tile stride of the planes
+        planes = [(self.data, self.stride, self.cf.bpp // 8, tile_stride)]
+        if self.cf is ColorFormat.RGB565A8:
+            color_size = self.stride * self.h
+            planes = [(self.data[:color_size], self.stride, 2, tile_stride),
+                      (self.data[color_size:], self.stride // 2, 1, tile_stride // 2)]
+
+        cols = (self.w + tile_w - 1) // tile_w
+        rows = (self.h + tile_h - 1) // tile_h
+        offset = 8 + cols * rows * 8  # tiled header and tile index table
+
+        index = bytearray()
+        tiles = bytearray()
+        for row in range(rows):
+            for col in range(cols):
+                x = col * tile_w
+                w = min(tile_w, self.w - x)
+                raw = bytearray()
+                for data, stride, pixel_size, dst_stride in planes:
+                    for y in range(row * tile_h, (row + 1) * tile_h):
+                        line = b''
+                        if y < self.h:
+                            start = y * stride + x * pixel_size
+                            line = data[start:start + w * pixel_size]
+                        raw += line + b'\x00' * (dst_stride - len(line))
+
+                # store the tile as it is if compression doesn't help
+                method = compress
+                tile = raw
+                if compress != CompressMethod.NONE:
+                    payload = LVGLCompressData(self.cf, compress, raw).payload
+                    if len(payload) < len(raw):
+                        tile = payload
+                    else:
+                        method = CompressMethod.NONE
+
+                index += uint32_t(offset + len(tiles))
+                index += uint32_t(method.value | (len(tile) << 4))
+                tiles += tile
+
+        bin = bytearray()
+        bin += uint16_t(tile_w)
+        bin += uint16_t(tile_h)
+        bin += uint16_t(tile_stride)
+        bin += uint16_t(0)  # 16bits reserved
+        bin += index
+        bin += tiles
+        return bin
 
     def to_png(self, filename: str):
         self._check_ext(filename, ".png")
@@ -1262,7 +1348,8 @@ class PNGConverter:
                  premultiply: bool = False,
                  compress: CompressMethod = CompressMethod.NONE,
                  keep_folder=True,
-                 rgb565_dither=False) -> None:
+                 rgb565_dither=False,
+                 tile: Optional[Tuple[int, int]] = None) -> None:
         self.files = files
         self.cf = cf
         self.ofmt = ofmt
@@ -1274,6 +1361,7 @@ class PNGConverter:
         self.compress = compress
         self.background = background
         self.rgb565_dither = rgb565_dither
+        self.tile = tile
 
     def _replace_ext(self, input, ext):
         if self.keep_folder:
@@ -1300,10 +1388,14 @@ class PNGConverter:
                 output.append((f, img))
                 if self.ofmt == OutputFormat.BIN_FILE:
                     img.to_bin(self._replace_ext(f, ".bin"),
-                               compress=self.compress)
+                               compress=self.compress,
+                               tile=self.tile,
+                               align=self.align)
                 elif self.ofmt == OutputFormat.C_ARRAY:
                     img.to_c_array(self._replace_ext(f, ".c"),
-                                   compress=self.compress)
+                                   compress=self.compress,
+                                   tile=self.tile,
+                                   align=self.align)
                 elif self.ofmt == OutputFormat.PNG_FILE:
                     img.to_png(self._replace_ext(f, ".png"))
 
@@ -1344,6 +1436,12 @@ def main():
                         type=int,
                         metavar='byte',
                         nargs='?')
+    parser.add_argument('--tile',
+                        help=("split the image to tiles of WxH pixels which "
+                              "are compressed and decoded one by one"),
+                        default=None,
+                        type=lambda x: tuple(int(v) for v in x.lower().split('x')),
+                        metavar='WxH')
     parser.add_argument('--background',
                         help="Background color for formats without alpha",
                         default=0x00_00_00,
@@ -1390,7 +1488,8 @@ def main():
                              premultiply=args.premultiply,
                              compress=compress,
                              keep_folder=False,
-                             rgb565_dither=args.rgb565dither)
+                             rgb565_dither=args.rgb565dither,
+                             tile=args.tile)
     output = converter.convert()
     for f, img in output:
         logging.info(f"len: {img.data_len} for {path.basename(f)} ")
@@ -0,0 +1,126 @@
+#!/usr/bin/env python3
+
+import argparse
+import json
+from pathlib import Path
+
+MAGIC = b'LVPF'
+VERSION = 1
+
+
+def get_arg():
+    parser = argparse.ArgumentParser(description='Convert a binary trace of the built-in profiler to '
+                                                 'Chrome trace event JSON (can be opened by Perfetto too).')
+    parser.add_argument('bin_file', metavar='bin_file', type=str,
+                        help='The binary trace written by flush_bin_cb.')
+    parser.add_argument('json_file', metavar='json_file', type=str, nargs='?',
+                        help='The output JSON file. If not provided, defaults to \'<bin_file>.json\'.')
+
+    args = parser.parse_args()
+    return args
+
+
+class Reader:
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+
+    def eof(self):
+        return self.pos >= len(self.data)
+
+    def u8(self):
+        v = self.data[self.pos]
+        self.pos += 1
+        return v
+
+    def bytes(self, n):
+        v = self.data[self.pos:self.pos + n]
+        self.pos += n
+        return v
+
+    def i32(self):
+        return int.from_bytes(self.bytes(4), 'little', signed=True)
+
+    def u32(self):
+        return int.from_bytes(self.bytes(4), 'little')
+
+    def uleb(self):
+        v = 0
+        shift = 0
+        while True:
+            b = self.u8()
+            v |= (b & 0x7F) << shift
+            shift += 7
+            if not b & 0x80:
+                return v
+
+
+def convert(data):
+    r = Reader(data)
+    if r.bytes(4) != MAGIC:
+        raise ValueError('not a binary LVGL trace')
+
+    version = r.u8()
+    if version != VERSION:
+        raise ValueError('unsupported version: %d' % version)
+
+    tick_per_sec = r.u32()
+    us_per_tick = 1000000 / tick_per_sec
+
+    threads = {}
+    last_tick = {}
+    strings = {}
+    events = []
+
+    # A new header starts when the profiler is initialized again
+    while not r.eof():
+        rec = r.u8()
+        if rec == ord('T'):
+            idx = r.u8()
+            tid = r.i32()
+            threads[idx] = tid
+            last_tick[idx] = 0
+            events.append({'name': 'thread_name', 'ph': 'M', 'pid': 1, 'tid': tid,
+                           'args': {'name': 'LVGL-%d' % tid}})
+        elif rec == ord('S'):
+            sid = r.uleb()
+            length = r.u8()
+            strings[sid] = r.bytes(length).decode('utf-8', 'replace')
+        elif rec in (ord('B'), ord('E')):
+            idx = r.u8()
+            cpu = r.u8()
+            sid = r.uleb()
+            tick = last_tick[idx] + r.uleb()
+            last_tick[idx] = tick
+            events.append({'name': strings[sid], 'ph': chr(rec), 'ts': tick * us_per_tick,
+                           'pid': 1, 'tid': threads[idx], 'args': {'cpu': cpu}})
+        elif rec == MAGIC[0] and r.bytes(3) == MAGIC[1:]:
+            r.u8()
+            tick_per_sec = r.u32()
+            us_per_tick = 1000000 / tick_per_sec
+            threads = {}
+            last_tick = {}
+            strings = {}
+        else:
+            raise ValueError('unknown record 0x%02x at offset %d' % (rec, r.pos - 1))
+
+    return {'traceEvents': events, 'displayTimeUnit': 'ns'}
+
+
+if __name__ == '__main__':
+    args = get_arg()
+
+    if not args.json_file:
+        bin_file = Path(args.bin_file)
+        args.json_file = bin_file.with_suffix('.json').as_posix()
+
+    print('bin_file :', args.bin_file)
+    print('json_file:', args.json_file)
+
+    with open(args.bin_file, 'rb') as f:
+        trace = convert(f.read())
+
+    with open(args.json_file, 'w') as f:
+        json.dump(trace, f)
+
+    print('events   :', len(trace['traceEvents']))
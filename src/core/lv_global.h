@@ -44,6 +44,7 @@ extern "C" {
 #include "../misc/lv_anim_private.h"
 #include "../tick/lv_tick_private.h"
 #include "../draw/lv_draw_buf_private.h"
+#include "../draw/lv_image_decoder_async_private.h"
 #include "../draw/lv_draw_private.h"
 #include "../draw/sw/lv_draw_sw_private.h"
 #include "../draw/sw/lv_draw_sw_mask_private.h"
@@ -120,6 +121,16 @@ typedef struct _lv_global_t {
 
     lv_cache_t * img_cache;
     lv_cache_t * img_header_cache;
+    lv_cache_t * img_tile_cache;
+#if LV_USE_IMAGE_DECODER_ASYNC
+    lv_image_decoder_async_t img_decoder_async;
+#endif
+
+#if LV_OBJ_LAYER_CACHE_SIZE
+    lv_cache_t * obj_layer_cache;
+    lv_ll_t obj_layer_cache_acquired_ll;   /**< Entries used by the draw tasks of the current refresh*/
+    const lv_obj_t * obj_layer_cache_kept; /**< Its own layer is not dropped when this object is invalidated*/
+#endif
 
     lv_draw_global_info_t draw_info;
 #if defined(LV_DRAW_SW_SHADOW_CACHE_SIZE) && LV_DRAW_SW_SHADOW_CACHE_SIZE > 0
@@ -193,6 +204,10 @@ typedef struct _lv_global_t {
     lv_font_fmt_rle_t font_fmt_rle;
 #endif
 
+#if LV_FONT_FMT_TXT_CACHE_CNT
+    lv_font_fmt_txt_cache_t font_fmt_txt_cache;
+#endif
+
 #if LV_USE_SPAN != 0
     struct _snippet_stack * span_snippet_stack;
 #endif
@@ -7,6 +7,9 @@
  *      INCLUDES
  *********************/
 #include "lv_obj_private.h"
+#include "lv_obj_hit_index_private.h"
+#include "lv_obj_layer_cache_private.h"
+#include "../layouts/lv_layout_private.h"
 #include "../misc/lv_event_private.h"
 #include "../misc/lv_area_private.h"
 #include "lv_obj_style_private.h"
@@ -241,6 +244,8 @@ void lv_obj_add_flag(lv_obj_t * obj, lv_obj_flag_t f)
 
     obj->flags |= f;
 
+    if(f & (LV_OBJ_FLAG_FLOATING | LV_OBJ_FLAG_OVERFLOW_VISIBLE)) lv_obj_hit_index_invalidate(lv_obj_get_parent(obj));
+
     if(f & LV_OBJ_FLAG_HIDDEN) {
         if(lv_obj_has_state(obj, LV_STATE_FOCUSED)) {
             lv_group_t * group = lv_obj_get_group(obj);
@@ -283,6 +288,8 @@ void lv_obj_remove_flag(lv_obj_t * obj, lv_obj_flag_t f)
 
     obj->flags &= (~f);
 
+    if(f & (LV_OBJ_FLAG_FLOATING | LV_OBJ_FLAG_OVERFLOW_VISIBLE)) lv_obj_hit_index_invalidate(lv_obj_get_parent(obj));
+
     if(f & LV_OBJ_FLAG_HIDDEN) {
         lv_obj_invalidate(obj);
         lv_obj_mark_layout_as_dirty(lv_obj_get_parent(obj));
@@ -518,6 +525,10 @@ static void lv_obj_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     lv_obj_enable_style_refresh(false); /*No need to refresh the style because the object will be deleted*/
     lv_obj_remove_style_all(obj);
     lv_obj_enable_style_refresh(true);
+#if LV_OBJ_STYLE_CACHE && LV_OBJ_STYLE_VALUE_CACHE_CNT
+    lv_free(obj->style_value_cache);
+    obj->style_value_cache = NULL;
+#endif
 
     /*Remove the animations from this object*/
     lv_anim_delete(obj, NULL);
@@ -534,6 +545,18 @@ static void lv_obj_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
 
         lv_event_remove_all(&obj->spec_attr->event_list);
 
+#if LV_OBJ_HIT_INDEX_MIN_CHILD_CNT
+        lv_obj_hit_index_delete(obj);
+#endif
+
+#if LV_OBJ_LAYER_CACHE_SIZE
+        lv_obj_layer_cache_drop(obj);
+#endif
+
+#if LV_LAYOUT_CACHE_MIN_CHILD_CNT
+        lv_layout_cache_delete(obj);
+#endif
+
 #if LV_DRAW_TRANSFORM_USE_MATRIX
         if(obj->spec_attr->matrix) {
             lv_free(obj->spec_attr->matrix);
@@ -8,6 +8,7 @@
  *********************/
 #include "lv_obj_draw_private.h"
 #include "lv_obj_private.h"
+#include "lv_obj_layer_cache_private.h"
 #include "lv_obj_style.h"
 #include "../display/lv_display.h"
 #include "../indev/lv_indev.h"
@@ -358,6 +359,30 @@ void lv_obj_refresh_ext_draw_size(lv_obj_t * obj)
     LV_PROFILER_DRAW_END;
 }
 
+void lv_obj_set_layer_retained(lv_obj_t * obj, bool en)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    if(lv_obj_get_layer_retained(obj) == en) return;
+
+    lv_obj_allocate_spec_attr(obj);
+    obj->spec_attr->layer_retained = en;
+
+#if LV_OBJ_LAYER_CACHE_SIZE
+    if(!en) lv_obj_layer_cache_drop(obj);
+#endif
+
+    lv_obj_invalidate(obj);
+}
+
+bool lv_obj_get_layer_retained(const lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    if(obj->spec_attr) return obj->spec_attr->layer_retained;
+    else return false;
+}
+
 int32_t lv_obj_get_ext_draw_size(const lv_obj_t * obj)
 {
     if(obj->spec_attr) return obj->spec_attr->ext_draw_size;
@@ -102,6 +102,24 @@ int32_t lv_obj_calculate_ext_draw_size(lv_obj_t * obj, lv_part_t part);
  */
 void lv_obj_refresh_ext_draw_size(lv_obj_t * obj);
 
+/**
+ * Keep the content of the object's layer between refreshes.
+ * It has effect only if the object is drawn on a layer, i.e. it's transformed or `opa_layered < 255`.
+ * While only the transformation or `opa_layered` changes, the retained layer is blended again
+ * without redrawing the object and its children.
+ * Requires `LV_OBJ_LAYER_CACHE_SIZE > 0`.
+ * @param obj       pointer to an object
+ * @param en        true: retain the layer; false: draw the layer on every refresh
+ */
+void lv_obj_set_layer_retained(lv_obj_t * obj, bool en);
+
+/**
+ * Get whether the content of the object's layer is kept between refreshes.
+ * @param obj       pointer to an object
+ * @return          true: the layer is retained
+ */
+bool lv_obj_get_layer_retained(const lv_obj_t * obj);
+
 /**********************
  *      MACROS
  **********************/
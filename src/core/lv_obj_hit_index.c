@@ -0,0 +1,296 @@
+/**
+ * @file lv_obj_hit_index.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_obj_hit_index_private.h"
+#include "lv_obj_private.h"
+#include "lv_obj_draw_private.h"
+#include "../misc/lv_area_private.h"
+#include "../stdlib/lv_mem.h"
+#include "../stdlib/lv_string.h"
+
+#if LV_OBJ_HIT_INDEX_MIN_CHILD_CNT
+
+/*********************
+ *      DEFINES
+ *********************/
+#define MAX_CELLS_PER_SIDE      128
+
+/*Children covering more cells than this are checked for every point instead*/
+#define MAX_CELLS_PER_CHILD     16
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static bool rebuild(lv_obj_t * obj, lv_obj_hit_index_t * idx);
+static bool get_child_area(lv_obj_t * child, int32_t ofs_x, int32_t ofs_y, lv_area_t * area, bool * always);
+static bool get_cells(const lv_obj_hit_index_t * idx, const lv_area_t * area, lv_area_t * cells);
+static bool reserve(uint32_t ** buf, uint32_t * size, uint32_t req);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_obj_hit_index_invalidate(lv_obj_t * obj)
+{
+    if(obj && obj->spec_attr && obj->spec_attr->hit_index) {
+        obj->spec_attr->hit_index->valid = 0;
+    }
+}
+
+void lv_obj_hit_index_delete(lv_obj_t * obj)
+{
+    lv_obj_hit_index_t * idx = obj->spec_attr ? obj->spec_attr->hit_index : NULL;
+    if(idx == NULL) return;
+
+    lv_free(idx->cell_start);
+    lv_free(idx->items);
+    lv_free(idx->always);
+    lv_free(idx);
+    obj->spec_attr->hit_index = NULL;
+}
+
+bool lv_obj_hit_index_iter_init(lv_obj_t * obj, const lv_point_t * point, lv_obj_hit_index_iter_t * iter)
+{
+    if(obj->spec_attr == NULL) return false;
+
+    uint32_t child_cnt = obj->spec_attr->child_cnt;
+    if(child_cnt < LV_OBJ_HIT_INDEX_MIN_CHILD_CNT) {
+        lv_obj_hit_index_delete(obj);
+        return false;
+    }
+
+    lv_obj_hit_index_t * idx = obj->spec_attr->hit_index;
+    if(idx == NULL) {
+        idx = lv_malloc_zeroed(sizeof(lv_obj_hit_index_t));
+        if(idx == NULL) return false;
+        obj->spec_attr->hit_index = idx;
+    }
+
+    if(!idx->valid || idx->child_cnt != child_cnt) {
+        if(!rebuild(obj, idx)) return false;
+    }
+
+    iter->always = idx->always;
+    iter->always_cnt = idx->always_cnt;
+    iter->cell = NULL;
+    iter->cell_cnt = 0;
+
+    int32_t x = point->x - obj->coords.x1 - obj->spec_attr->scroll.x;
+    int32_t y = point->y - obj->coords.y1 - obj->spec_attr->scroll.y;
+    if(x < idx->bounds.x1 || x > idx->bounds.x2 || y < idx->bounds.y1 || y > idx->bounds.y2) return true;
+
+    uint32_t cx = (uint32_t)((x - idx->bounds.x1) / idx->cell_w);
+    uint32_t cy = (uint32_t)((y - idx->bounds.y1) / idx->cell_h);
+    uint32_t c = cy * idx->col_cnt + cx;
+    iter->cell = &idx->items[idx->cell_start[c]];
+    iter->cell_cnt = idx->cell_start[c + 1] - idx->cell_start[c];
+
+    return true;
+}
+
+int32_t lv_obj_hit_index_iter_next(lv_obj_hit_index_iter_t * iter)
+{
+    /*Both lists are ascending and disjoint so merge them from the end*/
+    if(iter->cell_cnt &&
+       (iter->always_cnt == 0 || iter->cell[iter->cell_cnt - 1] > iter->always[iter->always_cnt - 1])) {
+        iter->cell_cnt--;
+        return (int32_t)iter->cell[iter->cell_cnt];
+    }
+
+    if(iter->always_cnt) {
+        iter->always_cnt--;
+        return (int32_t)iter->always[iter->always_cnt];
+    }
+
+    return -1;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static bool rebuild(lv_obj_t * obj, lv_obj_hit_index_t * idx)
+{
+    uint32_t child_cnt = obj->spec_attr->child_cnt;
+    lv_obj_t ** children = obj->spec_attr->children;
+    int32_t ofs_x = obj->coords.x1 + obj->spec_attr->scroll.x;
+    int32_t ofs_y = obj->coords.y1 + obj->spec_attr->scroll.y;
+
+    idx->valid = 0;
+    if(!reserve(&idx->always, &idx->child_size, child_cnt)) return false;
+
+    /*Get the bounding box of the children that go to the grid*/
+    uint32_t grid_cnt = 0;
+    lv_area_t a;
+    bool always;
+    uint32_t i;
+    for(i = 0; i < child_cnt; i++) {
+        if(!get_child_area(children[i], ofs_x, ofs_y, &a, &always) || always) continue;
+        if(grid_cnt == 0) idx->bounds = a;
+        else lv_area_join(&idx->bounds, &idx->bounds, &a);
+        grid_cnt++;
+    }
+
+    /*Aim for about one child per cell keeping the cells close to square*/
+    if(grid_cnt == 0) {
+        lv_area_set(&idx->bounds, 0, 0, 0, 0);
+        grid_cnt = 1;
+    }
+    int32_t w = lv_area_get_width(&idx->bounds);
+    int32_t h = lv_area_get_height(&idx->bounds);
+    uint64_t cols = lv_sqrt32((uint32_t)LV_MIN(((uint64_t)grid_cnt * w) / h, UINT32_MAX));
+    cols = LV_CLAMP(1, cols, MAX_CELLS_PER_SIDE);
+    uint64_t rows = LV_CLAMP(1, (grid_cnt + cols - 1) / cols, MAX_CELLS_PER_SIDE);
+    idx->col_cnt = (uint32_t)cols;
+    idx->row_cnt = (uint32_t)rows;
+    idx->cell_w = (w + (int32_t)cols - 1) / (int32_t)cols;
+    idx->cell_h = (h + (int32_t)rows - 1) / (int32_t)rows;
+
+    uint32_t cell_cnt = idx->col_cnt * idx->row_cnt;
+    if(!reserve(&idx->cell_start, &idx->cell_size, cell_cnt + 1)) return false;
+    lv_memzero(idx->cell_start, (cell_cnt + 1) * sizeof(uint32_t));
+
+    /*Count the children per cell and collect the ones which are always checked*/
+    idx->always_cnt = 0;
+    uint32_t item_cnt = 0;
+    for(i = 0; i < child_cnt; i++) {
+        if(!get_child_area(children[i], ofs_x, ofs_y, &a, &always)) continue;
+        if(!always) {
+            lv_area_t cells;
+            if(!get_cells(idx, &a, &cells)) {
+                always = true;
+            }
+            else {
+                int32_t cx, cy;
+                for(cy = cells.y1; cy <= cells.y2; cy++) {
+                    for(cx = cells.x1; cx <= cells.x2; cx++) {
+                        idx->cell_start[cy * (int32_t)idx->col_cnt + cx + 1]++;
+                    }
+                }
+                item_cnt += (uint32_t)lv_area_get_size(&cells);
+            }
+        }
+
+        if(always) {
+            idx->always[idx->always_cnt] = i;
+            idx->always_cnt++;
+        }
+    }
+
+    for(i = 0; i < cell_cnt; i++) {
+        idx->cell_start[i + 1] += idx->cell_start[i];
+    }
+
+    if(!reserve(&idx->items, &idx->item_size, LV_MAX(item_cnt, 1))) return false;
+
+    /*Fill the cells. Children are added in increasing index order so every cell is ascending.
+     *`cell_start[c]` is used as a write pointer and restored afterwards.*/
+    for(i = 0; i < child_cnt; i++) {
+        if(!get_child_area(children[i], ofs_x, ofs_y, &a, &always) || always) continue;
+        lv_area_t cells;
+        if(!get_cells(idx, &a, &cells)) continue;
+
+        int32_t cx, cy;
+        for(cy = cells.y1; cy <= cells.y2; cy++) {
+            for(cx = cells.x1; cx <= cells.x2; cx++) {
+                int32_t c = cy * (int32_t)idx->col_cnt + cx;
+                idx->items[idx->cell_start[c]] = i;
+                idx->cell_start[c]++;
+            }
+        }
+    }
+
+    for(i = cell_cnt; i > 0; i--) {
+        idx->cell_start[i] = idx->cell_start[i - 1];
+    }
+    idx->cell_start[0] = 0;
+
+    idx->child_cnt = child_cnt;
+    idx->valid = 1;
+
+    return true;
+}
+
+/**
+ * Get the area in which a child or its children can be found, relative to the parent's origin
+ * @param child     pointer to a child
+ * @param ofs_x     x coordinate of the parent's scrolled origin
+ * @param ofs_y     y coordinate of the parent's scrolled origin
+ * @param area      store the area here
+ * @param always    set to true if the child needs to be checked for every point
+ * @return          false: the child can't be found at any point
+ */
+static bool get_child_area(lv_obj_t * child, int32_t ofs_x, int32_t ofs_y, lv_area_t * area, bool * always)
+{
+    /*These can be anywhere: floating children don't scroll with the parent,
+     *transformed ones and children overflowing their parent can be outside of their coordinates*/
+    if(lv_obj_has_flag_any(child, LV_OBJ_FLAG_FLOATING | LV_OBJ_FLAG_OVERFLOW_VISIBLE) ||
+       lv_obj_get_layer_type(child) == LV_LAYER_TYPE_TRANSFORM) {
+        *always = true;
+        return true;
+    }
+
+    *always = false;
+
+    /*The child can be hit on its click area and its children inside its coordinates*/
+    lv_area_t click_area;
+    lv_obj_get_click_area(child, &click_area);
+    bool coords_ok = child->coords.x1 <= child->coords.x2 && child->coords.y1 <= child->coords.y2;
+    bool click_ok = click_area.x1 <= click_area.x2 && click_area.y1 <= click_area.y2;
+    if(coords_ok && click_ok) lv_area_join(area, &child->coords, &click_area);
+    else if(coords_ok) *area = child->coords;
+    else if(click_ok) *area = click_area;
+    else return false;
+
+    lv_area_move(area, -ofs_x, -ofs_y);
+
+    return true;
+}
+
+/**
+ * Get the range of cells covered by an area
+ * @param idx       pointer to a hit index with its grid already set up
+ * @param area      an area inside `idx->bounds`
+ * @param cells     store the first and last column and row here
+ * @return          false: the area covers too many cells to be stored in the grid
+ */
+static bool get_cells(const lv_obj_hit_index_t * idx, const lv_area_t * area, lv_area_t * cells)
+{
+    cells->x1 = (area->x1 - idx->bounds.x1) / idx->cell_w;
+    cells->x2 = (area->x2 - idx->bounds.x1) / idx->cell_w;
+    cells->y1 = (area->y1 - idx->bounds.y1) / idx->cell_h;
+    cells->y2 = (area->y2 - idx->bounds.y1) / idx->cell_h;
+
+    return lv_area_get_size(cells) <= MAX_CELLS_PER_CHILD;
+}
+
+static bool reserve(uint32_t ** buf, uint32_t * size, uint32_t req)
+{
+    if(*size >= req) return true;
+
+    uint32_t * new_buf = lv_realloc(*buf, req * sizeof(uint32_t));
+    if(new_buf == NULL) return false;
+
+    *buf = new_buf;
+    *size = req;
+    return true;
+}
+
+#endif /*LV_OBJ_HIT_INDEX_MIN_CHILD_CNT*/
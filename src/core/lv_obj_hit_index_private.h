@@ -0,0 +1,111 @@
+/**
+ * @file lv_obj_hit_index_private.h
+ *
+ */
+
+#ifndef LV_OBJ_HIT_INDEX_PRIVATE_H
+#define LV_OBJ_HIT_INDEX_PRIVATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_obj.h"
+
+#if LV_OBJ_HIT_INDEX_MIN_CHILD_CNT
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Uniform grid over the children of an object.
+ * Every cell lists the indexes of the children whose click area overlaps the cell.
+ * The areas are stored relative to the parent's scrolled origin so moving or scrolling
+ * the parent doesn't invalidate the index.
+ */
+struct _lv_obj_hit_index_t {
+    lv_area_t bounds;           /**< Union of the indexed areas, relative to the origin*/
+    int32_t cell_w;
+    int32_t cell_h;
+    uint32_t col_cnt;
+    uint32_t row_cnt;
+    uint32_t * cell_start;      /**< Start of each cell in `items`, `col_cnt * row_cnt + 1` elements*/
+    uint32_t * items;           /**< Child indexes per cell, ascending*/
+    uint32_t * always;          /**< Child indexes which are checked for every point, ascending*/
+    uint32_t always_cnt;
+    uint32_t cell_size;         /**< Allocated elements in `cell_start`*/
+    uint32_t item_size;         /**< Allocated elements in `items`*/
+    uint32_t child_size;        /**< Allocated elements in `always`*/
+    uint32_t child_cnt;         /**< Number of children when the index was built*/
+    uint32_t valid : 1;
+};
+
+/**
+ * Iterates the candidate children for a point from the top (last) to the bottom (first)
+ */
+struct _lv_obj_hit_index_iter_t {
+    const uint32_t * cell;
+    uint32_t cell_cnt;
+    const uint32_t * always;
+    uint32_t always_cnt;
+};
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Mark the hit index of an object as outdated. It will be rebuilt on the next search.
+ * Should be called when a child is added, removed, reordered, moved or resized.
+ * @param obj       pointer to an object (can be NULL)
+ */
+void lv_obj_hit_index_invalidate(lv_obj_t * obj);
+
+/**
+ * Free the hit index of an object
+ * @param obj       pointer to an object
+ */
+void lv_obj_hit_index_delete(lv_obj_t * obj);
+
+/**
+ * Start iterating the children of an object which can contain a point.
+ * The index is (re)built here if required.
+ * @param obj       pointer to an object
+ * @param point     the point in the coordinate system of the children (already transformed by `obj`)
+ * @param iter      iterator to initialize
+ * @return          true: `iter` is ready to use;
+ *                  false: the object has too few children for an index, check all of them
+ */
+bool lv_obj_hit_index_iter_init(lv_obj_t * obj, const lv_point_t * point, lv_obj_hit_index_iter_t * iter);
+
+/**
+ * Get the index of the next candidate child, from the top to the bottom
+ * @param iter      pointer to an initialized iterator
+ * @return          index of a child or -1 if there are no more candidates
+ */
+int32_t lv_obj_hit_index_iter_next(lv_obj_hit_index_iter_t * iter);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#else
+
+#define lv_obj_hit_index_invalidate(obj) LV_UNUSED(obj)
+
+#endif /*LV_OBJ_HIT_INDEX_MIN_CHILD_CNT*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_OBJ_HIT_INDEX_PRIVATE_H*/
@@ -0,0 +1,236 @@
+/**
+ * @file lv_obj_layer_cache.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_obj_layer_cache_private.h"
+#include "lv_obj_private.h"
+#include "lv_refr_private.h"
+#include "lv_global.h"
+#include "../display/lv_display_private.h"
+#include "../draw/lv_draw_private.h"
+#include "../misc/lv_area_private.h"
+#include "../misc/cache/lv_cache.h"
+
+#if LV_OBJ_LAYER_CACHE_SIZE
+
+/*********************
+ *      DEFINES
+ *********************/
+#define CACHE_NAME  "OBJ_LAYER"
+
+#define layer_cache_p (LV_GLOBAL_DEFAULT()->obj_layer_cache)
+#define acquired_ll_p (&LV_GLOBAL_DEFAULT()->obj_layer_cache_acquired_ll)
+#define kept_obj (LV_GLOBAL_DEFAULT()->obj_layer_cache_kept)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    lv_cache_slot_size_t slot;
+    const lv_obj_t * obj;
+    lv_area_t area;         /**< Area of the object when the layer was drawn*/
+    lv_opa_t opa;           /**< Opacity inherited from the parents when the layer was drawn*/
+    lv_draw_buf_t * buf;
+} layer_cache_data_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static lv_cache_compare_res_t layer_cache_compare_cb(const layer_cache_data_t * lhs, const layer_cache_data_t * rhs);
+static void layer_cache_free_cb(layer_cache_data_t * data, void * user_data);
+static void draw_layer(lv_obj_t * obj, lv_draw_buf_t * buf, const lv_area_t * area, lv_opa_t opa);
+static lv_draw_buf_t * use_entry(lv_cache_entry_t * entry);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_obj_layer_cache_init(void)
+{
+    layer_cache_p = lv_cache_create(&lv_cache_class_lru_rb_size,
+    sizeof(layer_cache_data_t), LV_OBJ_LAYER_CACHE_SIZE, (lv_cache_ops_t) {
+        .compare_cb = (lv_cache_compare_cb_t) layer_cache_compare_cb,
+        .create_cb = NULL,
+        .free_cb = (lv_cache_free_cb_t) layer_cache_free_cb,
+    });
+    lv_cache_set_name(layer_cache_p, CACHE_NAME);
+
+    lv_ll_init(acquired_ll_p, sizeof(lv_cache_entry_t *));
+    kept_obj = NULL;
+}
+
+void lv_obj_layer_cache_deinit(void)
+{
+    lv_obj_layer_cache_release_all();
+    lv_cache_destroy(layer_cache_p, NULL);
+    layer_cache_p = NULL;
+}
+
+lv_draw_buf_t * lv_obj_layer_cache_get(lv_obj_t * obj, const lv_area_t * area, lv_opa_t opa)
+{
+    if(!lv_cache_is_enabled(layer_cache_p)) return NULL;
+
+    layer_cache_data_t search_key;
+    search_key.obj = obj;
+
+    lv_cache_entry_t * entry = lv_cache_acquire(layer_cache_p, &search_key, NULL);
+    if(entry) {
+        layer_cache_data_t * data = lv_cache_entry_get_data(entry);
+        if(lv_area_is_equal(&data->area, area) && data->opa == opa) {
+            return use_entry(entry);
+        }
+
+        /*The object was moved, resized or the opacity of a parent has changed*/
+        lv_cache_release(layer_cache_p, entry, NULL);
+        lv_cache_drop(layer_cache_p, &search_key, NULL);
+    }
+
+    int32_t w = lv_area_get_width(area);
+    int32_t h = lv_area_get_height(area);
+    uint32_t buf_size = h * lv_draw_buf_width_to_stride(w, LV_COLOR_FORMAT_ARGB8888);
+    if(buf_size > lv_cache_get_max_size(layer_cache_p, NULL)) return NULL;
+
+    LV_PROFILER_REFR_BEGIN;
+    lv_draw_buf_t * buf = lv_draw_buf_create(w, h, LV_COLOR_FORMAT_ARGB8888, LV_STRIDE_AUTO);
+    if(buf == NULL) {
+        LV_PROFILER_REFR_END;
+        return NULL;
+    }
+
+    draw_layer(obj, buf, area, opa);
+
+    search_key.slot.size = buf->data_size;
+    search_key.area = *area;
+    search_key.opa = opa;
+    search_key.buf = buf;
+    entry = lv_cache_add(layer_cache_p, &search_key, NULL);
+    if(entry == NULL) {
+        lv_draw_buf_destroy(buf);
+        LV_PROFILER_REFR_END;
+        return NULL;
+    }
+
+    LV_PROFILER_REFR_END;
+    return use_entry(entry);
+}
+
+void lv_obj_layer_cache_release_all(void)
+{
+    lv_cache_entry_t ** entry_p;
+    LV_LL_READ(acquired_ll_p, entry_p) {
+        lv_cache_release(layer_cache_p, *entry_p, NULL);
+    }
+    lv_ll_clear(acquired_ll_p);
+}
+
+void lv_obj_layer_cache_invalidate(const lv_obj_t * obj)
+{
+    if(kept_obj != obj) lv_obj_layer_cache_drop(obj);
+
+    /*The layers of the parents contain this object too*/
+    obj = obj->parent;
+    while(obj) {
+        lv_obj_layer_cache_drop(obj);
+        obj = obj->parent;
+    }
+}
+
+void lv_obj_layer_cache_keep(const lv_obj_t * obj)
+{
+    kept_obj = obj;
+}
+
+void lv_obj_layer_cache_drop(const lv_obj_t * obj)
+{
+    /*Only objects with retained layer can have an entry*/
+    if(obj->spec_attr == NULL || !obj->spec_attr->layer_retained) return;
+
+    layer_cache_data_t search_key;
+    search_key.obj = obj;
+    lv_cache_drop(layer_cache_p, &search_key, NULL);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static lv_cache_compare_res_t layer_cache_compare_cb(const layer_cache_data_t * lhs, const layer_cache_data_t * rhs)
+{
+    if(lhs->obj != rhs->obj) {
+        return lhs->obj > rhs->obj ? 1 : -1;
+    }
+
+    return 0;
+}
+
+static void layer_cache_free_cb(layer_cache_data_t * data, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    /*The buffer was drawn as an image so the image cache might refer to it*/
+    lv_image_cache_drop(data->buf);
+    lv_draw_buf_destroy(data->buf);
+}
+
+/**
+ * Draw an object and its children into a standalone layer, similarly to taking a snapshot
+ */
+static void draw_layer(lv_obj_t * obj, lv_draw_buf_t * buf, const lv_area_t * area, lv_opa_t opa)
+{
+    lv_draw_buf_clear(buf, NULL);
+
+    lv_layer_t layer;
+    lv_layer_init(&layer);
+    layer.draw_buf = buf;
+    layer.buf_area = *area;
+    layer._clip_area = *area;
+    layer.phy_clip_area = *area;
+    layer.color_format = LV_COLOR_FORMAT_ARGB8888;
+    layer.opa = opa;
+
+    /*Dispatch only the tasks of the new layer and its child layers*/
+    lv_display_t * disp = lv_refr_get_disp_refreshing();
+    lv_layer_t * layer_head_ori = disp->layer_head;
+    disp->layer_head = &layer;
+
+    lv_obj_redraw(&layer, obj);
+
+    while(layer.draw_task_head) {
+        lv_draw_dispatch_wait_for_request();
+        lv_draw_dispatch();
+    }
+
+    disp->layer_head = layer_head_ori;
+}
+
+/**
+ * Keep an entry acquired until the end of the refresh as draw tasks will read its buffer
+ */
+static lv_draw_buf_t * use_entry(lv_cache_entry_t * entry)
+{
+    lv_cache_entry_t ** entry_p = lv_ll_ins_tail(acquired_ll_p);
+    LV_ASSERT_MALLOC(entry_p);
+    if(entry_p == NULL) {
+        lv_cache_release(layer_cache_p, entry, NULL);
+        return NULL;
+    }
+
+    *entry_p = entry;
+    layer_cache_data_t * data = lv_cache_entry_get_data(entry);
+    return data->buf;
+}
+
+#endif /*LV_OBJ_LAYER_CACHE_SIZE*/
@@ -0,0 +1,90 @@
+/**
+ * @file lv_obj_layer_cache_private.h
+ *
+ */
+
+#ifndef LV_OBJ_LAYER_CACHE_PRIVATE_H
+#define LV_OBJ_LAYER_CACHE_PRIVATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_obj.h"
+
+#if LV_OBJ_LAYER_CACHE_SIZE
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Create the cache of the retained layers
+ */
+void lv_obj_layer_cache_init(void);
+
+/**
+ * Free the cache of the retained layers
+ */
+void lv_obj_layer_cache_deinit(void);
+
+/**
+ * Get the retained layer of an object. If it's missing or outdated, the object is
+ * redrawn into a new buffer which is added to the cache.
+ * The returned buffer can be used until `lv_obj_layer_cache_release_all()`.
+ * @param obj       pointer to an object with retained layer
+ * @param area      the not transformed area of the object including the extended draw size
+ * @param opa       opacity inherited from the parents, it's already applied on the content
+ * @return          an ARGB8888 draw buffer with the size of `area` or NULL if
+ *                  the layer doesn't fit into the cache
+ */
+lv_draw_buf_t * lv_obj_layer_cache_get(lv_obj_t * obj, const lv_area_t * area, lv_opa_t opa);
+
+/**
+ * Release the layers returned by `lv_obj_layer_cache_get()`.
+ * Should be called when the draw tasks using them are finished.
+ */
+void lv_obj_layer_cache_release_all(void);
+
+/**
+ * Drop the retained layers of an object and of its parents as their content has changed.
+ * @param obj       pointer to an object
+ */
+void lv_obj_layer_cache_invalidate(const lv_obj_t * obj);
+
+/**
+ * Don't drop the layer of `obj` in `lv_obj_layer_cache_invalidate()`. Used when only the way
+ * the layer is blended changes. The layers of the parents are dropped as usual.
+ * @param obj       pointer to an object or NULL to drop the layers of all objects again
+ */
+void lv_obj_layer_cache_keep(const lv_obj_t * obj);
+
+/**
+ * Drop the retained layer of an object
+ * @param obj       pointer to an object
+ */
+void lv_obj_layer_cache_drop(const lv_obj_t * obj);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_OBJ_LAYER_CACHE_SIZE*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_OBJ_LAYER_CACHE_PRIVATE_H*/
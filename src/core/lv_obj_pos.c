@@ -12,6 +12,8 @@
 #include "lv_obj_draw_private.h"
 #include "lv_obj_style_private.h"
 #include "lv_obj_private.h"
+#include "lv_obj_hit_index_private.h"
+#include "lv_obj_layer_cache_private.h"
 #include "../display/lv_display.h"
 #include "../display/lv_display_private.h"
 #include "lv_refr_private.h"
@@ -33,6 +35,7 @@
 static int32_t calc_content_width(lv_obj_t * obj);
 static int32_t calc_content_height(lv_obj_t * obj);
 static void layout_update_core(lv_obj_t * obj);
+static void mark_ancestors(lv_obj_t * obj);
 static void transform_point_array(const lv_obj_t * obj, lv_point_t * p, size_t p_count, bool inv);
 static bool is_transformed(const lv_obj_t * obj);
 
@@ -188,6 +191,7 @@ bool lv_obj_refr_size(lv_obj_t * obj)
     else {
         obj->coords.x2 = obj->coords.x1 + w - 1;
     }
+    lv_obj_hit_index_invalidate(parent);
 
     /*Call the ancestor's event handler to the object with its new coordinates*/
     lv_obj_send_event(obj, LV_EVENT_SIZE_CHANGED, &ori);
@@ -199,6 +203,7 @@ bool lv_obj_refr_size(lv_obj_t * obj)
     lv_obj_invalidate(obj);
 
     obj->readjust_scroll_after_layout = 1;
+    mark_ancestors(obj);
 
     /*If the object was out of the parent invalidate the new scrollbar area too.
      *If it wasn't out of the parent but out now, also invalidate the scrollbars*/
@@ -283,6 +288,9 @@ void lv_obj_mark_layout_as_dirty(lv_obj_t * obj)
 {
     obj->layout_inv = 1;
 
+    /*Mark the ancestors so that the layout update can skip the subtrees without changes*/
+    mark_ancestors(obj);
+
     /*Mark the screen as dirty too to mark that there is something to do on this screen*/
     lv_obj_t * scr = lv_obj_get_screen(obj);
     scr->scr_layout_inv = 1;
@@ -745,6 +753,7 @@ void lv_obj_move_to(lv_obj_t * obj, int32_t x, int32_t y)
     obj->coords.y1 += diff.y;
     obj->coords.x2 += diff.x;
     obj->coords.y2 += diff.y;
+    lv_obj_hit_index_invalidate(parent);
 
     lv_obj_move_children_by(obj, diff.x, diff.y, false);
 
@@ -823,6 +832,11 @@ void lv_obj_invalidate_area(const lv_obj_t * obj, const lv_area_t * area)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+#if LV_OBJ_LAYER_CACHE_SIZE
+    /*The content has changed even if it's not visible now*/
+    lv_obj_layer_cache_invalidate(obj);
+#endif
+
     lv_display_t * disp   = lv_obj_get_display(obj);
     if(!lv_display_is_invalidation_enabled(disp)) return;
 
@@ -939,6 +953,7 @@ void lv_obj_set_ext_click_area(lv_obj_t * obj, int32_t size)
 
     lv_obj_allocate_spec_attr(obj);
     obj->spec_attr->ext_click_pad = size;
+    lv_obj_hit_index_invalidate(lv_obj_get_parent(obj));
 }
 
 void lv_obj_get_click_area(const lv_obj_t * obj, lv_area_t * area)
@@ -1228,9 +1243,12 @@ static void layout_update_core(lv_obj_t * obj)
 {
     uint32_t i;
     uint32_t child_cnt = lv_obj_get_child_count(obj);
-    for(i = 0; i < child_cnt; i++) {
-        lv_obj_t * child = obj->spec_attr->children[i];
-        layout_update_core(child);
+    if(obj->child_layout_inv) {
+        obj->child_layout_inv = 0;
+        for(i = 0; i < child_cnt; i++) {
+            lv_obj_t * child = obj->spec_attr->children[i];
+            layout_update_core(child);
+        }
     }
 
     if(obj->layout_inv) {
@@ -1240,6 +1258,8 @@ static void layout_update_core(lv_obj_t * obj)
 
         if(child_cnt > 0) {
             lv_layout_apply(obj);
+            /*The layouts can move the children directly*/
+            lv_obj_hit_index_invalidate(obj);
         }
     }
 
@@ -1249,6 +1269,19 @@ static void layout_update_core(lv_obj_t * obj)
     }
 }
 
+/**
+ * Tell the ancestors of an object that something needs to be done in their subtree during the next layout update
+ * @param obj   pointer to an object
+ */
+static void mark_ancestors(lv_obj_t * obj)
+{
+    lv_obj_t * parent = obj->parent;
+    while(parent && !parent->child_layout_inv) {
+        parent->child_layout_inv = 1;
+        parent = parent->parent;
+    }
+}
+
 static void transform_point_array(const lv_obj_t * obj, lv_point_t * p, size_t p_count, bool inv)
 {
 #if LV_DRAW_TRANSFORM_USE_MATRIX
@@ -35,6 +35,12 @@ struct _lv_obj_spec_attr_t {
     lv_matrix_t * matrix;           /**< The transform matrix*/
 #endif
     lv_event_list_t event_list;
+#if LV_OBJ_HIT_INDEX_MIN_CHILD_CNT
+    lv_obj_hit_index_t * hit_index; /**< Spatial index of the children for hit testing*/
+#endif
+#if LV_LAYOUT_CACHE_MIN_CHILD_CNT
+    lv_layout_cache_t * layout_cache;   /**< Measurements of the children from the last layout update*/
+#endif
 
     lv_point_t scroll;              /**< The current X/Y scroll offset*/
 
@@ -47,6 +53,7 @@ struct _lv_obj_spec_attr_t {
     uint16_t scroll_snap_y : 2;     /**< Where to align the snappable children vertically*/
     uint16_t scroll_dir : 4;        /**< The allowed scroll direction(s), see `lv_dir_t`*/
     uint16_t layer_type : 2;        /**< Cache the layer type here. Element of lv_intermediate_layer_type_t */
+    uint16_t layer_retained : 1;    /**< Keep the content of the layer in the layer cache*/
 };
 
 struct _lv_obj_t {
@@ -57,6 +64,9 @@ struct _lv_obj_t {
 #if LV_OBJ_STYLE_CACHE
     uint32_t style_main_prop_is_set;
     uint32_t style_other_prop_is_set;
+#if LV_OBJ_STYLE_VALUE_CACHE_CNT
+    lv_obj_style_value_cache_entry_t * style_value_cache;   /**< Allocated on the first style property read*/
+#endif
 #endif
     void * user_data;
 #if LV_USE_OBJ_ID
@@ -66,6 +76,7 @@ struct _lv_obj_t {
     lv_obj_flag_t flags;
     lv_state_t state;
     uint16_t layout_inv : 1;
+    uint16_t child_layout_inv : 1;  /**< The layout of a descendant needs to be updated*/
     uint16_t readjust_scroll_after_layout : 1;
     uint16_t scr_layout_inv : 1;
     uint16_t skip_trans : 1;
@@ -7,6 +7,10 @@
  *      INCLUDES
  *********************/
 #include "lv_obj_private.h"
+#include "lv_obj_hit_index_private.h"
+#include "lv_obj_layer_cache_private.h"
+#include "../layouts/lv_layout_private.h"
+#include "lv_obj_draw_private.h"
 #include "../misc/lv_anim_private.h"
 #include "lv_obj_style_private.h"
 #include "lv_obj_class_private.h"
@@ -23,6 +27,7 @@
 #define style_trans_ll_p &(LV_GLOBAL_DEFAULT()->style_trans_ll)
 #define _style_custom_prop_flag_lookup_table LV_GLOBAL_DEFAULT()->style_custom_prop_flag_lookup_table
 #define STYLE_PROP_SHIFTED(prop) ((uint32_t)1 << ((prop) >> 3))
+#define STYLE_VALUE_CACHE   (LV_OBJ_STYLE_CACHE && LV_OBJ_STYLE_VALUE_CACHE_CNT)
 
 /**********************
  *      TYPEDEFS
@@ -55,6 +60,9 @@ static lv_style_t * get_local_style(lv_obj_t * obj, lv_style_selector_t selector
 static lv_obj_style_t * get_trans_style(lv_obj_t * obj, lv_part_t part);
 static lv_style_res_t get_prop_core(const lv_obj_t * obj, lv_style_selector_t selector, lv_style_prop_t prop,
                                     lv_style_value_t * v);
+static lv_style_res_t get_prop_cached(const lv_obj_t * obj, lv_style_selector_t selector, lv_style_prop_t prop,
+                                      lv_style_value_t * v);
+static void value_cache_invalidate(lv_obj_t * obj);
 static void report_style_change_core(void * style, lv_obj_t * obj);
 static void refresh_children_style(lv_obj_t * obj);
 static bool trans_delete(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, trans_t * tr_limit);
@@ -276,12 +284,15 @@ void lv_obj_refresh_style(lv_obj_t * obj, lv_style_selector_t selector, lv_style
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+    /*The styles might have changed even if the refresh is disabled*/
+    value_cache_invalidate(obj);
+    lv_layout_cache_invalidate(obj);
+    lv_layout_cache_invalidate(lv_obj_get_parent(obj));
+
     if(!style_refr) return;
 
     LV_PROFILER_STYLE_BEGIN;
 
-    lv_obj_invalidate(obj);
-
     lv_part_t part = lv_obj_style_get_selector_part(selector);
 
     bool is_layout_refr = lv_style_prop_has_flag(prop, LV_STYLE_PROP_FLAG_LAYOUT_UPDATE);
@@ -289,6 +300,14 @@ void lv_obj_refresh_style(lv_obj_t * obj, lv_style_selector_t selector, lv_style
     bool is_inheritable = lv_style_prop_has_flag(prop, LV_STYLE_PROP_FLAG_INHERITABLE);
     bool is_layer_refr = lv_style_prop_has_flag(prop, LV_STYLE_PROP_FLAG_LAYER_UPDATE);
 
+#if LV_OBJ_LAYER_CACHE_SIZE
+    /*These properties change only how the layer is blended, not its content*/
+    bool keep_layer = prop != LV_STYLE_PROP_ANY && is_layer_refr && (part == LV_PART_ANY || part == LV_PART_MAIN);
+    if(keep_layer) lv_obj_layer_cache_keep(obj);
+#endif
+
+    lv_obj_invalidate(obj);
+
     if(is_layout_refr) {
         if(part == LV_PART_ANY ||
            part == LV_PART_MAIN ||
@@ -313,6 +332,10 @@ void lv_obj_refresh_style(lv_obj_t * obj, lv_style_selector_t selector, lv_style
     }
     lv_obj_invalidate(obj);
 
+#if LV_OBJ_LAYER_CACHE_SIZE
+    if(keep_layer) lv_obj_layer_cache_keep(NULL);
+#endif
+
     if(prop == LV_STYLE_PROP_ANY || (is_inheritable && (is_ext_draw || is_layout_refr))) {
         if(part != LV_PART_SCROLLBAR) {
             refresh_children_style(obj);
@@ -633,6 +656,11 @@ lv_opa_t lv_obj_get_style_opa_recursive(const lv_obj_t * obj, lv_part_t part)
 void lv_obj_update_layer_type(lv_obj_t * obj)
 {
     lv_layer_type_t layer_type = calculate_layer_type(obj);
+    if(lv_obj_get_layer_type(obj) != layer_type) {
+        /*Transformed children are handled differently by the hit index*/
+        lv_obj_hit_index_invalidate(lv_obj_get_parent(obj));
+    }
+
     if(obj->spec_attr) obj->spec_attr->layer_type = layer_type;
     else if(layer_type != LV_LAYER_TYPE_NONE) {
         lv_obj_allocate_spec_attr(obj);
@@ -770,6 +798,65 @@ static lv_style_res_t get_prop_core(const lv_obj_t * obj, lv_style_selector_t se
     else return LV_STYLE_RES_NOT_FOUND;
 }
 
+/**
+ * Get a property from the styles of an object using the resolved value cache.
+ * Both the found and not found results are cached.
+ * @param obj       pointer to an object
+ * @param selector  part and state of the object to use
+ * @param prop      the property to get
+ * @param v         store the value here if found
+ * @return          LV_STYLE_RES_FOUND or LV_STYLE_RES_NOT_FOUND
+ */
+static lv_style_res_t get_prop_cached(const lv_obj_t * obj, lv_style_selector_t selector, lv_style_prop_t prop,
+                                      lv_style_value_t * v)
+{
+#if STYLE_VALUE_CACHE
+    /*Transitions are skipped only temporarily, don't cache these results*/
+    if(obj->skip_trans) return get_prop_core(obj, selector, prop, v);
+
+    /*The cache is not part of the object's state, so it can be filled via a const pointer too*/
+    lv_obj_t * obj_mut = (lv_obj_t *)obj;
+    if(obj_mut->style_value_cache == NULL) {
+        obj_mut->style_value_cache = lv_malloc_zeroed(LV_OBJ_STYLE_VALUE_CACHE_CNT * sizeof(lv_obj_style_value_cache_entry_t));
+        if(obj_mut->style_value_cache == NULL) return get_prop_core(obj, selector, prop, v);
+    }
+
+    uint32_t hash = prop + (lv_obj_style_get_selector_part(selector) >> 16) * 31 +
+                    lv_obj_style_get_selector_state(selector) * 7;
+    lv_obj_style_value_cache_entry_t * entry = &obj_mut->style_value_cache[hash % LV_OBJ_STYLE_VALUE_CACHE_CNT];
+    if(entry->prop == prop && entry->selector == selector) {
+        if(entry->res == LV_STYLE_RES_FOUND) *v = entry->value;
+        return entry->res;
+    }
+
+    lv_style_res_t res = get_prop_core(obj, selector, prop, v);
+    entry->prop = prop;
+    entry->selector = selector;
+    entry->res = res;
+    if(res == LV_STYLE_RES_FOUND) entry->value = *v;
+
+    return res;
+#else
+    return get_prop_core(obj, selector, prop, v);
+#endif
+}
+
+/**
+ * Drop all the cached style values of an object. Should be called whenever
+ * the styles of the object or the content of the used styles change.
+ * @param obj       pointer to an object
+ */
+static void value_cache_invalidate(lv_obj_t * obj)
+{
+#if STYLE_VALUE_CACHE
+    if(obj->style_value_cache) {
+        lv_memzero(obj->style_value_cache, LV_OBJ_STYLE_VALUE_CACHE_CNT * sizeof(lv_obj_style_value_cache_entry_t));
+    }
+#else
+    LV_UNUSED(obj);
+#endif
+}
+
 /**
  * Refresh the style of all children of an object. (Called recursively)
  * @param style refresh objects only with this
@@ -842,6 +929,8 @@ static bool trans_delete(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop, t
                 }
             }
 
+            value_cache_invalidate(obj);
+
             /*Free the transition descriptor too*/
             lv_anim_delete(tr, NULL);
             lv_ll_remove(style_trans_ll_p, tr);
@@ -968,6 +1057,7 @@ static void trans_anim_completed_cb(lv_anim_t * a)
 
                 lv_obj_style_t * obj_style = &obj->styles[i];
                 lv_style_remove_prop((lv_style_t *)obj_style->style, prop);
+                value_cache_invalidate(obj);
 
                 if(lv_style_is_empty(obj->styles[i].style)) {
                     lv_obj_remove_style(obj, (lv_style_t *)obj_style->style, obj_style->selector);
@@ -1090,7 +1180,7 @@ static lv_style_res_t get_selector_style_prop(const lv_obj_t * obj, lv_style_sel
     if((part == LV_PART_MAIN ? obj->style_main_prop_is_set : obj->style_other_prop_is_set) & prop_shifted)
 #endif
     {
-        found = get_prop_core(obj, selector, prop, value_act);
+        found = get_prop_cached(obj, selector, prop, value_act);
         if(found == LV_STYLE_RES_FOUND) return LV_STYLE_RES_FOUND;
     }
 
@@ -1117,7 +1207,7 @@ static lv_style_res_t get_selector_style_prop(const lv_obj_t * obj, lv_style_sel
 #endif
             {
                 selector = part | obj->state;
-                found = get_prop_core(obj, selector, prop, value_act);
+                found = get_prop_cached(obj, selector, prop, value_act);
                 if(found == LV_STYLE_RES_FOUND) return LV_STYLE_RES_FOUND;
             }
             /*Check the parent too.*/
@@ -31,6 +31,14 @@ struct _lv_obj_style_t {
     uint32_t is_trans : 1;
 };
 
+/** A resolved style property of an object's part in a given state */
+struct _lv_obj_style_value_cache_entry_t {
+    lv_style_value_t value;
+    uint32_t selector : 24;     /**< Part and state, or 0 if the entry is unused*/
+    uint32_t res : 8;           /**< `lv_style_res_t` of the lookup*/
+    lv_style_prop_t prop;       /**< `LV_STYLE_PROP_INV` if the entry is unused*/
+};
+
 struct _lv_obj_style_transition_dsc_t {
     uint16_t time;
     uint16_t delay;
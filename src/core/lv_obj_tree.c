@@ -8,6 +8,7 @@
  *********************/
 #include "lv_obj_private.h"
 #include "lv_obj_class_private.h"
+#include "lv_obj_hit_index_private.h"
 #include "../indev/lv_indev.h"
 #include "../indev/lv_indev_private.h"
 #include "../display/lv_display.h"
@@ -187,6 +188,9 @@ void lv_obj_set_parent(lv_obj_t * obj, lv_obj_t * parent)
 
     obj->parent = parent;
 
+    lv_obj_hit_index_invalidate(old_parent);
+    lv_obj_hit_index_invalidate(parent);
+
     /*Notify the original parent because one of its children is lost*/
     lv_obj_scrollbar_invalidate(old_parent);
     lv_obj_send_event(old_parent, LV_EVENT_CHILD_CHANGED, obj);
@@ -246,6 +250,7 @@ void lv_obj_move_to_index(lv_obj_t * obj, int32_t index)
     }
 
     parent->spec_attr->children[index] = obj;
+    lv_obj_hit_index_invalidate(parent);
     lv_obj_send_event(parent, LV_EVENT_CHILD_CHANGED, NULL);
     lv_obj_invalidate(parent);
 }
@@ -270,6 +275,9 @@ void lv_obj_swap(lv_obj_t * obj1, lv_obj_t * obj2)
     parent2->spec_attr->children[index2] = obj1;
     obj1->parent = parent2;
 
+    lv_obj_hit_index_invalidate(parent);
+    lv_obj_hit_index_invalidate(parent2);
+
     lv_obj_send_event(parent, LV_EVENT_CHILD_CHANGED, obj2);
     lv_obj_send_event(parent, LV_EVENT_CHILD_CREATED, obj2);
     lv_obj_send_event(parent2, LV_EVENT_CHILD_CHANGED, obj1);
@@ -584,6 +592,7 @@ static void obj_delete_core(lv_obj_t * obj)
         obj->parent->spec_attr->child_cnt--;
         obj->parent->spec_attr->children = lv_realloc(obj->parent->spec_attr->children,
                                                       obj->parent->spec_attr->child_cnt * sizeof(lv_obj_t *));
+        lv_obj_hit_index_invalidate(obj->parent);
     }
 
     /*Free the object itself*/
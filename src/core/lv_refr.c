@@ -8,6 +8,7 @@
  *********************/
 #include "lv_refr_private.h"
 #include "lv_obj_draw_private.h"
+#include "lv_obj_layer_cache_private.h"
 #include "../misc/lv_area_private.h"
 #include "../draw/sw/lv_draw_sw_mask_private.h"
 #include "../draw/lv_draw_mask_private.h"
@@ -281,6 +282,7 @@ void lv_inv_area(lv_display_t * disp, const lv_area_t * area_p)
     /*Clear the invalidate buffer if the parameter is NULL*/
     if(area_p == NULL) {
         disp->inv_p = 0;
+        disp->inv_px_cnt = 0;
         return;
     }
 
@@ -305,6 +307,7 @@ void lv_inv_area(lv_display_t * disp, const lv_area_t * area_p)
 
     /*If there were at least 1 invalid area in full refresh mode, redraw the whole screen*/
     if(disp->render_mode == LV_DISPLAY_RENDER_MODE_FULL) {
+        disp->inv_px_cnt += lv_area_get_size(&com_area);
         disp->inv_areas[0] = scr_area;
         disp->inv_p = 1;
         lv_display_send_event(disp, LV_EVENT_REFR_REQUEST, NULL);
@@ -320,14 +323,28 @@ void lv_inv_area(lv_display_t * disp, const lv_area_t * area_p)
         if(lv_area_is_in(&com_area, &disp->inv_areas[i], 0) != false) return;
     }
 
+    disp->inv_px_cnt += lv_area_get_size(&com_area);
+
     /*Save the area*/
-    lv_area_t * tmp_area_p = &com_area;
-    if(disp->inv_p >= LV_INV_BUF_SIZE) { /*If no place for the area add the screen*/
-        disp->inv_p = 0;
-        tmp_area_p = &scr_area;
+    if(disp->inv_p < LV_INV_BUF_SIZE) {
+        lv_area_copy(&disp->inv_areas[disp->inv_p], &com_area);
+        disp->inv_p++;
+    }
+    else {
+        /*If there is no place for the area join it to the saved area where it causes the least overdraw*/
+        uint32_t best_i = 0;
+        uint32_t best_cost = UINT32_MAX;
+        for(i = 0; i < disp->inv_p; i++) {
+            lv_area_t joined_area;
+            lv_area_join(&joined_area, &com_area, &disp->inv_areas[i]);
+            uint32_t cost = lv_area_get_size(&joined_area) - lv_area_get_size(&disp->inv_areas[i]);
+            if(cost < best_cost) {
+                best_cost = cost;
+                best_i = i;
+            }
+        }
+        lv_area_join(&disp->inv_areas[best_i], &com_area, &disp->inv_areas[best_i]);
     }
-    lv_area_copy(&disp->inv_areas[disp->inv_p], tmp_area_p);
-    disp->inv_p++;
 
     lv_display_send_event(disp, LV_EVENT_REFR_REQUEST, NULL);
 }
@@ -402,6 +419,10 @@ void lv_display_refr_timer(lv_timer_t * tmr)
 
     lv_refr_join_area();
     refr_sync_areas();
+
+    disp_refr->inv_px_last = disp_refr->inv_px_cnt;
+    disp_refr->inv_px_cnt = 0;
+    disp_refr->refr_px_last = 0;
     refr_invalid_areas();
 
     if(disp_refr->inv_p == 0) goto refr_finish;
@@ -439,7 +460,9 @@ refr_finish:
  **********************/
 
 /**
- * Join the areas which has got common parts
+ * Join the areas where redrawing the bounding box is cheaper than redrawing them separately.
+ * Repeat it until no more areas can be joined as a grown area might be worth joining with an
+ * area which was already checked.
  */
 static void lv_refr_join_area(void)
 {
@@ -447,33 +470,41 @@ static void lv_refr_join_area(void)
     uint32_t join_from;
     uint32_t join_in;
     lv_area_t joined_area;
-    for(join_in = 0; join_in < disp_refr->inv_p; join_in++) {
-        if(disp_refr->inv_area_joined[join_in] != 0) continue;
-
-        /*Check all areas to join them in 'join_in'*/
-        for(join_from = 0; join_from < disp_refr->inv_p; join_from++) {
-            /*Handle only unjoined areas and ignore itself*/
-            if(disp_refr->inv_area_joined[join_from] != 0 || join_in == join_from) {
-                continue;
-            }
+    bool joined;
+    do {
+        joined = false;
+        for(join_in = 0; join_in < disp_refr->inv_p; join_in++) {
+            if(disp_refr->inv_area_joined[join_in] != 0) continue;
+
+            /*Check all areas to join them in 'join_in'*/
+            for(join_from = 0; join_from < disp_refr->inv_p; join_from++) {
+                /*Handle only unjoined areas and ignore itself*/
+                if(disp_refr->inv_area_joined[join_from] != 0 || join_in == join_from) {
+                    continue;
+                }
 
-            /*Check if the areas are on each other*/
-            if(lv_area_is_on(&disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]) == false) {
-                continue;
-            }
+#if LV_INV_AREA_OVERHEAD == 0
+                /*Check if the areas are on each other. Else their bounding box can't be smaller.*/
+                if(lv_area_is_on(&disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]) == false) {
+                    continue;
+                }
+#endif
 
-            lv_area_join(&joined_area, &disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]);
+                lv_area_join(&joined_area, &disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]);
 
-            /*Join two area only if the joined area size is smaller*/
-            if(lv_area_get_size(&joined_area) < (lv_area_get_size(&disp_refr->inv_areas[join_in]) +
-                                                 lv_area_get_size(&disp_refr->inv_areas[join_from]))) {
-                lv_area_copy(&disp_refr->inv_areas[join_in], &joined_area);
+                /*Join two area only if redrawing the joined area is cheaper than redrawing them separately*/
+                if(lv_area_get_size(&joined_area) < (lv_area_get_size(&disp_refr->inv_areas[join_in]) +
+                                                     lv_area_get_size(&disp_refr->inv_areas[join_from]) +
+                                                     LV_INV_AREA_OVERHEAD)) {
+                    lv_area_copy(&disp_refr->inv_areas[join_in], &joined_area);
 
-                /*Mark 'join_form' is joined into 'join_in'*/
-                disp_refr->inv_area_joined[join_from] = 1;
+                    /*Mark 'join_form' is joined into 'join_in'*/
+                    disp_refr->inv_area_joined[join_from] = 1;
+                    joined = true;
+                }
             }
         }
-    }
+    } while(joined);
     LV_PROFILER_REFR_END;
 }
 
@@ -588,6 +619,7 @@ static void refr_invalid_areas(void)
         disp_refr->last_part = 0;
 
         lv_area_t inv_a = disp_refr->inv_areas[i];
+        disp_refr->refr_px_last += lv_area_get_size(&inv_a);
         if(disp_refr->render_mode == LV_DISPLAY_RENDER_MODE_PARTIAL) {
             /*Calculate the max row num*/
             int32_t w = lv_area_get_width(&inv_a);
@@ -629,6 +661,11 @@ static void refr_invalid_areas(void)
         }
     }
 
+#if LV_OBJ_LAYER_CACHE_SIZE
+    /*The draw tasks blending the retained layers are finished*/
+    lv_obj_layer_cache_release_all();
+#endif
+
     lv_display_send_event(disp_refr, LV_EVENT_RENDER_READY, NULL);
     disp_refr->rendering_in_progress = false;
     LV_PROFILER_REFR_END;
@@ -1095,6 +1132,69 @@ static bool refr_check_obj_clip_overflow(lv_layer_t * layer, lv_obj_t * obj)
 
 #endif /* LV_DRAW_TRANSFORM_USE_MATRIX */
 
+static void layer_draw_dsc_init(lv_obj_t * obj, lv_draw_image_dsc_t * dsc, const lv_area_t * buf_area,
+                                const lv_area_t * obj_draw_size, lv_opa_t opa_layered)
+{
+    lv_point_t pivot = {
+        .x = lv_obj_get_style_transform_pivot_x(obj, 0),
+        .y = lv_obj_get_style_transform_pivot_y(obj, 0)
+    };
+
+    if(LV_COORD_IS_PCT(pivot.x)) {
+        pivot.x = (LV_COORD_GET_PCT(pivot.x) * lv_area_get_width(&obj->coords)) / 100;
+    }
+    if(LV_COORD_IS_PCT(pivot.y)) {
+        pivot.y = (LV_COORD_GET_PCT(pivot.y) * lv_area_get_height(&obj->coords)) / 100;
+    }
+
+    lv_draw_image_dsc_init(dsc);
+    dsc->pivot.x = obj->coords.x1 + pivot.x - buf_area->x1;
+    dsc->pivot.y = obj->coords.y1 + pivot.y - buf_area->y1;
+
+    dsc->opa = opa_layered;
+    dsc->rotation = lv_obj_get_style_transform_rotation(obj, 0);
+    while(dsc->rotation > 3600) dsc->rotation -= 3600;
+    while(dsc->rotation < 0) dsc->rotation += 3600;
+    dsc->scale_x = lv_obj_get_style_transform_scale_x(obj, 0);
+    dsc->scale_y = lv_obj_get_style_transform_scale_y(obj, 0);
+    dsc->skew_x = lv_obj_get_style_transform_skew_x(obj, 0);
+    dsc->skew_y = lv_obj_get_style_transform_skew_y(obj, 0);
+    dsc->blend_mode = lv_obj_get_style_blend_mode(obj, 0);
+    dsc->antialias = disp_refr->antialiasing;
+    dsc->image_area = *obj_draw_size;
+}
+
+#if LV_OBJ_LAYER_CACHE_SIZE
+
+/**
+ * Blend the retained layer of an object. The layer is drawn only if it's not cached yet.
+ * @return      false: the object doesn't have a usable retained layer, draw it in the normal way
+ */
+static bool refr_obj_retained(lv_layer_t * layer, lv_obj_t * obj, lv_opa_t opa_layered)
+{
+    if(!lv_obj_get_layer_retained(obj)) return false;
+
+    /*The bitmap mask is applied on the layer's buffer, so it would modify the retained content*/
+    if(lv_obj_get_style_bitmap_mask_src(obj, 0)) return false;
+
+    lv_area_t obj_draw_size;
+    int32_t ext_draw_size = lv_obj_get_ext_draw_size(obj);
+    lv_obj_get_coords(obj, &obj_draw_size);
+    lv_area_increase(&obj_draw_size, ext_draw_size, ext_draw_size);
+
+    lv_draw_buf_t * buf = lv_obj_layer_cache_get(obj, &obj_draw_size, layer->opa);
+    if(buf == NULL) return false;
+
+    lv_draw_image_dsc_t layer_draw_dsc;
+    layer_draw_dsc_init(obj, &layer_draw_dsc, &obj_draw_size, &obj_draw_size, opa_layered);
+    layer_draw_dsc.src = buf;
+    lv_draw_image(layer, &layer_draw_dsc, &obj_draw_size);
+
+    return true;
+}
+
+#endif /* LV_OBJ_LAYER_CACHE_SIZE */
+
 static void refr_obj(lv_layer_t * layer, lv_obj_t * obj)
 {
     if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return;
@@ -1115,6 +1215,11 @@ static void refr_obj(lv_layer_t * layer, lv_obj_t * obj)
     if(layer_type == LV_LAYER_TYPE_NONE) {
         lv_obj_redraw(layer, obj);
     }
+#if LV_OBJ_LAYER_CACHE_SIZE
+    else if(refr_obj_retained(layer, obj, opa_layered)) {
+        /*Blended from the retained layer*/
+    }
+#endif /* LV_OBJ_LAYER_CACHE_SIZE */
 #if LV_DRAW_TRANSFORM_USE_MATRIX
     /*If the layer opa is full then use the matrix transform*/
     else if(opa_layered >= LV_OPA_MAX && !refr_check_obj_clip_overflow(layer, obj)) {
@@ -1161,35 +1266,9 @@ static void refr_obj(lv_layer_t * layer, lv_obj_t * obj)
                                                           area_need_alpha ? LV_COLOR_FORMAT_ARGB8888 : LV_COLOR_FORMAT_NATIVE, &layer_area_act);
             lv_obj_redraw(new_layer, obj);
 
-            lv_point_t pivot = {
-                .x = lv_obj_get_style_transform_pivot_x(obj, 0),
-                .y = lv_obj_get_style_transform_pivot_y(obj, 0)
-            };
-
-            if(LV_COORD_IS_PCT(pivot.x)) {
-                pivot.x = (LV_COORD_GET_PCT(pivot.x) * lv_area_get_width(&obj->coords)) / 100;
-            }
-            if(LV_COORD_IS_PCT(pivot.y)) {
-                pivot.y = (LV_COORD_GET_PCT(pivot.y) * lv_area_get_height(&obj->coords)) / 100;
-            }
-
             lv_draw_image_dsc_t layer_draw_dsc;
-            lv_draw_image_dsc_init(&layer_draw_dsc);
-            layer_draw_dsc.pivot.x = obj->coords.x1 + pivot.x - new_layer->buf_area.x1;
-            layer_draw_dsc.pivot.y = obj->coords.y1 + pivot.y - new_layer->buf_area.y1;
-
-            layer_draw_dsc.opa = opa_layered;
-            layer_draw_dsc.rotation = lv_obj_get_style_transform_rotation(obj, 0);
-            while(layer_draw_dsc.rotation > 3600) layer_draw_dsc.rotation -= 3600;
-            while(layer_draw_dsc.rotation < 0) layer_draw_dsc.rotation += 3600;
-            layer_draw_dsc.scale_x = lv_obj_get_style_transform_scale_x(obj, 0);
-            layer_draw_dsc.scale_y = lv_obj_get_style_transform_scale_y(obj, 0);
-            layer_draw_dsc.skew_x = lv_obj_get_style_transform_skew_x(obj, 0);
-            layer_draw_dsc.skew_y = lv_obj_get_style_transform_skew_y(obj, 0);
-            layer_draw_dsc.blend_mode = lv_obj_get_style_blend_mode(obj, 0);
-            layer_draw_dsc.antialias = disp_refr->antialiasing;
+            layer_draw_dsc_init(obj, &layer_draw_dsc, &new_layer->buf_area, &obj_draw_size, opa_layered);
             layer_draw_dsc.bitmap_mask_src = bitmap_mask_src;
-            layer_draw_dsc.image_area = obj_draw_size;
             layer_draw_dsc.src = new_layer;
 
             lv_draw_layer(layer, &layer_draw_dsc, &layer_area_act);
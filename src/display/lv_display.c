@@ -1063,6 +1063,22 @@ uint32_t lv_display_get_invalidated_draw_buf_size(lv_display_t * disp, uint32_t
     return buf_size;
 }
 
+uint32_t lv_display_get_invalidated_px_count(lv_display_t * disp)
+{
+    if(!disp) disp = lv_display_get_default();
+    if(!disp) return 0;
+
+    return disp->inv_px_last;
+}
+
+uint32_t lv_display_get_refreshed_px_count(lv_display_t * disp)
+{
+    if(!disp) disp = lv_display_get_default();
+    if(!disp) return 0;
+
+    return disp->refr_px_last;
+}
+
 lv_obj_t * lv_screen_active(void)
 {
     return lv_display_get_screen_active(lv_display_get_default());
@@ -587,6 +587,22 @@ uint32_t lv_display_get_draw_buf_size(lv_display_t * disp);
  */
 uint32_t lv_display_get_invalidated_draw_buf_size(lv_display_t * disp, uint32_t width, uint32_t height);
 
+/**
+ * Get the sum of the size of the areas invalidated before the last refresh.
+ * Overlapping areas are counted as many times as they were invalidated.
+ * @param disp      pointer to a display
+ * @return          the number of invalidated pixels
+ */
+uint32_t lv_display_get_invalidated_px_count(lv_display_t * disp);
+
+/**
+ * Get the number of pixels redrawn in the last refresh. Compared to
+ * `lv_display_get_invalidated_px_count()` it shows the overdraw caused by joining the areas.
+ * @param disp      pointer to a display
+ * @return          the number of redrawn pixels
+ */
+uint32_t lv_display_get_refreshed_px_count(lv_display_t * disp);
+
 /**********************
  *      MACROS
  **********************/
@@ -105,6 +105,10 @@ struct _lv_display_t {
     uint32_t inv_p;
     int32_t inv_en_cnt;
 
+    uint32_t inv_px_cnt;    /**< Sum of the size of the areas invalidated since the last refresh*/
+    uint32_t inv_px_last;   /**< Sum of the size of the areas invalidated before the last refresh*/
+    uint32_t refr_px_last;  /**< Number of pixels redrawn in the last refresh*/
+
     /** Double buffer sync areas (redrawn during last refresh) */
     lv_ll_t sync_areas;
 
@@ -24,15 +24,36 @@
  *********************/
 #define _draw_info LV_GLOBAL_DEFAULT()->draw_info
 
+/*Resolution of the tile map used to find independent draw tasks*/
+#define DEP_MAP_COLS    64
+#define DEP_MAP_ROWS    64
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+/**
+ * Coarse occupancy bitmap of a layer. Each bit marks a tile which is touched by
+ * an unfinished draw task. Used to find independent draw tasks in linear time.
+ */
+typedef struct {
+    uint64_t rows[DEP_MAP_ROWS];
+    int32_t x_ofs;
+    int32_t y_ofs;
+    int32_t tile_w;
+    int32_t tile_h;
+} dep_map_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
-static bool is_independent(lv_layer_t * layer, lv_draw_task_t * t_check);
+static void dep_map_init(dep_map_t * map, const lv_layer_t * layer);
+static bool dep_map_get_tiles(const dep_map_t * map, const lv_area_t * area, uint64_t * mask, int32_t * row_start,
+                              int32_t * row_end);
+static bool dep_map_check_and_set(dep_map_t * map, const lv_area_t * area, bool check);
 static void lv_cleanup_task(lv_draw_task_t * t, lv_display_t * disp);
+static lv_draw_task_t * task_alloc(void);
+static void task_free(lv_draw_task_t * t);
 
 #if LV_LOG_LEVEL <= LV_LOG_LEVEL_INFO
 static inline uint32_t get_layer_size_kb(uint32_t size_byte)
@@ -58,6 +79,13 @@ void lv_draw_init(void)
 #if LV_USE_OS
     lv_thread_sync_init(&_draw_info.sync);
 #endif
+
+#if LV_DRAW_TASK_ARENA_SIZE
+    _draw_info.task_arena = lv_malloc(LV_DRAW_TASK_ARENA_SIZE);
+    LV_ASSERT_MALLOC(_draw_info.task_arena);
+    _draw_info.task_arena_used = 0;
+    _draw_info.task_arena_live = 0;
+#endif
 }
 
 void lv_draw_deinit(void)
@@ -75,6 +103,11 @@ void lv_draw_deinit(void)
         lv_free(cur_unit);
     }
     _draw_info.unit_head = NULL;
+
+#if LV_DRAW_TASK_ARENA_SIZE
+    lv_free(_draw_info.task_arena);
+    _draw_info.task_arena = NULL;
+#endif
 }
 
 void * lv_draw_create_unit(size_t size)
@@ -94,7 +127,7 @@ void * lv_draw_create_unit(size_t size)
 lv_draw_task_t * lv_draw_add_task(lv_layer_t * layer, const lv_area_t * coords)
 {
     LV_PROFILER_DRAW_BEGIN;
-    lv_draw_task_t * new_task = lv_malloc_zeroed(sizeof(lv_draw_task_t));
+    lv_draw_task_t * new_task = task_alloc();
     LV_ASSERT_MALLOC(new_task);
     new_task->area = *coords;
     new_task->_real_area = *coords;
@@ -243,6 +276,11 @@ bool lv_draw_dispatch_layer(lv_display_t * disp, lv_layer_t * layer)
         t = t_next;
     }
 
+#if LV_DRAW_TASK_ARENA_SIZE
+    /*All the tasks of the arena are freed so it can be reused from the beginning*/
+    if(_draw_info.task_arena_live == 0) _draw_info.task_arena_used = 0;
+#endif
+
     bool task_dispatched = false;
 
     /*This layer is ready, enable blending its buffer*/
@@ -354,14 +392,28 @@ lv_draw_task_t * lv_draw_get_next_available_task(lv_layer_t * layer, lv_draw_tas
         }
     }
 
-    lv_draw_task_t * t = t_prev ? t_prev->next : layer->draw_task_head;
+    /* Walk the tasks once and collect the tiles of the unfinished tasks in a bitmap.
+     * A queued task is independent if none of its tiles is touched by an earlier
+     * unfinished task. It's conservative: tasks sharing only a tile are considered
+     * dependent, but checking a task costs only as much as the tiles it covers
+     * instead of walking all the older tasks.*/
+    dep_map_t map;
+    dep_map_init(&map, layer);
+
+    lv_draw_task_t * t_start = t_prev ? t_prev->next : layer->draw_task_head;
+    bool search = false;
+    lv_draw_task_t * t = layer->draw_task_head;
     while(t) {
-        /*Find a queued and independent task*/
-        if(t->state == LV_DRAW_TASK_STATE_QUEUED &&
-           (t->preferred_draw_unit_id == LV_DRAW_UNIT_NONE || t->preferred_draw_unit_id == draw_unit_id) &&
-           is_independent(layer, t)) {
-            LV_PROFILER_DRAW_END;
-            return t;
+        if(t == t_start) search = true;
+
+        if(t->state != LV_DRAW_TASK_STATE_READY) {
+            /*Find a queued and independent task*/
+            bool check = search && t->state == LV_DRAW_TASK_STATE_QUEUED &&
+                         (t->preferred_draw_unit_id == LV_DRAW_UNIT_NONE || t->preferred_draw_unit_id == draw_unit_id);
+            if(dep_map_check_and_set(&map, &t->_real_area, check)) {
+                LV_PROFILER_DRAW_END;
+                return t;
+            }
         }
         t = t->next;
     }
@@ -523,32 +575,68 @@ void lv_draw_task_get_area(const lv_draw_task_t * t, lv_area_t * area)
  **********************/
 
 /**
- * Check if there are older draw task overlapping the area of `t_check`
- * @param layer      the draw ctx to search in
- * @param t_check       check this task if it overlaps with the older ones
- * @return              true: `t_check` is not overlapping with older tasks so it's independent
+ * Initialize a tile map covering the buffer area of a layer
+ * @param map       pointer to a tile map to initialize
+ * @param layer     the layer whose tasks will be added to the map
  */
-static bool is_independent(lv_layer_t * layer, lv_draw_task_t * t_check)
+static void dep_map_init(dep_map_t * map, const lv_layer_t * layer)
 {
-    LV_PROFILER_DRAW_BEGIN;
-    lv_draw_task_t * t = layer->draw_task_head;
+    lv_memzero(map->rows, sizeof(map->rows));
+    map->x_ofs = layer->buf_area.x1;
+    map->y_ofs = layer->buf_area.y1;
+    map->tile_w = LV_MAX(1, (lv_area_get_width(&layer->buf_area) + DEP_MAP_COLS - 1) / DEP_MAP_COLS);
+    map->tile_h = LV_MAX(1, (lv_area_get_height(&layer->buf_area) + DEP_MAP_ROWS - 1) / DEP_MAP_ROWS);
+}
 
-    /*If t_check is outside of the older tasks then it's independent*/
-    while(t && t != t_check) {
-        if(t->state != LV_DRAW_TASK_STATE_READY) {
-            lv_area_t a;
-            if(lv_area_intersect(&a, &t->_real_area, &t_check->_real_area)) {
-                LV_PROFILER_DRAW_END;
-                return false;
-            }
-        }
-        t = t->next;
-    }
-    LV_PROFILER_DRAW_END;
+/**
+ * Get the tiles touched by an area. Areas out of the layer are clamped to the border tiles.
+ * @param map           pointer to a tile map
+ * @param area          the area to convert
+ * @param mask          store the column mask of the tiles here
+ * @param row_start     store the first tile row here
+ * @param row_end       store the last tile row here
+ * @return              false: the area is invalid, it doesn't touch any tiles
+ */
+static bool dep_map_get_tiles(const dep_map_t * map, const lv_area_t * area, uint64_t * mask, int32_t * row_start,
+                              int32_t * row_end)
+{
+    if(area->x1 > area->x2 || area->y1 > area->y2) return false;
+
+    int32_t col_start = LV_CLAMP(0, (area->x1 - map->x_ofs) / map->tile_w, DEP_MAP_COLS - 1);
+    int32_t col_end = LV_CLAMP(0, (area->x2 - map->x_ofs) / map->tile_w, DEP_MAP_COLS - 1);
+    *row_start = LV_CLAMP(0, (area->y1 - map->y_ofs) / map->tile_h, DEP_MAP_ROWS - 1);
+    *row_end = LV_CLAMP(0, (area->y2 - map->y_ofs) / map->tile_h, DEP_MAP_ROWS - 1);
+
+    uint64_t m = col_end == DEP_MAP_COLS - 1 ? UINT64_MAX : (((uint64_t)1 << (col_end + 1)) - 1);
+    *mask = m & ~(((uint64_t)1 << col_start) - 1);
 
     return true;
 }
 
+/**
+ * Mark the tiles of an unfinished task and optionally check if they were free before
+ * @param map       pointer to a tile map
+ * @param area      the real area of the task
+ * @param check     true: check if the area touches tiles of older tasks
+ * @return          true: `check` was requested and the area doesn't touch any older tasks
+ */
+static bool dep_map_check_and_set(dep_map_t * map, const lv_area_t * area, bool check)
+{
+    uint64_t mask;
+    int32_t row_start;
+    int32_t row_end;
+    if(!dep_map_get_tiles(map, area, &mask, &row_start, &row_end)) return check;
+
+    bool free = check;
+    int32_t r;
+    for(r = row_start; r <= row_end; r++) {
+        if(map->rows[r] & mask) free = false;
+        map->rows[r] |= mask;
+    }
+
+    return free;
+}
+
 /**
  * Clean-up resources allocated by a finished task
  * @param t         pointer to a draw task
@@ -604,6 +692,43 @@ static void lv_cleanup_task(lv_draw_task_t * t, lv_display_t * disp)
     }
 
     lv_free(t->draw_dsc);
-    lv_free(t);
+    task_free(t);
     LV_PROFILER_DRAW_END;
 }
+
+/**
+ * Allocate a zeroed draw task from the task arena or from the heap if the arena is full
+ * @return          pointer to the new draw task or NULL on failure
+ */
+static lv_draw_task_t * task_alloc(void)
+{
+#if LV_DRAW_TASK_ARENA_SIZE
+    const uint32_t task_size = (sizeof(lv_draw_task_t) + sizeof(void *) - 1) & ~(sizeof(void *) - 1);
+    if(_draw_info.task_arena && _draw_info.task_arena_used + task_size <= LV_DRAW_TASK_ARENA_SIZE) {
+        lv_draw_task_t * t = (lv_draw_task_t *)(_draw_info.task_arena + _draw_info.task_arena_used);
+        _draw_info.task_arena_used += task_size;
+        _draw_info.task_arena_live++;
+        lv_memzero(t, sizeof(lv_draw_task_t));
+        return t;
+    }
+#endif
+
+    return lv_malloc_zeroed(sizeof(lv_draw_task_t));
+}
+
+/**
+ * Free a draw task allocated by `task_alloc()`
+ * @param t         pointer to a draw task
+ */
+static void task_free(lv_draw_task_t * t)
+{
+#if LV_DRAW_TASK_ARENA_SIZE
+    uint8_t * p = (uint8_t *)t;
+    if(_draw_info.task_arena && p >= _draw_info.task_arena && p < _draw_info.task_arena + LV_DRAW_TASK_ARENA_SIZE) {
+        _draw_info.task_arena_live--;
+        return;
+    }
+#endif
+
+    lv_free(t);
+}
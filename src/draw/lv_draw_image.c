@@ -9,11 +9,13 @@
 #include "lv_draw_image_private.h"
 #include "../misc/lv_area_private.h"
 #include "lv_image_decoder_private.h"
+#include "lv_image_decoder_async_private.h"
 #include "lv_draw_private.h"
 #include "../display/lv_display.h"
 #include "../misc/lv_log.h"
 #include "../misc/lv_math.h"
-#include "../core/lv_refr.h"
+#include "../core/lv_refr_private.h"
+#include "../display/lv_display_private.h"
 #include "../stdlib/lv_mem.h"
 #include "../stdlib/lv_string.h"
 
@@ -33,6 +35,9 @@ static void img_decode_and_draw(lv_draw_task_t * t, const lv_draw_image_dsc_t *
                                 lv_image_decoder_dsc_t * decoder_dsc, lv_area_t * relative_decoded_area,
                                 const lv_area_t * img_area, const lv_area_t * clipped_img_area,
                                 lv_draw_image_core_cb draw_core_cb);
+#if LV_USE_IMAGE_DECODER_ASYNC
+    static bool img_decode_deferred(lv_layer_t * layer, const lv_draw_image_dsc_t * dsc, const lv_area_t * real_area);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -118,13 +123,23 @@ void lv_draw_image(lv_layer_t * layer, const lv_draw_image_dsc_t * dsc, const lv
         return;
     }
 
+    lv_area_t real_area;
+    lv_image_buf_get_transformed_area(&real_area, lv_area_get_width(coords), lv_area_get_height(coords),
+                                      dsc->rotation, dsc->scale_x, dsc->scale_y, &dsc->pivot);
+    lv_area_move(&real_area, coords->x1, coords->y1);
+
+#if LV_USE_IMAGE_DECODER_ASYNC
+    if(img_decode_deferred(layer, new_image_dsc, &real_area)) {
+        lv_free(new_image_dsc);
+        LV_PROFILER_DRAW_END;
+        return;
+    }
+#endif
+
     lv_draw_task_t * t = lv_draw_add_task(layer, coords);
     t->draw_dsc = new_image_dsc;
     t->type = LV_DRAW_TASK_TYPE_IMAGE;
-
-    lv_image_buf_get_transformed_area(&t->_real_area, lv_area_get_width(coords), lv_area_get_height(coords),
-                                      dsc->rotation, dsc->scale_x, dsc->scale_y, &dsc->pivot);
-    lv_area_move(&t->_real_area, coords->x1, coords->y1);
+    t->_real_area = real_area;
 
     lv_draw_finalize_task_creation(layer, t);
     LV_PROFILER_DRAW_END;
@@ -319,3 +334,28 @@ static void img_decode_and_draw(lv_draw_task_t * t, const lv_draw_image_dsc_t *
         }
     }
 }
+
+#if LV_USE_IMAGE_DECODER_ASYNC
+/**
+ * Queue the image for background decoding if it's drawn on a display and it's not decoded yet.
+ * @return true: the image shouldn't be drawn now; its area will be invalidated when it's decoded
+ */
+static bool img_decode_deferred(lv_layer_t * layer, const lv_draw_image_dsc_t * dsc, const lv_area_t * real_area)
+{
+    /*Snapshots and canvases need the image right now*/
+    lv_display_t * disp = lv_refr_get_disp_refreshing();
+    if(disp == NULL || !disp->rendering_in_progress) return false;
+
+    lv_layer_t * top_layer = layer;
+    while(top_layer->parent) top_layer = top_layer->parent;
+    if(top_layer != disp->layer_head) return false;
+
+    /*On child layers (e.g. transformed widgets) the coordinates might be not the final ones*/
+    if(layer != top_layer) return lv_image_decoder_async_defer(dsc->src, &dsc->header, disp, NULL);
+
+    lv_area_t inv_area;
+    if(!lv_area_intersect(&inv_area, real_area, &layer->_clip_area)) return false;
+
+    return lv_image_decoder_async_defer(dsc->src, &dsc->header, disp, &inv_area);
+}
+#endif
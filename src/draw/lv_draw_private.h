@@ -184,6 +184,11 @@ typedef struct {
 #endif
     lv_mutex_t circle_cache_mutex;
     bool task_running;
+#if LV_DRAW_TASK_ARENA_SIZE
+    uint8_t * task_arena;       /**< Buffer to allocate the draw tasks from*/
+    uint32_t task_arena_used;   /**< Bytes already given out from `task_arena`*/
+    uint32_t task_arena_live;   /**< Number of tasks in `task_arena` which are not freed yet*/
+#endif
 } lv_draw_global_info_t;
 
 /**********************
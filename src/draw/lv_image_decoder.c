@@ -7,6 +7,7 @@
  *      INCLUDES
  *********************/
 #include "lv_image_decoder_private.h"
+#include "lv_image_decoder_async_private.h"
 #include "../misc/lv_assert.h"
 #include "../draw/lv_draw_image.h"
 #include "../misc/lv_ll.h"
@@ -19,6 +20,7 @@
 #define img_decoder_ll_p &(LV_GLOBAL_DEFAULT()->img_decoder_ll)
 #define img_cache_p (LV_GLOBAL_DEFAULT()->img_cache)
 #define img_header_cache_p (LV_GLOBAL_DEFAULT()->img_header_cache)
+#define img_tile_cache_p (LV_GLOBAL_DEFAULT()->img_tile_cache)
 #define image_cache_draw_buf_handlers &(LV_GLOBAL_DEFAULT()->image_cache_draw_buf_handlers)
 
 /**********************
@@ -56,13 +58,18 @@ static lv_result_t try_cache(lv_image_decoder_dsc_t * dsc);
 /**
  * Initialize the image decoder module
  */
-void lv_image_decoder_init(uint32_t image_cache_size, uint32_t image_header_count)
+void lv_image_decoder_init(uint32_t image_cache_size, uint32_t image_header_count, uint32_t image_tile_cache_size)
 {
     lv_ll_init(img_decoder_ll_p, sizeof(lv_image_decoder_t));
 
     /*Initialize the cache*/
     lv_image_cache_init(image_cache_size);
     lv_image_header_cache_init(image_header_count);
+    lv_image_tile_cache_init(image_tile_cache_size);
+
+#if LV_USE_IMAGE_DECODER_ASYNC
+    lv_image_decoder_async_init();
+#endif
 }
 
 /**
@@ -70,8 +77,14 @@ void lv_image_decoder_init(uint32_t image_cache_size, uint32_t image_header_coun
  */
 void lv_image_decoder_deinit(void)
 {
+#if LV_USE_IMAGE_DECODER_ASYNC
+    /*Stop the background decoding before the cache is destroyed*/
+    lv_image_decoder_async_deinit();
+#endif
+
     lv_cache_destroy(img_cache_p, NULL);
     lv_cache_destroy(img_header_cache_p, NULL);
+    lv_cache_destroy(img_tile_cache_p, NULL);
 
     lv_ll_clear(img_decoder_ll_p);
 }
@@ -0,0 +1,444 @@
+/**
+ * @file lv_image_decoder_async.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_image_decoder_async_private.h"
+#if LV_USE_IMAGE_DECODER_ASYNC
+
+#include "lv_image_decoder_private.h"
+#include "../misc/lv_area_private.h"
+#include "../misc/lv_ll.h"
+#include "../misc/lv_timer.h"
+#include "../misc/cache/lv_cache.h"
+#include "../misc/cache/lv_image_cache.h"
+#include "../display/lv_display.h"
+#include "../core/lv_refr_private.h"
+#include "../core/lv_global.h"
+#include "../osal/lv_os.h"
+#include "../stdlib/lv_mem.h"
+#include "../stdlib/lv_string.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define async_p (&LV_GLOBAL_DEFAULT()->img_decoder_async)
+#define img_cache_p (LV_GLOBAL_DEFAULT()->img_cache)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+typedef enum {
+    REQUEST_STATE_QUEUED,
+    REQUEST_STATE_DECODING,
+    REQUEST_STATE_READY,        /**< Decoded and added to the image cache*/
+    REQUEST_STATE_UNCACHED,     /**< Decoded but it couldn't be added to the image cache*/
+    REQUEST_STATE_FAILED,
+} request_state_t;
+
+typedef struct {
+    const void * src;           /**< Copy of the file path or the `lv_image_dsc_t` variable*/
+    lv_image_src_t src_type;
+    lv_display_t * disp;        /**< The display to invalidate or NULL for prefetched images*/
+    lv_area_t area;             /**< The area to invalidate on `disp`*/
+    uint8_t inv_all : 1;        /**< Invalidate all displays, e.g. the image was drawn on more displays*/
+    request_state_t state;
+} request_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void async_start(lv_image_decoder_async_t * async);
+static request_t * request_add(const void * src, lv_image_src_t src_type);
+static request_t * request_find(const void * src, lv_image_src_t src_type);
+static void request_decode(request_t * req);
+static void request_free(request_t * req);
+static void request_invalidate(request_t * req);
+static bool src_equal(const void * src1, lv_image_src_t src_type1, const void * src2, lv_image_src_t src_type2);
+static bool is_cached(const void * src, lv_image_src_t src_type);
+static bool is_sync_src(const void * src, lv_image_src_t src_type);
+static void sync_src_add(const void * src, lv_image_src_t src_type);
+static void async_timer_cb(lv_timer_t * timer);
+#if LV_USE_OS
+    static void decoder_thread_cb(void * ptr);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+#if LV_USE_OS
+    #define lock()      lv_mutex_lock(&async_p->lock)
+    #define unlock()    lv_mutex_unlock(&async_p->lock)
+#else
+    #define lock()
+    #define unlock()
+#endif
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_image_decoder_async_init(void)
+{
+    lv_image_decoder_async_t * async = async_p;
+    lv_memzero(async, sizeof(lv_image_decoder_async_t));
+    async->inited = true;
+    lv_ll_init(&async->request_ll, sizeof(request_t));
+    async->enabled = true;
+
+#if LV_USE_OS
+    lv_mutex_init(&async->lock);
+#endif
+}
+
+void lv_image_decoder_async_deinit(void)
+{
+    lv_image_decoder_async_t * async = async_p;
+    if(!async->inited) return;
+
+    if(async->timer) {
+#if LV_USE_OS
+        async->exit_status = true;
+        lv_thread_sync_signal(&async->sync);
+        lv_thread_delete(&async->thread);
+        lv_thread_sync_delete(&async->sync);
+#endif
+        lv_timer_delete(async->timer);
+    }
+
+#if LV_USE_OS
+    lv_mutex_delete(&async->lock);
+#endif
+
+    request_t * req;
+    LV_LL_READ(&async->request_ll, req) {
+        request_free(req);
+    }
+    lv_ll_clear(&async->request_ll);
+
+    uint32_t i;
+    for(i = 0; i < LV_IMAGE_DECODER_ASYNC_SYNC_SRC_CNT; i++) {
+        if(async->sync_srcs[i].src_type == LV_IMAGE_SRC_FILE) lv_free((void *)async->sync_srcs[i].src);
+    }
+
+    lv_memzero(async, sizeof(lv_image_decoder_async_t));
+}
+
+lv_result_t lv_image_prefetch(const void * src)
+{
+    if(!async_p->inited) return LV_RESULT_INVALID;
+    if(!lv_image_cache_is_enabled()) return LV_RESULT_INVALID;
+
+    lv_image_src_t src_type = lv_image_src_get_type(src);
+    if(src_type != LV_IMAGE_SRC_FILE && src_type != LV_IMAGE_SRC_VARIABLE) return LV_RESULT_INVALID;
+
+    if(is_cached(src, src_type)) return LV_RESULT_OK;
+
+    lock();
+    request_t * req = request_find(src, src_type);
+    if(req == NULL) req = request_add(src, src_type);
+    unlock();
+
+    return req ? LV_RESULT_OK : LV_RESULT_INVALID;
+}
+
+void lv_image_decoder_async_set_enabled(bool en)
+{
+    async_p->enabled = en;
+}
+
+uint32_t lv_image_decoder_async_get_pending_count(void)
+{
+    if(!async_p->inited) return 0;
+
+    lock();
+    uint32_t cnt = lv_ll_get_len(&async_p->request_ll);
+    unlock();
+
+    return cnt;
+}
+
+bool lv_image_decoder_async_defer(const void * src, const lv_image_header_t * header, lv_display_t * disp,
+                                  const lv_area_t * area)
+{
+    lv_image_decoder_async_t * async = async_p;
+    if(!async->inited || !async->enabled) return false;
+    if(!lv_image_cache_is_enabled()) return false;
+
+    /*Only the needed tiles of tiled images are decoded while drawing*/
+    if(header->flags & LV_IMAGE_FLAGS_TILED) return false;
+
+    /*C arrays are drawn directly unless they need to be decoded (e.g. PNG or compressed images)*/
+    lv_image_src_t src_type = lv_image_src_get_type(src);
+    if(src_type == LV_IMAGE_SRC_VARIABLE) {
+        bool raw = header->cf == LV_COLOR_FORMAT_RAW || header->cf == LV_COLOR_FORMAT_RAW_ALPHA;
+        if(!raw && !(header->flags & LV_IMAGE_FLAGS_COMPRESSED)) return false;
+    }
+    else if(src_type != LV_IMAGE_SRC_FILE) {
+        return false;
+    }
+
+    if(is_sync_src(src, src_type)) return false;
+    if(is_cached(src, src_type)) return false;
+
+    lock();
+    request_t * req = request_find(src, src_type);
+    if(req == NULL) req = request_add(src, src_type);
+
+    if(req) {
+        if(area == NULL || (req->disp && req->disp != disp)) {
+            req->inv_all = 1;
+        }
+        else if(req->disp == NULL) {
+            req->disp = disp;
+            req->area = *area;
+        }
+        else {
+            lv_area_join(&req->area, &req->area, area);
+        }
+    }
+    unlock();
+
+    /*Draw it synchronously if it couldn't be queued*/
+    return req != NULL;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Start the worker thread and the timer which handles the decoded images.
+ */
+static void async_start(lv_image_decoder_async_t * async)
+{
+    async->timer = lv_timer_create(async_timer_cb, LV_DEF_REFR_PERIOD, NULL);
+    LV_ASSERT_MALLOC(async->timer);
+
+#if LV_USE_OS
+    lv_thread_sync_init(&async->sync);
+    lv_thread_init(&async->thread, "imgdec", LV_THREAD_PRIO_LOW, decoder_thread_cb, LV_DRAW_THREAD_STACK_SIZE, async);
+#endif
+}
+
+/**
+ * Add a new request. The mutex needs to be locked.
+ */
+static request_t * request_add(const void * src, lv_image_src_t src_type)
+{
+    lv_image_decoder_async_t * async = async_p;
+
+    request_t * req = lv_ll_ins_tail(&async->request_ll);
+    LV_ASSERT_MALLOC(req);
+    if(req == NULL) return NULL;
+
+    if(async->timer == NULL) async_start(async);
+
+    lv_memzero(req, sizeof(request_t));
+    req->src_type = src_type;
+    req->state = REQUEST_STATE_QUEUED;
+    if(src_type == LV_IMAGE_SRC_FILE) {
+        req->src = lv_strdup(src);
+        LV_ASSERT_MALLOC(req->src);
+        if(req->src == NULL) {
+            lv_ll_remove(&async->request_ll, req);
+            lv_free(req);
+            return NULL;
+        }
+    }
+    else {
+        req->src = src;
+    }
+
+    lv_timer_resume(async->timer);
+#if LV_USE_OS
+    lv_thread_sync_signal(&async->sync);
+#endif
+
+    return req;
+}
+
+/**
+ * Find the request of an image. The mutex needs to be locked.
+ */
+static request_t * request_find(const void * src, lv_image_src_t src_type)
+{
+    request_t * req;
+    LV_LL_READ(&async_p->request_ll, req) {
+        if(src_equal(req->src, req->src_type, src, src_type)) return req;
+    }
+
+    return NULL;
+}
+
+/**
+ * Decode an image into the image cache and set the state of the request accordingly.
+ * Called without holding the mutex.
+ */
+static void request_decode(request_t * req)
+{
+    lv_image_decoder_dsc_t dsc;
+    request_state_t state;
+    lv_result_t res = lv_image_decoder_open(&dsc, req->src, NULL);
+    if(res == LV_RESULT_OK) {
+        state = dsc.cache_entry ? REQUEST_STATE_READY : REQUEST_STATE_UNCACHED;
+        lv_image_decoder_close(&dsc);
+    }
+    else {
+        LV_LOG_WARN("Couldn't decode the image");
+        state = REQUEST_STATE_FAILED;
+    }
+
+    lock();
+    req->state = state;
+    unlock();
+}
+
+static void request_free(request_t * req)
+{
+    if(req->src_type == LV_IMAGE_SRC_FILE) lv_free((void *)req->src);
+}
+
+/**
+ * Invalidate the area where the image was skipped. `disp` is only compared
+ * so it's safe even if the display was deleted in the meantime.
+ */
+static void request_invalidate(request_t * req)
+{
+    if(req->disp == NULL && !req->inv_all) return;
+
+    lv_display_t * disp = lv_display_get_next(NULL);
+    while(disp) {
+        if(req->inv_all) {
+            lv_area_t a;
+            lv_area_set(&a, 0, 0, lv_display_get_horizontal_resolution(disp) - 1,
+                        lv_display_get_vertical_resolution(disp) - 1);
+            lv_inv_area(disp, &a);
+        }
+        else if(disp == req->disp) {
+            lv_inv_area(disp, &req->area);
+        }
+        disp = lv_display_get_next(disp);
+    }
+}
+
+static bool src_equal(const void * src1, lv_image_src_t src_type1, const void * src2, lv_image_src_t src_type2)
+{
+    if(src_type1 != src_type2) return false;
+    if(src_type1 == LV_IMAGE_SRC_FILE) return lv_strcmp(src1, src2) == 0;
+    return src1 == src2;
+}
+
+static bool is_cached(const void * src, lv_image_src_t src_type)
+{
+    lv_image_cache_data_t search_key;
+    search_key.src = src;
+    search_key.src_type = src_type;
+
+    lv_cache_entry_t * entry = lv_cache_acquire(img_cache_p, &search_key, NULL);
+    if(entry == NULL) return false;
+
+    lv_cache_release(img_cache_p, entry, NULL);
+    return true;
+}
+
+static bool is_sync_src(const void * src, lv_image_src_t src_type)
+{
+    uint32_t i;
+    for(i = 0; i < LV_IMAGE_DECODER_ASYNC_SYNC_SRC_CNT; i++) {
+        lv_image_decoder_async_src_t * s = &async_p->sync_srcs[i];
+        if(s->src && src_equal(s->src, s->src_type, src, src_type)) return true;
+    }
+
+    return false;
+}
+
+static void sync_src_add(const void * src, lv_image_src_t src_type)
+{
+    lv_image_decoder_async_t * async = async_p;
+    if(is_sync_src(src, src_type)) return;
+
+    lv_image_decoder_async_src_t * s = &async->sync_srcs[async->sync_src_next];
+    if(s->src_type == LV_IMAGE_SRC_FILE) lv_free((void *)s->src);
+
+    s->src_type = src_type;
+    s->src = src_type == LV_IMAGE_SRC_FILE ? lv_strdup(src) : src;
+    async->sync_src_next = (async->sync_src_next + 1) % LV_IMAGE_DECODER_ASYNC_SYNC_SRC_CNT;
+}
+
+/**
+ * Runs in the main thread: redraw the areas of the decoded images and drop the finished requests.
+ * Without an OS it also decodes one image per call.
+ */
+static void async_timer_cb(lv_timer_t * timer)
+{
+    lv_image_decoder_async_t * async = async_p;
+
+#if LV_USE_OS == LV_OS_NONE
+    request_t * queued;
+    LV_LL_READ(&async->request_ll, queued) {
+        if(queued->state == REQUEST_STATE_QUEUED) {
+            queued->state = REQUEST_STATE_DECODING;
+            request_decode(queued);
+            break;
+        }
+    }
+#endif
+
+    lock();
+    request_t * req = lv_ll_get_head(&async->request_ll);
+    while(req) {
+        request_t * req_next = lv_ll_get_next(&async->request_ll, req);
+        if(req->state != REQUEST_STATE_QUEUED && req->state != REQUEST_STATE_DECODING) {
+            /*Don't try it again in the background if it can't be cached or decoded*/
+            if(req->state != REQUEST_STATE_READY) sync_src_add(req->src, req->src_type);
+            request_invalidate(req);
+
+            request_free(req);
+            lv_ll_remove(&async->request_ll, req);
+            lv_free(req);
+        }
+        req = req_next;
+    }
+
+    if(lv_ll_is_empty(&async->request_ll)) lv_timer_pause(timer);
+    unlock();
+}
+
+#if LV_USE_OS
+static void decoder_thread_cb(void * ptr)
+{
+    lv_image_decoder_async_t * async = ptr;
+
+    while(1) {
+        request_t * req = NULL;
+
+        lock();
+        request_t * req_i;
+        LV_LL_READ(&async->request_ll, req_i) {
+            if(req_i->state == REQUEST_STATE_QUEUED) {
+                req = req_i;
+                req->state = REQUEST_STATE_DECODING;
+                break;
+            }
+        }
+        unlock();
+
+        if(async->exit_status) break;
+
+        if(req) request_decode(req);
+        else lv_thread_sync_wait(&async->sync);
+    }
+
+    LV_LOG_INFO("exit image decoder thread");
+}
+#endif
+
+#endif /*LV_USE_IMAGE_DECODER_ASYNC*/
@@ -0,0 +1,67 @@
+/**
+ * @file lv_image_decoder_async.h
+ *
+ */
+
+#ifndef LV_IMAGE_DECODER_ASYNC_H
+#define LV_IMAGE_DECODER_ASYNC_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../lv_conf_internal.h"
+#include "../misc/lv_types.h"
+
+#if LV_USE_IMAGE_DECODER_ASYNC
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Decode an image in the background and put it into the image cache,
+ * so it can be drawn without decoding later. E.g. call it for the images of the next screen.
+ * @param src       the image source: a file path or an `lv_image_dsc_t` variable
+ * @return          LV_RESULT_OK: the image is queued or already in the cache;
+ *                  LV_RESULT_INVALID: the image cache is disabled or the source is not an image
+ */
+lv_result_t lv_image_prefetch(const void * src);
+
+/**
+ * Enable or disable deferring the drawing of images which are not decoded yet.
+ * If enabled, an image which is not in the cache is queued for decoding and not drawn until it's ready.
+ * Its area is invalidated once it's decoded. Enabled by default.
+ * @param en        true: decode in the background; false: decode while drawing
+ */
+void lv_image_decoder_async_set_enabled(bool en);
+
+/**
+ * Get the number of images which are being decoded or waiting to be processed.
+ * @return          the number of pending requests
+ */
+uint32_t lv_image_decoder_async_get_pending_count(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_IMAGE_DECODER_ASYNC*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_IMAGE_DECODER_ASYNC_H*/
@@ -0,0 +1,96 @@
+/**
+ * @file lv_image_decoder_async_private.h
+ *
+ */
+
+#ifndef LV_IMAGE_DECODER_ASYNC_PRIVATE_H
+#define LV_IMAGE_DECODER_ASYNC_PRIVATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_image_decoder_async.h"
+
+#if LV_USE_IMAGE_DECODER_ASYNC
+
+#include "../misc/lv_area.h"
+#include "../misc/lv_ll.h"
+#include "../misc/lv_timer.h"
+#include "../osal/lv_os.h"
+#include "lv_image_decoder.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/** Number of recent images which couldn't be decoded or cached (e.g. too large for the cache).
+ *  They are drawn synchronously to not decode them again and again in the background. */
+#define LV_IMAGE_DECODER_ASYNC_SYNC_SRC_CNT     8
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    const void * src;           /**< Copy of the file path or the `lv_image_dsc_t` variable*/
+    lv_image_src_t src_type;
+} lv_image_decoder_async_src_t;
+
+typedef struct {
+    lv_ll_t request_ll;         /**< List of the queued and decoded images*/
+    lv_timer_t * timer;         /**< Created with the worker thread on the first request*/
+    lv_image_decoder_async_src_t sync_srcs[LV_IMAGE_DECODER_ASYNC_SYNC_SRC_CNT];
+    uint32_t sync_src_next;
+    bool inited;
+    bool enabled;
+#if LV_USE_OS
+    lv_thread_t thread;
+    lv_thread_sync_t sync;
+    lv_mutex_t lock;
+    volatile bool exit_status;
+#endif
+} lv_image_decoder_async_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Initialize the background image decoding. Called from `lv_image_decoder_init()`.
+ */
+void lv_image_decoder_async_init(void);
+
+/**
+ * Stop the background decoding and free the pending requests.
+ * Called from `lv_image_decoder_deinit()` before the image cache is destroyed.
+ */
+void lv_image_decoder_async_deinit(void);
+
+/**
+ * Check if drawing an image should be skipped because it's being decoded in the background.
+ * If the image is not in the cache it's queued and `area` of `disp` will be invalidated when it's ready.
+ * @param src       the image source
+ * @param header    the header of the image
+ * @param disp      the display being refreshed
+ * @param area      the area to invalidate when the image is ready or NULL to invalidate the whole screen
+ * @return          true: don't draw the image now; false: draw it as usual
+ */
+bool lv_image_decoder_async_defer(const void * src, const lv_image_header_t * header, lv_display_t * disp,
+                                  const lv_area_t * area);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_IMAGE_DECODER_ASYNC*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_IMAGE_DECODER_ASYNC_PRIVATE_H*/
@@ -71,6 +71,16 @@ struct _lv_image_header_cache_data_t {
     lv_image_decoder_t * decoder;
 };
 
+struct _lv_image_tile_cache_data_t {
+    lv_cache_slot_size_t slot;
+
+    const void * src;
+    lv_image_src_t src_type;
+    uint32_t tile_index;        /**< Index of the tile in row-major order*/
+
+    lv_draw_buf_t * decoded;
+};
+
 /**Describe an image decoding session. Stores data about the decoding*/
 struct _lv_image_decoder_dsc_t {
     /**The decoder which was able to open the image source*/
@@ -123,8 +133,9 @@ struct _lv_image_decoder_dsc_t {
  * Initialize the image decoder module
  * @param image_cache_size    Image cache size in bytes. 0 to disable cache.
  * @param image_header_count  Number of header cache entries. 0 to disable header cache.
+ * @param image_tile_cache_size  Size of the cache of the tiles of tiled images in bytes. 0 to disable tile cache.
  */
-void lv_image_decoder_init(uint32_t image_cache_size, uint32_t image_header_count);
+void lv_image_decoder_init(uint32_t image_cache_size, uint32_t image_header_count, uint32_t image_tile_cache_size);
 
 /**
  * Deinitialize the image decoder module
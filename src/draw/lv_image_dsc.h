@@ -42,6 +42,12 @@ typedef enum _lvimage_flags_t {
      */
     LV_IMAGE_FLAGS_COMPRESSED       = 0x0008,
 
+    /**
+     * The image is split to tiles which are compressed and decoded separately.
+     * Only the tiles needed for drawing are decoded via `get_area_cb`.
+     */
+    LV_IMAGE_FLAGS_TILED            = 0x0040,
+
     /*Below flags are applicable only for draw buffer header.*/
 
     /**
@@ -0,0 +1,576 @@
+/**
+ * @file lv_blend_sse2.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_blend_sse2.h"
+#if LV_USE_DRAW_SW && LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_SSE2
+
+#include <emmintrin.h>
+#include "../lv_draw_sw_blend_private.h"
+#include "../../../../misc/lv_color.h"
+#include "../../../../stdlib/lv_string.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define BLEND_OPA       0x1     /*Apply `dsc->opa`*/
+#define BLEND_MASK      0x2     /*Apply `dsc->mask_buf`*/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void color_to_rgb565(lv_draw_sw_blend_fill_dsc_t * dsc, uint32_t flags);
+static void rgb565_to_rgb565(lv_draw_sw_blend_image_dsc_t * dsc, uint32_t flags);
+static void argb8888_to_rgb565(lv_draw_sw_blend_image_dsc_t * dsc, uint32_t flags);
+static void color_to_xrgb8888(lv_draw_sw_blend_fill_dsc_t * dsc, uint32_t flags);
+static void argb8888_to_xrgb8888(lv_draw_sw_blend_image_dsc_t * dsc, uint32_t flags);
+static void fill_u32(void * dest_buf, int32_t w, int32_t h, int32_t stride, uint32_t color32);
+
+static inline __m128i mullo_epi32(__m128i a, __m128i b);
+static inline __m128i load_rgb565_x4(const uint16_t * src);
+static inline void store_rgb565_x4(uint16_t * dest, __m128i px);
+static inline __m128i color_mix_x4(const lv_opa_t * mask, __m128i opa, uint32_t flags);
+static inline __m128i image_mix_x4(__m128i alpha, const lv_opa_t * mask, __m128i opa, uint32_t flags);
+static inline __m128i mix_16_16_x4(__m128i fg, __m128i bg, __m128i mix);
+static inline __m128i mix_24_16_x4(__m128i src, __m128i dest, __m128i mix);
+static inline __m128i mix_24_24_x4(__m128i src, __m128i dest, __m128i mix);
+static inline void * drawbuf_next_row(const void * buf, uint32_t stride);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_result_t lv_color_blend_to_rgb565_sse2(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    uint16_t color16 = lv_color_to_u16(dsc->color);
+    __m128i color_x8 = _mm_set1_epi16((int16_t)color16);
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+    int32_t x;
+    int32_t y;
+
+    for(y = 0; y < h; y++) {
+        for(x = 0; x <= w - 8; x += 8) {
+            _mm_storeu_si128((__m128i *)&dest_buf_u16[x], color_x8);
+        }
+        for(; x < w; x++) {
+            dest_buf_u16[x] = color16;
+        }
+        dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dsc->dest_stride);
+    }
+
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_color_blend_to_rgb565_with_opa_sse2(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    color_to_rgb565(dsc, BLEND_OPA);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_color_blend_to_rgb565_with_mask_sse2(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    color_to_rgb565(dsc, BLEND_MASK);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_color_blend_to_rgb565_mix_mask_opa_sse2(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    color_to_rgb565(dsc, BLEND_MASK | BLEND_OPA);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_rgb565_blend_normal_to_rgb565_with_opa_sse2(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    rgb565_to_rgb565(dsc, BLEND_OPA);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_rgb565_blend_normal_to_rgb565_with_mask_sse2(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    rgb565_to_rgb565(dsc, BLEND_MASK);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_rgb565_blend_normal_to_rgb565_mix_mask_opa_sse2(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    rgb565_to_rgb565(dsc, BLEND_MASK | BLEND_OPA);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_argb8888_blend_normal_to_rgb565_sse2(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    argb8888_to_rgb565(dsc, 0);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_argb8888_blend_normal_to_rgb565_with_opa_sse2(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    argb8888_to_rgb565(dsc, BLEND_OPA);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_argb8888_blend_normal_to_rgb565_with_mask_sse2(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    argb8888_to_rgb565(dsc, BLEND_MASK);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_argb8888_blend_normal_to_rgb565_mix_mask_opa_sse2(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    argb8888_to_rgb565(dsc, BLEND_MASK | BLEND_OPA);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_color_blend_to_rgb888_sse2(lv_draw_sw_blend_fill_dsc_t * dsc, uint32_t dst_px_size)
+{
+    /*Unaligned 3 byte pixels are left to the generic implementation*/
+    if(dst_px_size != 4) return LV_RESULT_INVALID;
+
+    fill_u32(dsc->dest_buf, dsc->dest_w, dsc->dest_h, dsc->dest_stride, lv_color_to_u32(dsc->color));
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_color_blend_to_rgb888_with_opa_sse2(lv_draw_sw_blend_fill_dsc_t * dsc, uint32_t dst_px_size)
+{
+    if(dst_px_size != 4) return LV_RESULT_INVALID;
+
+    color_to_xrgb8888(dsc, BLEND_OPA);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_color_blend_to_rgb888_with_mask_sse2(lv_draw_sw_blend_fill_dsc_t * dsc, uint32_t dst_px_size)
+{
+    if(dst_px_size != 4) return LV_RESULT_INVALID;
+
+    color_to_xrgb8888(dsc, BLEND_MASK);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_color_blend_to_rgb888_mix_mask_opa_sse2(lv_draw_sw_blend_fill_dsc_t * dsc, uint32_t dst_px_size)
+{
+    if(dst_px_size != 4) return LV_RESULT_INVALID;
+
+    color_to_xrgb8888(dsc, BLEND_MASK | BLEND_OPA);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_argb8888_blend_normal_to_rgb888_sse2(lv_draw_sw_blend_image_dsc_t * dsc, uint32_t dst_px_size)
+{
+    if(dst_px_size != 4) return LV_RESULT_INVALID;
+
+    argb8888_to_xrgb8888(dsc, 0);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_argb8888_blend_normal_to_rgb888_with_opa_sse2(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                             uint32_t dst_px_size)
+{
+    if(dst_px_size != 4) return LV_RESULT_INVALID;
+
+    argb8888_to_xrgb8888(dsc, BLEND_OPA);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_argb8888_blend_normal_to_rgb888_with_mask_sse2(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                              uint32_t dst_px_size)
+{
+    if(dst_px_size != 4) return LV_RESULT_INVALID;
+
+    argb8888_to_xrgb8888(dsc, BLEND_MASK);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_argb8888_blend_normal_to_rgb888_mix_mask_opa_sse2(lv_draw_sw_blend_image_dsc_t * dsc,
+                                                                 uint32_t dst_px_size)
+{
+    if(dst_px_size != 4) return LV_RESULT_INVALID;
+
+    argb8888_to_xrgb8888(dsc, BLEND_MASK | BLEND_OPA);
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_color_blend_to_argb8888_sse2(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    fill_u32(dsc->dest_buf, dsc->dest_w, dsc->dest_h, dsc->dest_stride, lv_color_to_u32(dsc->color));
+    return LV_RESULT_OK;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/* Each blending function below processes 4 pixels in one step.
+ * The remaining 1..3 pixels of a row are copied to zero padded temporary buffers
+ * and processed the same way to get exactly the same result as the full steps.*/
+
+static void color_to_rgb565(lv_draw_sw_blend_fill_dsc_t * dsc, uint32_t flags)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+    const lv_opa_t * mask = dsc->mask_buf;
+    __m128i color_x4 = _mm_set1_epi32(lv_color_to_u16(dsc->color));
+    __m128i opa_x4 = _mm_set1_epi32(dsc->opa);
+    int32_t x;
+    int32_t y;
+
+    for(y = 0; y < h; y++) {
+        for(x = 0; x <= w - 4; x += 4) {
+            __m128i mix = color_mix_x4(mask ? &mask[x] : NULL, opa_x4, flags);
+            store_rgb565_x4(&dest_buf_u16[x], mix_16_16_x4(color_x4, load_rgb565_x4(&dest_buf_u16[x]), mix));
+        }
+
+        if(x < w) {
+            uint16_t dest_tmp[4] = {0};
+            lv_opa_t mask_tmp[4] = {0};
+            lv_memcpy(dest_tmp, &dest_buf_u16[x], (w - x) * sizeof(uint16_t));
+            if(mask) lv_memcpy(mask_tmp, &mask[x], w - x);
+            __m128i mix = color_mix_x4(mask_tmp, opa_x4, flags);
+            store_rgb565_x4(dest_tmp, mix_16_16_x4(color_x4, load_rgb565_x4(dest_tmp), mix));
+            lv_memcpy(&dest_buf_u16[x], dest_tmp, (w - x) * sizeof(uint16_t));
+        }
+
+        dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dsc->dest_stride);
+        if(mask) mask += dsc->mask_stride;
+    }
+}
+
+static void rgb565_to_rgb565(lv_draw_sw_blend_image_dsc_t * dsc, uint32_t flags)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+    const uint16_t * src_buf_u16 = dsc->src_buf;
+    const lv_opa_t * mask = dsc->mask_buf;
+    __m128i opa_x4 = _mm_set1_epi32(dsc->opa);
+    int32_t x;
+    int32_t y;
+
+    for(y = 0; y < h; y++) {
+        for(x = 0; x <= w - 4; x += 4) {
+            __m128i mix = color_mix_x4(mask ? &mask[x] : NULL, opa_x4, flags);
+            __m128i res = mix_16_16_x4(load_rgb565_x4(&src_buf_u16[x]), load_rgb565_x4(&dest_buf_u16[x]), mix);
+            store_rgb565_x4(&dest_buf_u16[x], res);
+        }
+
+        if(x < w) {
+            uint16_t dest_tmp[4] = {0};
+            uint16_t src_tmp[4] = {0};
+            lv_opa_t mask_tmp[4] = {0};
+            lv_memcpy(dest_tmp, &dest_buf_u16[x], (w - x) * sizeof(uint16_t));
+            lv_memcpy(src_tmp, &src_buf_u16[x], (w - x) * sizeof(uint16_t));
+            if(mask) lv_memcpy(mask_tmp, &mask[x], w - x);
+            __m128i mix = color_mix_x4(mask_tmp, opa_x4, flags);
+            store_rgb565_x4(dest_tmp, mix_16_16_x4(load_rgb565_x4(src_tmp), load_rgb565_x4(dest_tmp), mix));
+            lv_memcpy(&dest_buf_u16[x], dest_tmp, (w - x) * sizeof(uint16_t));
+        }
+
+        dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dsc->dest_stride);
+        src_buf_u16 = drawbuf_next_row(src_buf_u16, dsc->src_stride);
+        if(mask) mask += dsc->mask_stride;
+    }
+}
+
+static void argb8888_to_rgb565(lv_draw_sw_blend_image_dsc_t * dsc, uint32_t flags)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+    const uint32_t * src_buf_u32 = dsc->src_buf;
+    const lv_opa_t * mask = dsc->mask_buf;
+    __m128i opa_x4 = _mm_set1_epi32(dsc->opa);
+    int32_t x;
+    int32_t y;
+
+    for(y = 0; y < h; y++) {
+        for(x = 0; x <= w - 4; x += 4) {
+            __m128i src = _mm_loadu_si128((const __m128i *)&src_buf_u32[x]);
+            __m128i mix = image_mix_x4(_mm_srli_epi32(src, 24), mask ? &mask[x] : NULL, opa_x4, flags);
+            store_rgb565_x4(&dest_buf_u16[x], mix_24_16_x4(src, load_rgb565_x4(&dest_buf_u16[x]), mix));
+        }
+
+        if(x < w) {
+            uint16_t dest_tmp[4] = {0};
+            uint32_t src_tmp[4] = {0};
+            lv_opa_t mask_tmp[4] = {0};
+            lv_memcpy(dest_tmp, &dest_buf_u16[x], (w - x) * sizeof(uint16_t));
+            lv_memcpy(src_tmp, &src_buf_u32[x], (w - x) * sizeof(uint32_t));
+            if(mask) lv_memcpy(mask_tmp, &mask[x], w - x);
+            __m128i src = _mm_loadu_si128((const __m128i *)src_tmp);
+            __m128i mix = image_mix_x4(_mm_srli_epi32(src, 24), mask_tmp, opa_x4, flags);
+            store_rgb565_x4(dest_tmp, mix_24_16_x4(src, load_rgb565_x4(dest_tmp), mix));
+            lv_memcpy(&dest_buf_u16[x], dest_tmp, (w - x) * sizeof(uint16_t));
+        }
+
+        dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dsc->dest_stride);
+        src_buf_u32 = drawbuf_next_row(src_buf_u32, dsc->src_stride);
+        if(mask) mask += dsc->mask_stride;
+    }
+}
+
+static void color_to_xrgb8888(lv_draw_sw_blend_fill_dsc_t * dsc, uint32_t flags)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    uint32_t * dest_buf_u32 = dsc->dest_buf;
+    const lv_opa_t * mask = dsc->mask_buf;
+    __m128i color_x4 = _mm_set1_epi32((int32_t)lv_color_to_u32(dsc->color));
+    __m128i opa_x4 = _mm_set1_epi32(dsc->opa);
+    int32_t x;
+    int32_t y;
+
+    for(y = 0; y < h; y++) {
+        for(x = 0; x <= w - 4; x += 4) {
+            __m128i mix = color_mix_x4(mask ? &mask[x] : NULL, opa_x4, flags);
+            __m128i dest = _mm_loadu_si128((const __m128i *)&dest_buf_u32[x]);
+            _mm_storeu_si128((__m128i *)&dest_buf_u32[x], mix_24_24_x4(color_x4, dest, mix));
+        }
+
+        if(x < w) {
+            uint32_t dest_tmp[4] = {0};
+            lv_opa_t mask_tmp[4] = {0};
+            lv_memcpy(dest_tmp, &dest_buf_u32[x], (w - x) * sizeof(uint32_t));
+            if(mask) lv_memcpy(mask_tmp, &mask[x], w - x);
+            __m128i mix = color_mix_x4(mask_tmp, opa_x4, flags);
+            __m128i dest = _mm_loadu_si128((const __m128i *)dest_tmp);
+            _mm_storeu_si128((__m128i *)dest_tmp, mix_24_24_x4(color_x4, dest, mix));
+            lv_memcpy(&dest_buf_u32[x], dest_tmp, (w - x) * sizeof(uint32_t));
+        }
+
+        dest_buf_u32 = drawbuf_next_row(dest_buf_u32, dsc->dest_stride);
+        if(mask) mask += dsc->mask_stride;
+    }
+}
+
+static void argb8888_to_xrgb8888(lv_draw_sw_blend_image_dsc_t * dsc, uint32_t flags)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    uint32_t * dest_buf_u32 = dsc->dest_buf;
+    const uint32_t * src_buf_u32 = dsc->src_buf;
+    const lv_opa_t * mask = dsc->mask_buf;
+    __m128i opa_x4 = _mm_set1_epi32(dsc->opa);
+    int32_t x;
+    int32_t y;
+
+    for(y = 0; y < h; y++) {
+        for(x = 0; x <= w - 4; x += 4) {
+            __m128i src = _mm_loadu_si128((const __m128i *)&src_buf_u32[x]);
+            __m128i dest = _mm_loadu_si128((const __m128i *)&dest_buf_u32[x]);
+            __m128i mix = image_mix_x4(_mm_srli_epi32(src, 24), mask ? &mask[x] : NULL, opa_x4, flags);
+            _mm_storeu_si128((__m128i *)&dest_buf_u32[x], mix_24_24_x4(src, dest, mix));
+        }
+
+        if(x < w) {
+            uint32_t dest_tmp[4] = {0};
+            uint32_t src_tmp[4] = {0};
+            lv_opa_t mask_tmp[4] = {0};
+            lv_memcpy(dest_tmp, &dest_buf_u32[x], (w - x) * sizeof(uint32_t));
+            lv_memcpy(src_tmp, &src_buf_u32[x], (w - x) * sizeof(uint32_t));
+            if(mask) lv_memcpy(mask_tmp, &mask[x], w - x);
+            __m128i src = _mm_loadu_si128((const __m128i *)src_tmp);
+            __m128i dest = _mm_loadu_si128((const __m128i *)dest_tmp);
+            __m128i mix = image_mix_x4(_mm_srli_epi32(src, 24), mask_tmp, opa_x4, flags);
+            _mm_storeu_si128((__m128i *)dest_tmp, mix_24_24_x4(src, dest, mix));
+            lv_memcpy(&dest_buf_u32[x], dest_tmp, (w - x) * sizeof(uint32_t));
+        }
+
+        dest_buf_u32 = drawbuf_next_row(dest_buf_u32, dsc->dest_stride);
+        src_buf_u32 = drawbuf_next_row(src_buf_u32, dsc->src_stride);
+        if(mask) mask += dsc->mask_stride;
+    }
+}
+
+static void fill_u32(void * dest_buf, int32_t w, int32_t h, int32_t stride, uint32_t color32)
+{
+    uint32_t * dest_buf_u32 = dest_buf;
+    __m128i color_x4 = _mm_set1_epi32((int32_t)color32);
+    int32_t x;
+    int32_t y;
+
+    for(y = 0; y < h; y++) {
+        for(x = 0; x <= w - 8; x += 8) {
+            _mm_storeu_si128((__m128i *)&dest_buf_u32[x], color_x4);
+            _mm_storeu_si128((__m128i *)&dest_buf_u32[x + 4], color_x4);
+        }
+        for(; x < w; x++) {
+            dest_buf_u32[x] = color32;
+        }
+        dest_buf_u32 = drawbuf_next_row(dest_buf_u32, stride);
+    }
+}
+
+/**
+ * Multiply 32-bit lanes keeping the lower 32 bits (`_mm_mullo_epi32` is SSE4.1 only)
+ */
+static inline __m128i mullo_epi32(__m128i a, __m128i b)
+{
+    __m128i even = _mm_mul_epu32(a, b);
+    __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+    return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                              _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+}
+
+/**
+ * Load 4 RGB565 pixels into 32-bit lanes
+ */
+static inline __m128i load_rgb565_x4(const uint16_t * src)
+{
+    return _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i *)src), _mm_setzero_si128());
+}
+
+/**
+ * Store 4 RGB565 pixels from 32-bit lanes
+ */
+static inline void store_rgb565_x4(uint16_t * dest, __m128i px)
+{
+    /*Sign extend the lanes to make the signed saturation of the packing lossless*/
+    px = _mm_srai_epi32(_mm_slli_epi32(px, 16), 16);
+    _mm_storel_epi64((__m128i *)dest, _mm_packs_epi32(px, px));
+}
+
+/**
+ * Get the mix ratio of 4 pixels of a color or an opaque image in 32-bit lanes.
+ * It matches the opacity used by the generic implementation:
+ * `opa`, `mask[x]` or `LV_OPA_MIX2(mask[x], opa)`
+ */
+static inline __m128i color_mix_x4(const lv_opa_t * mask, __m128i opa, uint32_t flags)
+{
+    if(flags == BLEND_OPA) return opa;
+
+    __m128i mask_x4 = _mm_setr_epi32(mask[0], mask[1], mask[2], mask[3]);
+    if(flags == BLEND_MASK) return mask_x4;
+
+    /*All values are 0..255 so the upper 16 bits of the lanes stay 0*/
+    return _mm_srli_epi32(_mm_mullo_epi16(mask_x4, opa), 8);
+}
+
+/**
+ * Get the mix ratio of 4 pixels of an image with alpha channel in 32-bit lanes.
+ * It matches the opacity used by the generic implementation:
+ * `alpha`, `LV_OPA_MIX2(alpha, opa)`, `LV_OPA_MIX2(alpha, mask[x])` or `LV_OPA_MIX3(alpha, mask[x], opa)`
+ */
+static inline __m128i image_mix_x4(__m128i alpha, const lv_opa_t * mask, __m128i opa, uint32_t flags)
+{
+    if(flags == 0) return alpha;
+    if(flags == BLEND_OPA) return _mm_srli_epi32(_mm_mullo_epi16(alpha, opa), 8);
+
+    __m128i mask_x4 = _mm_setr_epi32(mask[0], mask[1], mask[2], mask[3]);
+    if(flags == BLEND_MASK) return _mm_srli_epi32(_mm_mullo_epi16(alpha, mask_x4), 8);
+
+    /*alpha * mask fits into 16 bits, so the high half of the product with opa is the `>> 16`*/
+    return _mm_mulhi_epu16(_mm_mullo_epi16(alpha, mask_x4), opa);
+}
+
+/**
+ * The same as `lv_color_16_16_mix()` on 4 pixels in 32-bit lanes.
+ * The special cases of the scalar version give the same result with the general formula.
+ */
+static inline __m128i mix_16_16_x4(__m128i fg, __m128i bg, __m128i mix)
+{
+    const __m128i rb_g_mask = _mm_set1_epi32(0x7E0F81F);
+
+    mix = _mm_srli_epi32(_mm_add_epi32(mix, _mm_set1_epi32(4)), 3);
+    bg = _mm_and_si128(_mm_or_si128(bg, _mm_slli_epi32(bg, 16)), rb_g_mask);
+    fg = _mm_and_si128(_mm_or_si128(fg, _mm_slli_epi32(fg, 16)), rb_g_mask);
+
+    __m128i res = _mm_srli_epi32(mullo_epi32(_mm_sub_epi32(fg, bg), mix), 5);
+    res = _mm_and_si128(_mm_add_epi32(res, bg), rb_g_mask);
+    return _mm_or_si128(_mm_srli_epi32(res, 16), res);
+}
+
+/**
+ * The same as `lv_color_24_16_mix()` of `lv_draw_sw_blend_to_rgb565.c` on 4 pixels.
+ * `src` is 4 ARGB8888 pixels, `dest` and the result are RGB565 pixels in 32-bit lanes.
+ */
+static inline __m128i mix_24_16_x4(__m128i src, __m128i dest, __m128i mix)
+{
+    const __m128i ff = _mm_set1_epi32(0xFF);
+    __m128i mix_inv = _mm_sub_epi32(ff, mix);
+
+    __m128i src_r = _mm_srli_epi32(_mm_and_si128(_mm_srli_epi32(src, 16), ff), 3);
+    __m128i src_g = _mm_srli_epi32(_mm_and_si128(_mm_srli_epi32(src, 8), ff), 2);
+    __m128i src_b = _mm_srli_epi32(_mm_and_si128(src, ff), 3);
+    __m128i dest_r = _mm_srli_epi32(dest, 11);
+    __m128i dest_g = _mm_and_si128(_mm_srli_epi32(dest, 5), _mm_set1_epi32(0x3F));
+    __m128i dest_b = _mm_and_si128(dest, _mm_set1_epi32(0x1F));
+
+    /*All factors are below 256 so the 16-bit multiplications are exact*/
+    __m128i r = _mm_add_epi32(_mm_mullo_epi16(src_r, mix), _mm_mullo_epi16(dest_r, mix_inv));
+    __m128i g = _mm_add_epi32(_mm_mullo_epi16(src_g, mix), _mm_mullo_epi16(dest_g, mix_inv));
+    __m128i b = _mm_add_epi32(_mm_mullo_epi16(src_b, mix), _mm_mullo_epi16(dest_b, mix_inv));
+    __m128i res = _mm_or_si128(_mm_slli_epi32(_mm_srli_epi32(r, 8), 11), _mm_slli_epi32(_mm_srli_epi32(g, 8), 5));
+    res = _mm_or_si128(res, _mm_srli_epi32(b, 8));
+
+    /*mix == 255: the plain converted color*/
+    __m128i conv = _mm_or_si128(_mm_slli_epi32(src_r, 11), _mm_slli_epi32(src_g, 5));
+    conv = _mm_or_si128(conv, src_b);
+    __m128i sel = _mm_cmpeq_epi32(mix, ff);
+    res = _mm_or_si128(_mm_and_si128(sel, conv), _mm_andnot_si128(sel, res));
+
+    /*mix == 0: keep the destination*/
+    sel = _mm_cmpeq_epi32(mix, _mm_setzero_si128());
+    return _mm_or_si128(_mm_and_si128(sel, dest), _mm_andnot_si128(sel, res));
+}
+
+/**
+ * The same as `lv_color_24_24_mix()` of `lv_draw_sw_blend_to_rgb888.c` on 4 XRGB8888 pixels.
+ * The 4th byte of `dest` is always kept.
+ */
+static inline __m128i mix_24_24_x4(__m128i src, __m128i dest, __m128i mix)
+{
+    const __m128i zero = _mm_setzero_si128();
+
+    /*Spread the mix of the pixels to their channels in 16-bit lanes*/
+    __m128i mix16 = _mm_or_si128(mix, _mm_slli_epi32(mix, 16));
+    __m128i mix_lo = _mm_unpacklo_epi32(mix16, mix16);
+    __m128i mix_hi = _mm_unpackhi_epi32(mix16, mix16);
+    __m128i mix_inv_lo = _mm_sub_epi16(_mm_set1_epi16(255), mix_lo);
+    __m128i mix_inv_hi = _mm_sub_epi16(_mm_set1_epi16(255), mix_hi);
+
+    /*src * mix + dest * mix_inv <= 255 * 255 so it fits into the unsigned 16-bit lanes*/
+    __m128i lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(src, zero), mix_lo),
+                               _mm_mullo_epi16(_mm_unpacklo_epi8(dest, zero), mix_inv_lo));
+    __m128i hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(src, zero), mix_hi),
+                               _mm_mullo_epi16(_mm_unpackhi_epi8(dest, zero), mix_inv_hi));
+    __m128i res = _mm_packus_epi16(_mm_srli_epi16(lo, 8), _mm_srli_epi16(hi, 8));
+
+    /*mix >= LV_OPA_MAX: copy the source color*/
+    __m128i sel = _mm_cmpgt_epi32(mix, _mm_set1_epi32(LV_OPA_MAX - 1));
+    res = _mm_or_si128(_mm_and_si128(sel, src), _mm_andnot_si128(sel, res));
+
+    /*mix == 0: keep the destination*/
+    sel = _mm_cmpeq_epi32(mix, zero);
+    res = _mm_or_si128(_mm_and_si128(sel, dest), _mm_andnot_si128(sel, res));
+
+    const __m128i x_mask = _mm_set1_epi32((int32_t)0xFF000000);
+    return _mm_or_si128(_mm_andnot_si128(x_mask, res), _mm_and_si128(x_mask, dest));
+}
+
+static inline void * drawbuf_next_row(const void * buf, uint32_t stride)
+{
+    return (void *)((uint8_t *)buf + stride);
+}
+
+#endif /*LV_USE_DRAW_SW && LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_SSE2*/
@@ -11,6 +11,7 @@
 #if LV_USE_DRAW_SW
 
 #include "../../core/lv_refr.h"
+#include "../../misc/lv_area_private.h"
 #include "../../display/lv_display_private.h"
 #include "../../stdlib/lv_string.h"
 #include "../../core/lv_global.h"
@@ -49,7 +50,14 @@
     static void render_thread_cb(void * ptr);
 #endif
 
-static void execute_drawing(lv_draw_sw_unit_t * u);
+static void execute_drawing(lv_draw_sw_unit_t * u, lv_draw_task_t * t);
+
+#if LV_DRAW_SW_SPLIT_TASKS
+    static bool split_task(lv_draw_sw_unit_t * u);
+    static void execute_bands(lv_draw_sw_unit_t * u);
+    static bool steal_band(lv_draw_sw_unit_t * u);
+    static void execute_band(lv_draw_sw_unit_t * u, lv_draw_sw_unit_t * owner, const lv_area_t * band);
+#endif
 
 static int32_t dispatch(lv_draw_unit_t * draw_unit, lv_layer_t * layer);
 static int32_t evaluate(lv_draw_unit_t * draw_unit, lv_draw_task_t * task);
@@ -83,6 +91,10 @@ void lv_draw_sw_init(void)
         draw_sw_unit->base_unit.delete_cb = LV_USE_OS ? lv_draw_sw_delete : NULL;
         draw_sw_unit->base_unit.name = "SW";
 
+#if LV_DRAW_SW_SPLIT_TASKS
+        lv_mutex_init(&draw_sw_unit->band_mutex);
+#endif
+
 #if LV_USE_OS
         lv_thread_init(&draw_sw_unit->thread, "swdraw", LV_THREAD_PRIO_HIGH, render_thread_cb, LV_DRAW_THREAD_STACK_SIZE,
                        draw_sw_unit);
@@ -117,7 +129,13 @@ static int32_t lv_draw_sw_delete(lv_draw_unit_t * draw_unit)
         lv_thread_sync_signal(&draw_sw_unit->sync);
     }
 
-    return lv_thread_delete(&draw_sw_unit->thread);
+    lv_result_t res = lv_thread_delete(&draw_sw_unit->thread);
+
+#if LV_DRAW_SW_SPLIT_TASKS
+    lv_mutex_delete(&draw_sw_unit->band_mutex);
+#endif
+
+    return res;
 #else
     LV_UNUSED(draw_unit);
     return 0;
@@ -129,7 +147,12 @@ static int32_t lv_draw_sw_delete(lv_draw_unit_t * draw_unit)
  **********************/
 static inline void execute_drawing_unit(lv_draw_sw_unit_t * u)
 {
-    execute_drawing(u);
+#if LV_DRAW_SW_SPLIT_TASKS
+    if(split_task(u)) execute_bands(u);
+    else execute_drawing(u, u->task_act);
+#else
+    execute_drawing(u, u->task_act);
+#endif
 
     u->task_act->state = LV_DRAW_TASK_STATE_READY;
     u->task_act = NULL;
@@ -226,6 +249,10 @@ static void render_thread_cb(void * ptr)
             if(u->exit_status) {
                 break;
             }
+#if LV_DRAW_SW_SPLIT_TASKS
+            /*Help the other units while there is nothing else to do*/
+            if(steal_band(u)) continue;
+#endif
             lv_thread_sync_wait(&u->sync);
         }
 
@@ -243,11 +270,11 @@ static void render_thread_cb(void * ptr)
 }
 #endif
 
-static void execute_drawing(lv_draw_sw_unit_t * u)
+static void execute_drawing(lv_draw_sw_unit_t * u, lv_draw_task_t * t)
 {
+    LV_UNUSED(u);
     LV_PROFILER_DRAW_BEGIN;
     /*Render the draw task*/
-    lv_draw_task_t * t = u->task_act;
 #if LV_USE_PARALLEL_DRAW_DEBUG
     t->draw_unit = &u->base_unit;
 #endif
@@ -340,4 +367,159 @@ static void execute_drawing(lv_draw_sw_unit_t * u)
     LV_PROFILER_DRAW_END;
 }
 
+#if LV_DRAW_SW_SPLIT_TASKS
+
+/**
+ * Split the active task of a unit into horizontal bands if it's large enough
+ * and rendering it only in a part of its area gives the same result.
+ * @param u     pointer to a SW draw unit
+ * @return      true: the bands were added to the unit's deque
+ */
+static bool split_task(lv_draw_sw_unit_t * u)
+{
+    lv_draw_task_t * t = u->task_act;
+
+    switch(t->type) {
+        case LV_DRAW_TASK_TYPE_FILL:
+        case LV_DRAW_TASK_TYPE_BORDER:
+        case LV_DRAW_TASK_TYPE_BOX_SHADOW:
+            break;
+        case LV_DRAW_TASK_TYPE_IMAGE: {
+                /*Don't decode the images again and again for each band*/
+                lv_draw_image_dsc_t * draw_dsc = t->draw_dsc;
+                if(lv_image_src_get_type(draw_dsc->src) != LV_IMAGE_SRC_VARIABLE) return false;
+            }
+            break;
+        case LV_DRAW_TASK_TYPE_LAYER: {
+                /*The bitmap mask is applied on the whole layer in place*/
+                lv_draw_image_dsc_t * draw_dsc = t->draw_dsc;
+                if(draw_dsc->bitmap_mask_src) return false;
+            }
+            break;
+        default:
+            return false;
+    }
+
+    lv_area_t draw_area;
+    if(!lv_area_intersect(&draw_area, &t->_real_area, &t->clip_area)) return false;
+    if(lv_area_get_size(&draw_area) < LV_DRAW_SW_SPLIT_MIN_AREA) return false;
+
+    /*Use more bands than units to balance the uneven costs of the bands*/
+    int32_t h = lv_area_get_height(&draw_area);
+    int32_t band_cnt = LV_MIN(LV_DRAW_SW_SPLIT_BAND_MAX, h / 16);
+    if(band_cnt < 2) return false;
+
+    lv_mutex_lock(&u->band_mutex);
+    int32_t i;
+    for(i = 0; i < band_cnt; i++) {
+        lv_area_t * band = &u->bands[i];
+        *band = draw_area;
+        band->y1 = draw_area.y1 + (h * i) / band_cnt;
+        band->y2 = draw_area.y1 + (h * (i + 1)) / band_cnt - 1;
+    }
+    u->band_head = 0;
+    u->band_tail = band_cnt;
+    u->band_cnt = band_cnt;
+    u->band_done_cnt = 0;
+    lv_mutex_unlock(&u->band_mutex);
+
+    /*Wake up the idle units to let them steal bands*/
+    lv_draw_unit_t * other = _draw_info.unit_head;
+    while(other) {
+        lv_draw_sw_unit_t * other_sw = (lv_draw_sw_unit_t *)other;
+        if(other->dispatch_cb == dispatch && other_sw != u &&
+           other_sw->task_act == NULL && other_sw->inited) {
+            lv_thread_sync_signal(&other_sw->sync);
+        }
+        other = other->next;
+    }
+
+    return true;
+}
+
+/**
+ * Render the bands of the unit's own active task, help the other units meanwhile
+ * and wait until all bands are finished
+ * @param u     pointer to a SW draw unit
+ */
+static void execute_bands(lv_draw_sw_unit_t * u)
+{
+    LV_PROFILER_DRAW_BEGIN;
+    while(1) {
+        lv_mutex_lock(&u->band_mutex);
+        bool has_band = u->band_tail > u->band_head;
+        lv_area_t band;
+        if(has_band) {
+            u->band_tail--;
+            band = u->bands[u->band_tail];
+        }
+        bool done = u->band_done_cnt == u->band_cnt;
+        lv_mutex_unlock(&u->band_mutex);
+
+        if(has_band) execute_band(u, u, &band);
+        else if(done) break;
+        else if(!steal_band(u)) {
+            /*The remaining bands are being rendered by the other units*/
+            if(u->exit_status) break;
+            lv_thread_sync_wait(&u->sync);
+        }
+    }
+    LV_PROFILER_DRAW_END;
+}
+
+/**
+ * Steal a band from an other SW draw unit and render it
+ * @param u     pointer to the idle SW draw unit
+ * @return      true: a band was rendered
+ */
+static bool steal_band(lv_draw_sw_unit_t * u)
+{
+    lv_draw_unit_t * other = _draw_info.unit_head;
+    while(other) {
+        lv_draw_sw_unit_t * owner = (lv_draw_sw_unit_t *)other;
+        if(other->dispatch_cb == dispatch && owner != u) {
+            lv_mutex_lock(&owner->band_mutex);
+            bool has_band = owner->band_tail > owner->band_head;
+            lv_area_t band;
+            if(has_band) {
+                band = owner->bands[owner->band_head];
+                owner->band_head++;
+            }
+            lv_mutex_unlock(&owner->band_mutex);
+
+            if(has_band) {
+                execute_band(u, owner, &band);
+                return true;
+            }
+        }
+        other = other->next;
+    }
+
+    return false;
+}
+
+/**
+ * Render a band of a task and notify the owner unit
+ * @param u         pointer to the SW draw unit rendering the band
+ * @param owner     pointer to the SW draw unit whose active task the band belongs to
+ * @param band      the area to render
+ */
+static void execute_band(lv_draw_sw_unit_t * u, lv_draw_sw_unit_t * owner, const lv_area_t * band)
+{
+    LV_PROFILER_DRAW_BEGIN;
+    /*Render a copy of the task clipped to the band*/
+    lv_draw_task_t t_band = *owner->task_act;
+    t_band.clip_area = *band;
+    execute_drawing(u, &t_band);
+
+    lv_mutex_lock(&owner->band_mutex);
+    owner->band_done_cnt++;
+    lv_mutex_unlock(&owner->band_mutex);
+
+    if(owner != u) lv_thread_sync_signal(&owner->sync);
+    LV_PROFILER_DRAW_END;
+}
+
+#endif /*LV_DRAW_SW_SPLIT_TASKS*/
+
 #endif /*LV_USE_DRAW_SW*/
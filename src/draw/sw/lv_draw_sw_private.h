@@ -23,6 +23,12 @@ extern "C" {
  *      DEFINES
  *********************/
 
+/** Split large draw tasks into bands which can be stolen by the other SW draw units*/
+#define LV_DRAW_SW_SPLIT_TASKS  (LV_USE_OS && LV_DRAW_SW_DRAW_UNIT_CNT > 1 && LV_DRAW_SW_SPLIT_MIN_AREA > 0)
+
+/** Maximum number of bands a draw task is split into*/
+#define LV_DRAW_SW_SPLIT_BAND_MAX   (LV_DRAW_SW_DRAW_UNIT_CNT * 2)
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -40,6 +46,16 @@ struct _lv_draw_sw_unit_t {
     volatile bool inited;
     volatile bool exit_status;
 #endif
+#if LV_DRAW_SW_SPLIT_TASKS
+    /** Deque of the not yet rendered bands of `task_act`. The owner unit takes the bands
+     *  from the tail while the idle units steal them from the head. */
+    lv_mutex_t band_mutex;
+    lv_area_t bands[LV_DRAW_SW_SPLIT_BAND_MAX];
+    int32_t band_head;
+    int32_t band_tail;
+    int32_t band_cnt;
+    int32_t band_done_cnt;
+#endif
 };
 
 #if LV_DRAW_SW_SHADOW_CACHE_SIZE
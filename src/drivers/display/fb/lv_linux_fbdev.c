@@ -28,6 +28,7 @@
 
 #include "../../../display/lv_display_private.h"
 #include "../../../draw/sw/lv_draw_sw.h"
+#include "../../../misc/lv_area_private.h"
 
 /*********************
  *      DEFINES
@@ -49,6 +50,15 @@ struct bsd_fb_fix_info {
     long int smem_len;
 };
 
+#if LV_LINUX_FBDEV_PAGE_FLIP
+/*The areas of a framebuffer page which are older than the rendered image*/
+typedef struct {
+    lv_area_t areas[LV_INV_BUF_SIZE];
+    uint32_t cnt;
+    bool full;              /*Too many areas were added: the whole page is outdated*/
+} fb_damage_t;
+#endif
+
 typedef struct {
     const char * devname;
     lv_color_format_t color_format;
@@ -60,11 +70,18 @@ typedef struct {
     struct fb_fix_screeninfo finfo;
 #endif /* LV_LINUX_FBDEV_BSD */
     char * fbp;
+    uint8_t * draw_buf;
+    uint8_t * draw_buf_2;
     uint8_t * rotated_buf;
     size_t rotated_buf_size;
     long int screensize;
     int fbfd;
     bool force_refresh;
+#if LV_LINUX_FBDEV_PAGE_FLIP
+    uint32_t page_cnt;      /*2 if the driver can pan between two pages, else 1*/
+    uint32_t page_act;      /*The page being displayed*/
+    fb_damage_t damage[2];  /*The areas to copy to each page before showing it*/
+#endif
 } lv_linux_fb_t;
 
 /**********************
@@ -73,6 +90,12 @@ typedef struct {
 
 static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * color_p);
 static uint32_t tick_get_cb(void);
+static void display_release_cb(lv_event_t * e);
+#if LV_LINUX_FBDEV_PAGE_FLIP
+    static void page_flip_init(lv_linux_fb_t * dsc);
+    static void page_flip_flush(lv_display_t * disp, const lv_area_t * area, uint8_t * color_p);
+    static void damage_add(fb_damage_t * damage, const lv_area_t * area);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -90,6 +113,15 @@ static uint32_t tick_get_cb(void);
     #define DIV_ROUND_UP(n, d) (((n) + (d) - 1) / (d))
 #endif
 
+/*Page flipping needs the whole image in one buffer to copy the outdated areas from*/
+#if LV_LINUX_FBDEV_PAGE_FLIP
+    #define FBDEV_RENDER_MODE   LV_DISPLAY_RENDER_MODE_DIRECT
+    #define FBDEV_BUFFER_COUNT  1
+#else
+    #define FBDEV_RENDER_MODE   LV_LINUX_FBDEV_RENDER_MODE
+    #define FBDEV_BUFFER_COUNT  LV_LINUX_FBDEV_BUFFER_COUNT
+#endif
+
 /**********************
  *   GLOBAL FUNCTIONS
  **********************/
@@ -110,6 +142,7 @@ lv_display_t * lv_linux_fbdev_create(void)
     dsc->fbfd = -1;
     lv_display_set_driver_data(disp, dsc);
     lv_display_set_flush_cb(disp, flush_cb);
+    lv_display_add_event_cb(disp, display_release_cb, LV_EVENT_DELETE, disp);
 
     return disp;
 }
@@ -178,6 +211,10 @@ void lv_linux_fbdev_set_file(lv_display_t * disp, const char * file)
     }
 #endif /* LV_LINUX_FBDEV_BSD */
 
+#if LV_LINUX_FBDEV_PAGE_FLIP
+    page_flip_init(dsc);
+#endif
+
     LV_LOG_INFO("%dx%d, %dbpp", dsc->vinfo.xres, dsc->vinfo.yres, dsc->vinfo.bits_per_pixel);
 
     /* Figure out the size of the screen in bytes*/
@@ -214,23 +251,27 @@ void lv_linux_fbdev_set_file(lv_display_t * disp, const char * file)
     int32_t ver_res = dsc->vinfo.yres;
     int32_t width = dsc->vinfo.width;
     uint32_t draw_buf_size = hor_res * (dsc->vinfo.bits_per_pixel >> 3);
-    if(LV_LINUX_FBDEV_RENDER_MODE == LV_DISPLAY_RENDER_MODE_PARTIAL) {
+    if(FBDEV_RENDER_MODE == LV_DISPLAY_RENDER_MODE_PARTIAL) {
         draw_buf_size *= LV_LINUX_FBDEV_BUFFER_SIZE;
     }
     else {
         draw_buf_size *= ver_res;
     }
 
+    /*Keep the allocated pointers to free them and pass the aligned ones to LVGL*/
+    lv_color_format_t cf = lv_display_get_color_format(disp);
     uint8_t * draw_buf = NULL;
     uint8_t * draw_buf_2 = NULL;
-    draw_buf = malloc(draw_buf_size);
+    dsc->draw_buf = malloc(draw_buf_size + LV_DRAW_BUF_ALIGN - 1);
+    draw_buf = lv_draw_buf_align(dsc->draw_buf, cf);
 
-    if(LV_LINUX_FBDEV_BUFFER_COUNT == 2) {
-        draw_buf_2 = malloc(draw_buf_size);
+    if(FBDEV_BUFFER_COUNT == 2) {
+        dsc->draw_buf_2 = malloc(draw_buf_size + LV_DRAW_BUF_ALIGN - 1);
+        draw_buf_2 = lv_draw_buf_align(dsc->draw_buf_2, cf);
     }
 
     lv_display_set_resolution(disp, hor_res, ver_res);
-    lv_display_set_buffers(disp, draw_buf, draw_buf_2, draw_buf_size, LV_LINUX_FBDEV_RENDER_MODE);
+    lv_display_set_buffers(disp, draw_buf, draw_buf_2, draw_buf_size, FBDEV_RENDER_MODE);
 
     if(width > 0) {
         lv_display_set_dpi(disp, DIV_ROUND_UP(hor_res * 254, width * 10));
@@ -259,6 +300,11 @@ static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * colo
         return;
     }
 
+#if LV_LINUX_FBDEV_PAGE_FLIP
+    page_flip_flush(disp, area, color_p);
+    return;
+#endif
+
     int32_t w = lv_area_get_width(area);
     int32_t h = lv_area_get_height(area);
     lv_color_format_t cf = lv_display_get_color_format(disp);
@@ -348,6 +394,160 @@ static void flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * colo
     lv_display_flush_ready(disp);
 }
 
+#if LV_LINUX_FBDEV_PAGE_FLIP
+
+/**
+ * Try to make the virtual framebuffer twice as high as the screen to pan between two pages.
+ * If the driver doesn't support it only one page is used.
+ */
+static void page_flip_init(lv_linux_fb_t * dsc)
+{
+    dsc->page_cnt = 1;
+    dsc->page_act = 0;
+
+    /*Both pages need to get the whole image first*/
+    dsc->damage[0].full = true;
+    dsc->damage[1].full = true;
+
+#if LV_LINUX_FBDEV_BSD
+    LV_LOG_WARN("Page flipping is not supported on BSD. Copying the changed areas instead.");
+#else
+    struct fb_var_screeninfo vinfo = dsc->vinfo;
+    vinfo.yres_virtual = vinfo.yres * 2;
+    vinfo.yoffset = 0;
+    if(ioctl(dsc->fbfd, FBIOPUT_VSCREENINFO, &vinfo) == -1 ||
+       ioctl(dsc->fbfd, FBIOGET_VSCREENINFO, &dsc->vinfo) == -1 ||
+       ioctl(dsc->fbfd, FBIOGET_FSCREENINFO, &dsc->finfo) == -1) {
+        LV_LOG_WARN("Couldn't set a double height virtual framebuffer. Copying the changed areas instead.");
+        return;
+    }
+
+    if(dsc->finfo.ypanstep == 0 || dsc->vinfo.yres_virtual < dsc->vinfo.yres * 2 ||
+       dsc->finfo.smem_len < dsc->finfo.line_length * dsc->vinfo.yres * 2) {
+        LV_LOG_WARN("The framebuffer can't pan between two pages. Copying the changed areas instead.");
+        return;
+    }
+
+    dsc->page_cnt = 2;
+    LV_LOG_INFO("Page flipping is enabled");
+#endif /* LV_LINUX_FBDEV_BSD */
+}
+
+/**
+ * Collect the rendered areas and on the last one bring the hidden page up to date and show it.
+ * Only the areas which changed since the page was shown last time are copied.
+ */
+static void page_flip_flush(lv_display_t * disp, const lv_area_t * area, uint8_t * color_p)
+{
+    lv_linux_fb_t * dsc = lv_display_get_driver_data(disp);
+
+    /*Every page misses the new area until it's copied there*/
+    uint32_t i;
+    for(i = 0; i < dsc->page_cnt; i++) {
+        damage_add(&dsc->damage[i], area);
+    }
+
+    if(!lv_display_flush_is_last(disp)) {
+        lv_display_flush_ready(disp);
+        return;
+    }
+
+    /*With one page the displayed page is updated*/
+    uint32_t page = (dsc->page_act + 1) % dsc->page_cnt;
+    fb_damage_t * damage = &dsc->damage[page];
+
+    lv_area_t scr_area = {0, 0, (int32_t)dsc->vinfo.xres - 1, (int32_t)dsc->vinfo.yres - 1};
+    lv_area_t disp_area = {0, 0, lv_display_get_horizontal_resolution(disp) - 1, lv_display_get_vertical_resolution(disp) - 1};
+    if(!lv_area_intersect(&scr_area, &scr_area, &disp_area)) {
+        lv_display_flush_ready(disp);
+        return;
+    }
+
+    if(damage->full) {
+        damage->areas[0] = scr_area;
+        damage->cnt = 1;
+    }
+
+    uint32_t px_size = lv_color_format_get_size(lv_display_get_color_format(disp));
+    uint32_t src_stride = lv_display_get_buf_active(disp)->header.stride;
+    uint8_t * fbp = (uint8_t *)dsc->fbp + page * dsc->vinfo.yres * dsc->finfo.line_length;
+    for(i = 0; i < damage->cnt; i++) {
+        lv_area_t a;
+        if(!lv_area_intersect(&a, &damage->areas[i], &scr_area)) continue;
+
+        uint32_t w_bytes = lv_area_get_width(&a) * px_size;
+        uint8_t * dest = fbp + (a.x1 + dsc->vinfo.xoffset) * px_size + a.y1 * dsc->finfo.line_length;
+        const uint8_t * src = color_p + a.x1 * px_size + a.y1 * src_stride;
+        int32_t y;
+        for(y = a.y1; y <= a.y2; y++) {
+            lv_memcpy(dest, src, w_bytes);
+            dest += dsc->finfo.line_length;
+            src += src_stride;
+        }
+    }
+
+    damage->cnt = 0;
+    damage->full = false;
+
+    if(dsc->page_cnt > 1) {
+#if !LV_LINUX_FBDEV_BSD
+        dsc->vinfo.yoffset = page * dsc->vinfo.yres;
+        if(ioctl(dsc->fbfd, FBIOPAN_DISPLAY, &dsc->vinfo) == -1) {
+            perror("ioctl(FBIOPAN_DISPLAY)");
+        }
+#endif /* LV_LINUX_FBDEV_BSD */
+    }
+    else if(dsc->force_refresh) {
+        dsc->vinfo.activate |= FB_ACTIVATE_NOW | FB_ACTIVATE_FORCE;
+        if(ioctl(dsc->fbfd, FBIOPUT_VSCREENINFO, &(dsc->vinfo)) == -1) {
+            perror("Error setting var screen info");
+        }
+    }
+
+    dsc->page_act = page;
+    lv_display_flush_ready(disp);
+}
+
+static void damage_add(fb_damage_t * damage, const lv_area_t * area)
+{
+    if(damage->full) return;
+
+    /*Skip the area if it's already included*/
+    uint32_t i;
+    for(i = 0; i < damage->cnt; i++) {
+        if(lv_area_is_in(area, &damage->areas[i], 0)) return;
+    }
+
+    if(damage->cnt == LV_INV_BUF_SIZE) {
+        damage->full = true;
+        return;
+    }
+
+    damage->areas[damage->cnt] = *area;
+    damage->cnt++;
+}
+
+#endif /*LV_LINUX_FBDEV_PAGE_FLIP*/
+
+static void display_release_cb(lv_event_t * e)
+{
+    lv_display_t * disp = (lv_display_t *) lv_event_get_user_data(e);
+    lv_linux_fb_t * dsc = lv_display_get_driver_data(disp);
+    if(dsc == NULL) return;
+
+    lv_display_set_driver_data(disp, NULL);
+    lv_display_set_flush_cb(disp, NULL);
+
+    if(dsc->fbp) munmap(dsc->fbp, dsc->screensize);
+    if(dsc->fbfd >= 0) close(dsc->fbfd);
+
+    free(dsc->draw_buf);
+    free(dsc->draw_buf_2);
+    free(dsc->rotated_buf);
+    lv_free((void *)dsc->devname);
+    lv_free(dsc);
+}
+
 static uint32_t tick_get_cb(void)
 {
     struct timespec t;
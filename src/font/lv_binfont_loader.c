@@ -121,6 +121,11 @@ void lv_binfont_destroy(lv_font_t * font)
     const lv_font_fmt_txt_dsc_t * dsc = font->dsc;
     if(dsc == NULL) return;
 
+#if LV_FONT_FMT_TXT_CACHE_CNT
+    /*The cached glyphs are identified by the font's address which can be reused later*/
+    lv_font_fmt_txt_cache_drop_all();
+#endif
+
     if(dsc->kern_classes == 0) {
         const lv_font_fmt_txt_kern_pair_t * kern_dsc = dsc->kern_dsc;
         if(NULL != kern_dsc) {
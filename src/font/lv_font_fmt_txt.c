@@ -13,7 +13,9 @@
 #include "../misc/lv_types.h"
 #include "../misc/lv_log.h"
 #include "../misc/lv_utils.h"
+#include "../misc/cache/lv_cache.h"
 #include "../stdlib/lv_mem.h"
+#include "../stdlib/lv_string.h"
 
 /*********************
  *      DEFINES
@@ -22,6 +24,10 @@
     #define font_rle LV_GLOBAL_DEFAULT()->font_fmt_rle
 #endif /*LV_USE_FONT_COMPRESSED*/
 
+#if LV_FONT_FMT_TXT_CACHE_CNT
+    #define fmt_txt_cache LV_GLOBAL_DEFAULT()->font_fmt_txt_cache
+#endif /*LV_FONT_FMT_TXT_CACHE_CNT*/
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -30,15 +36,37 @@ typedef struct {
     uint32_t gid_right;
 } kern_pair_ref_t;
 
+#if LV_FONT_FMT_TXT_CACHE_CNT
+typedef struct {
+    const lv_font_t * font;
+    uint32_t gid;
+    uint32_t bpp;
+    uint8_t * bitmap;
+    uint32_t bitmap_size;
+} bitmap_cache_data_t;
+#endif /*LV_FONT_FMT_TXT_CACHE_CNT*/
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter);
+static bool decode_bitmap(const lv_font_fmt_txt_dsc_t * fdsc, const lv_font_fmt_txt_glyph_dsc_t * gdsc,
+                          uint8_t * bitmap_out);
 static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t gid_right);
 static int unicode_list_compare(const void * ref, const void * element);
 static int kern_pair_8_compare(const void * ref, const void * element);
 static int kern_pair_16_compare(const void * ref, const void * element);
 
+#if LV_FONT_FMT_TXT_CACHE_CNT
+    static bool bitmap_cache_get(const lv_font_t * font, uint32_t gid, uint8_t * bitmap_out);
+    static bool bitmap_cache_create_cb(bitmap_cache_data_t * node, void * user_data);
+    static void bitmap_cache_free_cb(bitmap_cache_data_t * node, void * user_data);
+    static lv_cache_compare_res_t bitmap_cache_compare_cb(const bitmap_cache_data_t * lhs,
+                                                          const bitmap_cache_data_t * rhs);
+    static bool gid_cache_get(const lv_font_t * font, uint32_t letter, uint32_t * gid);
+    static void gid_cache_set(const lv_font_t * font, uint32_t letter, uint32_t gid);
+#endif /*LV_FONT_FMT_TXT_CACHE_CNT*/
+
 #if LV_USE_FONT_COMPRESSED
     static void decompress(const uint8_t * in, uint8_t * out, int32_t w, int32_t h, uint8_t bpp, bool prefilter);
     static inline void decompress_line(uint8_t * out, int32_t w);
@@ -78,7 +106,6 @@ static const uint8_t opa2_table[4] = {0, 85, 170, 255};
 const void * lv_font_get_bitmap_fmt_txt(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf_t * draw_buf)
 {
     const lv_font_t * font = g_dsc->resolved_font;
-    uint8_t * bitmap_out = draw_buf->data;
 
     lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
     uint32_t gid = g_dsc->gid.index;
@@ -91,6 +118,200 @@ const void * lv_font_get_bitmap_fmt_txt(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf
     int32_t gsize = (int32_t) gdsc->box_w * gdsc->box_h;
     if(gsize == 0) return NULL;
 
+#if LV_FONT_FMT_TXT_CACHE_CNT
+    /*If the cache can't be used (e.g. out of memory) decode the glyph directly*/
+    if(bitmap_cache_get(font, gid, draw_buf->data)) return draw_buf;
+#endif
+
+    if(!decode_bitmap(fdsc, gdsc, draw_buf->data)) return NULL;
+    return draw_buf;
+}
+
+bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter,
+                                   uint32_t unicode_letter_next)
+{
+    /*It fixes a strange compiler optimization issue: https://github.com/lvgl/lvgl/issues/4370*/
+    bool is_tab = unicode_letter == '\t';
+    if(is_tab) {
+        unicode_letter = ' ';
+    }
+    lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
+    uint32_t gid = get_glyph_dsc_id(font, unicode_letter);
+    if(!gid) return false;
+
+    int8_t kvalue = 0;
+    if(fdsc->kern_dsc) {
+        uint32_t gid_next = get_glyph_dsc_id(font, unicode_letter_next);
+        if(gid_next) {
+            kvalue = get_kern_value(font, gid, gid_next);
+        }
+    }
+
+    /*Put together a glyph dsc*/
+    const lv_font_fmt_txt_glyph_dsc_t * gdsc = &fdsc->glyph_dsc[gid];
+
+    int32_t kv = ((int32_t)((int32_t)kvalue * fdsc->kern_scale) >> 4);
+
+    uint32_t adv_w = gdsc->adv_w;
+    if(is_tab) adv_w *= 2;
+
+    adv_w += kv;
+    adv_w  = (adv_w + (1 << 3)) >> 4;
+
+    dsc_out->adv_w = adv_w;
+    dsc_out->box_h = gdsc->box_h;
+    dsc_out->box_w = gdsc->box_w;
+    dsc_out->ofs_x = gdsc->ofs_x;
+    dsc_out->ofs_y = gdsc->ofs_y;
+    dsc_out->format = (uint8_t)fdsc->bpp;
+    if(fdsc->bitmap_format == LV_FONT_FMT_PLAIN_ALIGNED) {
+        /*Offset in the enum to the ALIGNED values */
+        dsc_out->format += LV_FONT_GLYPH_FORMAT_A1_ALIGNED - LV_FONT_GLYPH_FORMAT_A1;
+    }
+    dsc_out->is_placeholder = false;
+    dsc_out->gid.index = gid;
+
+    if(is_tab) dsc_out->box_w = dsc_out->box_w * 2;
+
+    return true;
+}
+
+#if LV_FONT_FMT_TXT_CACHE_CNT
+
+void lv_font_fmt_txt_cache_init(void)
+{
+    lv_memzero(&fmt_txt_cache, sizeof(lv_font_fmt_txt_cache_t));
+
+    fmt_txt_cache.bitmap_cache = lv_cache_create(&lv_cache_class_lru_rb_count, sizeof(bitmap_cache_data_t),
+                                                 LV_FONT_FMT_TXT_CACHE_CNT, (lv_cache_ops_t) {
+        .compare_cb = (lv_cache_compare_cb_t)bitmap_cache_compare_cb,
+        .create_cb = (lv_cache_create_cb_t)bitmap_cache_create_cb,
+        .free_cb = (lv_cache_free_cb_t)bitmap_cache_free_cb
+    });
+    lv_cache_set_name(fmt_txt_cache.bitmap_cache, "FONT_FMT_TXT_BITMAP");
+
+#if LV_USE_OS
+    lv_mutex_init(&fmt_txt_cache.gid_cache_lock);
+#endif
+}
+
+void lv_font_fmt_txt_cache_deinit(void)
+{
+    if(fmt_txt_cache.bitmap_cache) {
+        lv_cache_destroy(fmt_txt_cache.bitmap_cache, NULL);
+        fmt_txt_cache.bitmap_cache = NULL;
+    }
+
+#if LV_USE_OS
+    lv_mutex_delete(&fmt_txt_cache.gid_cache_lock);
+#endif
+}
+
+void lv_font_fmt_txt_cache_get_stats(lv_font_fmt_txt_cache_stats_t * stats)
+{
+    LV_ASSERT_NULL(stats);
+    *stats = fmt_txt_cache.stats;
+}
+
+void lv_font_fmt_txt_cache_reset_stats(void)
+{
+    lv_memzero(&fmt_txt_cache.stats, sizeof(fmt_txt_cache.stats));
+}
+
+void lv_font_fmt_txt_cache_drop_all(void)
+{
+    if(fmt_txt_cache.bitmap_cache) lv_cache_drop_all(fmt_txt_cache.bitmap_cache, NULL);
+
+#if LV_USE_OS
+    lv_mutex_lock(&fmt_txt_cache.gid_cache_lock);
+#endif
+    lv_memzero(fmt_txt_cache.gid_cache, sizeof(fmt_txt_cache.gid_cache));
+#if LV_USE_OS
+    lv_mutex_unlock(&fmt_txt_cache.gid_cache_lock);
+#endif
+}
+
+#endif /*LV_FONT_FMT_TXT_CACHE_CNT*/
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
+{
+    if(letter == '\0') return 0;
+
+    lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
+
+    uint16_t i;
+    for(i = 0; i < fdsc->cmap_num; i++) {
+
+        /*Relative code point*/
+        uint32_t rcp = letter - fdsc->cmaps[i].range_start;
+        if(rcp >= fdsc->cmaps[i].range_length) continue;
+        uint32_t glyph_id = 0;
+
+#if LV_FONT_FMT_TXT_CACHE_CNT
+        /*Only the binary search of the sparse cmaps is slower than the cache*/
+        bool sparse = fdsc->cmaps[i].type == LV_FONT_FMT_TXT_CMAP_SPARSE_TINY ||
+                      fdsc->cmaps[i].type == LV_FONT_FMT_TXT_CMAP_SPARSE_FULL;
+        if(sparse && gid_cache_get(font, letter, &glyph_id)) return glyph_id;
+#endif
+
+        if(fdsc->cmaps[i].type == LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY) {
+            glyph_id = fdsc->cmaps[i].glyph_id_start + rcp;
+        }
+        else if(fdsc->cmaps[i].type == LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL) {
+            const uint8_t * gid_ofs_8 = fdsc->cmaps[i].glyph_id_ofs_list;
+            /* The first character is always valid and should have offset = 0
+             * However if a character is missing it also has offset=0.
+             * So if there is a 0 not on the first position then it's a missing character */
+            if(gid_ofs_8[rcp] == 0 && letter != fdsc->cmaps[i].range_start) continue;
+            glyph_id = fdsc->cmaps[i].glyph_id_start + gid_ofs_8[rcp];
+        }
+        else if(fdsc->cmaps[i].type == LV_FONT_FMT_TXT_CMAP_SPARSE_TINY) {
+            uint16_t key = rcp;
+            uint16_t * p = lv_utils_bsearch(&key, fdsc->cmaps[i].unicode_list, fdsc->cmaps[i].list_length,
+                                            sizeof(fdsc->cmaps[i].unicode_list[0]), unicode_list_compare);
+
+            if(p) {
+                lv_uintptr_t ofs = p - fdsc->cmaps[i].unicode_list;
+                glyph_id = fdsc->cmaps[i].glyph_id_start + (uint32_t) ofs;
+            }
+        }
+        else if(fdsc->cmaps[i].type == LV_FONT_FMT_TXT_CMAP_SPARSE_FULL) {
+            uint16_t key = rcp;
+            uint16_t * p = lv_utils_bsearch(&key, fdsc->cmaps[i].unicode_list, fdsc->cmaps[i].list_length,
+                                            sizeof(fdsc->cmaps[i].unicode_list[0]), unicode_list_compare);
+
+            if(p) {
+                lv_uintptr_t ofs = p - fdsc->cmaps[i].unicode_list;
+                const uint16_t * gid_ofs_16 = fdsc->cmaps[i].glyph_id_ofs_list;
+                glyph_id = fdsc->cmaps[i].glyph_id_start + gid_ofs_16[ofs];
+            }
+        }
+
+#if LV_FONT_FMT_TXT_CACHE_CNT
+        if(sparse) gid_cache_set(font, letter, glyph_id);
+#endif
+
+        return glyph_id;
+    }
+
+    return 0;
+
+}
+
+/**
+ * Decode the bitmap of a glyph to A8 format
+ * @param fdsc          the font's descriptor
+ * @param gdsc          the glyph's descriptor
+ * @param bitmap_out    store the A8 bitmap here with `lv_draw_buf_width_to_stride(box_w, LV_COLOR_FORMAT_A8)` stride
+ * @return              true: successfully decoded; false: the glyph can't be decoded
+ */
+static bool decode_bitmap(const lv_font_fmt_txt_dsc_t * fdsc, const lv_font_fmt_txt_glyph_dsc_t * gdsc,
+                          uint8_t * bitmap_out)
+{
     bool byte_aligned = fdsc->bitmap_format == LV_FONT_FMT_PLAIN_ALIGNED;
 
     if(fdsc->bitmap_format == LV_FONT_FMT_TXT_PLAIN || fdsc->bitmap_format == LV_FONT_FMT_PLAIN_ALIGNED) {
@@ -180,7 +401,7 @@ const void * lv_font_get_bitmap_fmt_txt(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf
                 bitmap_out_tmp += stride;
             }
         }
-        return draw_buf;
+        return true;
     }
     /*Handle compressed bitmap*/
     else {
@@ -188,123 +409,151 @@ const void * lv_font_get_bitmap_fmt_txt(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf
         bool prefilter = fdsc->bitmap_format == LV_FONT_FMT_TXT_COMPRESSED;
         decompress(&fdsc->glyph_bitmap[gdsc->bitmap_index], bitmap_out, gdsc->box_w, gdsc->box_h,
                    (uint8_t)fdsc->bpp, prefilter);
-        return draw_buf;
+        return true;
 #else /*!LV_USE_FONT_COMPRESSED*/
         LV_LOG_WARN("Compressed fonts is used but LV_USE_FONT_COMPRESSED is not enabled in lv_conf.h");
-        return NULL;
+        return false;
 #endif
     }
 
     /*If not returned earlier then the letter is not found in this font*/
-    return NULL;
+    return false;
 }
 
-bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter,
-                                   uint32_t unicode_letter_next)
+#if LV_FONT_FMT_TXT_CACHE_CNT
+
+/**
+ * Copy the decoded bitmap of a glyph from the cache, decode and add it to the cache if it's not there yet.
+ * @param font          pointer to a fmt_txt font
+ * @param gid           the glyph id
+ * @param bitmap_out    copy the A8 bitmap here
+ * @return              false if the cache couldn't be used
+ */
+static bool bitmap_cache_get(const lv_font_t * font, uint32_t gid, uint8_t * bitmap_out)
 {
-    /*It fixes a strange compiler optimization issue: https://github.com/lvgl/lvgl/issues/4370*/
-    bool is_tab = unicode_letter == '\t';
-    if(is_tab) {
-        unicode_letter = ' ';
+    lv_cache_t * cache = fmt_txt_cache.bitmap_cache;
+    if(cache == NULL) return false;
+
+    const lv_font_fmt_txt_dsc_t * fdsc = font->dsc;
+    bitmap_cache_data_t search_key = {
+        .font = font,
+        .gid = gid,
+        .bpp = fdsc->bpp,
+    };
+
+    lv_cache_entry_t * entry = lv_cache_acquire(cache, &search_key, NULL);
+    if(entry) {
+        fmt_txt_cache.stats.bitmap_hit++;
     }
-    lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
-    uint32_t gid = get_glyph_dsc_id(font, unicode_letter);
-    if(!gid) return false;
-
-    int8_t kvalue = 0;
-    if(fdsc->kern_dsc) {
-        uint32_t gid_next = get_glyph_dsc_id(font, unicode_letter_next);
-        if(gid_next) {
-            kvalue = get_kern_value(font, gid, gid_next);
-        }
+    else {
+        entry = lv_cache_acquire_or_create(cache, &search_key, NULL);
+        if(entry == NULL) return false;
+        fmt_txt_cache.stats.bitmap_miss++;
     }
 
-    /*Put together a glyph dsc*/
-    const lv_font_fmt_txt_glyph_dsc_t * gdsc = &fdsc->glyph_dsc[gid];
+    /*Copy the bitmap to be independent of the lifetime of the cache entry*/
+    const bitmap_cache_data_t * data = lv_cache_entry_get_data(entry);
+    lv_memcpy(bitmap_out, data->bitmap, data->bitmap_size);
+    lv_cache_release(cache, entry, NULL);
 
-    int32_t kv = ((int32_t)((int32_t)kvalue * fdsc->kern_scale) >> 4);
+    return true;
+}
 
-    uint32_t adv_w = gdsc->adv_w;
-    if(is_tab) adv_w *= 2;
+static bool bitmap_cache_create_cb(bitmap_cache_data_t * node, void * user_data)
+{
+    LV_UNUSED(user_data);
 
-    adv_w += kv;
-    adv_w  = (adv_w + (1 << 3)) >> 4;
+    const lv_font_fmt_txt_dsc_t * fdsc = node->font->dsc;
+    const lv_font_fmt_txt_glyph_dsc_t * gdsc = &fdsc->glyph_dsc[node->gid];
 
-    dsc_out->adv_w = adv_w;
-    dsc_out->box_h = gdsc->box_h;
-    dsc_out->box_w = gdsc->box_w;
-    dsc_out->ofs_x = gdsc->ofs_x;
-    dsc_out->ofs_y = gdsc->ofs_y;
-    dsc_out->format = (uint8_t)fdsc->bpp;
-    if(fdsc->bitmap_format == LV_FONT_FMT_PLAIN_ALIGNED) {
-        /*Offset in the enum to the ALIGNED values */
-        dsc_out->format += LV_FONT_GLYPH_FORMAT_A1_ALIGNED - LV_FONT_GLYPH_FORMAT_A1;
+    node->bitmap_size = lv_draw_buf_width_to_stride(gdsc->box_w, LV_COLOR_FORMAT_A8) * gdsc->box_h;
+    node->bitmap = lv_malloc(node->bitmap_size);
+    if(node->bitmap == NULL) {
+        LV_LOG_WARN("Couldn't allocate %" LV_PRIu32 " bytes for a glyph", node->bitmap_size);
+        return false;
     }
-    dsc_out->is_placeholder = false;
-    dsc_out->gid.index = gid;
 
-    if(is_tab) dsc_out->box_w = dsc_out->box_w * 2;
+    if(!decode_bitmap(fdsc, gdsc, node->bitmap)) {
+        lv_free(node->bitmap);
+        node->bitmap = NULL;
+        return false;
+    }
 
     return true;
 }
 
-/**********************
- *   STATIC FUNCTIONS
- **********************/
+static void bitmap_cache_free_cb(bitmap_cache_data_t * node, void * user_data)
+{
+    LV_UNUSED(user_data);
 
-static uint32_t get_glyph_dsc_id(const lv_font_t * font, uint32_t letter)
+    lv_free(node->bitmap);
+    node->bitmap = NULL;
+}
+
+static lv_cache_compare_res_t bitmap_cache_compare_cb(const bitmap_cache_data_t * lhs,
+                                                      const bitmap_cache_data_t * rhs)
 {
-    if(letter == '\0') return 0;
+    if(lhs->font != rhs->font) {
+        return lhs->font > rhs->font ? 1 : -1;
+    }
 
-    lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
+    if(lhs->gid != rhs->gid) {
+        return lhs->gid > rhs->gid ? 1 : -1;
+    }
 
-    uint16_t i;
-    for(i = 0; i < fdsc->cmap_num; i++) {
+    if(lhs->bpp != rhs->bpp) {
+        return lhs->bpp > rhs->bpp ? 1 : -1;
+    }
 
-        /*Relative code point*/
-        uint32_t rcp = letter - fdsc->cmaps[i].range_start;
-        if(rcp >= fdsc->cmaps[i].range_length) continue;
-        uint32_t glyph_id = 0;
-        if(fdsc->cmaps[i].type == LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY) {
-            glyph_id = fdsc->cmaps[i].glyph_id_start + rcp;
-        }
-        else if(fdsc->cmaps[i].type == LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL) {
-            const uint8_t * gid_ofs_8 = fdsc->cmaps[i].glyph_id_ofs_list;
-            /* The first character is always valid and should have offset = 0
-             * However if a character is missing it also has offset=0.
-             * So if there is a 0 not on the first position then it's a missing character */
-            if(gid_ofs_8[rcp] == 0 && letter != fdsc->cmaps[i].range_start) continue;
-            glyph_id = fdsc->cmaps[i].glyph_id_start + gid_ofs_8[rcp];
-        }
-        else if(fdsc->cmaps[i].type == LV_FONT_FMT_TXT_CMAP_SPARSE_TINY) {
-            uint16_t key = rcp;
-            uint16_t * p = lv_utils_bsearch(&key, fdsc->cmaps[i].unicode_list, fdsc->cmaps[i].list_length,
-                                            sizeof(fdsc->cmaps[i].unicode_list[0]), unicode_list_compare);
+    return 0;
+}
 
-            if(p) {
-                lv_uintptr_t ofs = p - fdsc->cmaps[i].unicode_list;
-                glyph_id = fdsc->cmaps[i].glyph_id_start + (uint32_t) ofs;
-            }
-        }
-        else if(fdsc->cmaps[i].type == LV_FONT_FMT_TXT_CMAP_SPARSE_FULL) {
-            uint16_t key = rcp;
-            uint16_t * p = lv_utils_bsearch(&key, fdsc->cmaps[i].unicode_list, fdsc->cmaps[i].list_length,
-                                            sizeof(fdsc->cmaps[i].unicode_list[0]), unicode_list_compare);
+static inline uint32_t gid_cache_index(const lv_font_t * font, uint32_t letter)
+{
+    uint32_t h = (uint32_t)((lv_uintptr_t)font >> 4) ^ (letter * 2654435761u);
+    return (h ^ (h >> 16)) & (LV_FONT_FMT_TXT_GID_CACHE_CNT - 1);
+}
 
-            if(p) {
-                lv_uintptr_t ofs = p - fdsc->cmaps[i].unicode_list;
-                const uint16_t * gid_ofs_16 = fdsc->cmaps[i].glyph_id_ofs_list;
-                glyph_id = fdsc->cmaps[i].glyph_id_start + gid_ofs_16[ofs];
-            }
-        }
+static bool gid_cache_get(const lv_font_t * font, uint32_t letter, uint32_t * gid)
+{
+    bool found = false;
+    lv_font_fmt_txt_gid_cache_entry_t * e = &fmt_txt_cache.gid_cache[gid_cache_index(font, letter)];
 
-        return glyph_id;
+#if LV_USE_OS
+    lv_mutex_lock(&fmt_txt_cache.gid_cache_lock);
+#endif
+    if(e->font == font && e->letter == letter) {
+        *gid = e->gid;
+        found = true;
+        fmt_txt_cache.stats.gid_hit++;
+    }
+    else {
+        fmt_txt_cache.stats.gid_miss++;
     }
+#if LV_USE_OS
+    lv_mutex_unlock(&fmt_txt_cache.gid_cache_lock);
+#endif
 
-    return 0;
+    return found;
+}
+
+static void gid_cache_set(const lv_font_t * font, uint32_t letter, uint32_t gid)
+{
+    lv_font_fmt_txt_gid_cache_entry_t * e = &fmt_txt_cache.gid_cache[gid_cache_index(font, letter)];
 
+#if LV_USE_OS
+    lv_mutex_lock(&fmt_txt_cache.gid_cache_lock);
+#endif
+    e->font = font;
+    e->letter = letter;
+    e->gid = gid;
+#if LV_USE_OS
+    lv_mutex_unlock(&fmt_txt_cache.gid_cache_lock);
+#endif
 }
 
+#endif /*LV_FONT_FMT_TXT_CACHE_CNT*/
+
 static int8_t get_kern_value(const lv_font_t * font, uint32_t gid_left, uint32_t gid_right)
 {
     lv_font_fmt_txt_dsc_t * fdsc = (lv_font_fmt_txt_dsc_t *)font->dsc;
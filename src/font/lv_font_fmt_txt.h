@@ -186,6 +186,14 @@ typedef struct {
     uint16_t bitmap_format  : 2;
 } lv_font_fmt_txt_dsc_t;
 
+/** Hit/miss counters of the glyph caches of the fmt_txt fonts (see `LV_FONT_FMT_TXT_CACHE_CNT`) */
+typedef struct {
+    uint32_t bitmap_hit;    /**< Glyph bitmaps found in the cache */
+    uint32_t bitmap_miss;   /**< Glyph bitmaps decoded and added to the cache */
+    uint32_t gid_hit;       /**< Glyph ids found in the letter -> glyph id cache */
+    uint32_t gid_miss;      /**< Glyph ids searched in the cmaps */
+} lv_font_fmt_txt_cache_stats_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -210,6 +218,28 @@ const void * lv_font_get_bitmap_fmt_txt(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf
 bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t * dsc_out, uint32_t unicode_letter,
                                    uint32_t unicode_letter_next);
 
+#if LV_FONT_FMT_TXT_CACHE_CNT
+
+/**
+ * Get the hit/miss statistics of the glyph caches of the fmt_txt fonts.
+ * @param stats     store the statistics here
+ */
+void lv_font_fmt_txt_cache_get_stats(lv_font_fmt_txt_cache_stats_t * stats);
+
+/**
+ * Reset the hit/miss statistics of the glyph caches.
+ */
+void lv_font_fmt_txt_cache_reset_stats(void);
+
+/**
+ * Remove all the cached glyphs of the fmt_txt fonts.
+ * Needs to be called before freeing a dynamically created font (e.g. by `lv_binfont_destroy()`)
+ * as the cached data is identified by the address of the font.
+ */
+void lv_font_fmt_txt_cache_drop_all(void);
+
+#endif /*LV_FONT_FMT_TXT_CACHE_CNT*/
+
 /**********************
  *      MACROS
  **********************/
@@ -15,6 +15,7 @@ extern "C" {
  *********************/
 
 #include "lv_font_fmt_txt.h"
+#include "../osal/lv_os.h"
 
 /*********************
  *      DEFINES
@@ -41,10 +42,39 @@ typedef struct {
 } lv_font_fmt_rle_t;
 #endif
 
+#if LV_FONT_FMT_TXT_CACHE_CNT
+typedef struct {
+    const lv_font_t * font;
+    uint32_t letter;
+    uint32_t gid;
+} lv_font_fmt_txt_gid_cache_entry_t;
+
+typedef struct {
+    lv_cache_t * bitmap_cache;  /**< Decoded A8 glyph bitmaps keyed by font, glyph id and bpp*/
+    lv_font_fmt_txt_gid_cache_entry_t gid_cache[LV_FONT_FMT_TXT_GID_CACHE_CNT]; /**< Direct mapped letter -> glyph id*/
+#if LV_USE_OS
+    lv_mutex_t gid_cache_lock;
+#endif
+    lv_font_fmt_txt_cache_stats_t stats;
+} lv_font_fmt_txt_cache_t;
+#endif
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 
+#if LV_FONT_FMT_TXT_CACHE_CNT
+/**
+ * Create the glyph caches of the fmt_txt fonts. Called by `lv_init()`.
+ */
+void lv_font_fmt_txt_cache_init(void);
+
+/**
+ * Free the glyph caches of the fmt_txt fonts. Called by `lv_deinit()`.
+ */
+void lv_font_fmt_txt_cache_deinit(void);
+#endif
+
 /**********************
  *      MACROS
  **********************/
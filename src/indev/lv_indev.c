@@ -16,6 +16,7 @@
 #include "../display/lv_display_private.h"
 #include "../core/lv_global.h"
 #include "../core/lv_obj_private.h"
+#include "../core/lv_obj_hit_index_private.h"
 #include "../core/lv_group.h"
 #include "../core/lv_refr.h"
 
@@ -600,6 +601,19 @@ lv_obj_t * lv_indev_search_obj(lv_obj_t * obj, lv_point_t * point)
         int32_t i;
         uint32_t child_cnt = lv_obj_get_child_count(obj);
 
+#if LV_OBJ_HIT_INDEX_MIN_CHILD_CNT
+        /*Check only the children which can be at the point*/
+        lv_obj_hit_index_iter_t iter;
+        if(lv_obj_hit_index_iter_init(obj, &p_trans, &iter)) {
+            while((i = lv_obj_hit_index_iter_next(&iter)) >= 0) {
+                lv_obj_t * child = obj->spec_attr->children[i];
+                found_p = lv_indev_search_obj(child, &p_trans);
+                if(found_p) return found_p;
+            }
+            child_cnt = 0;
+        }
+#endif
+
         /*If a child matches use it*/
         for(i = child_cnt - 1; i >= 0; i--) {
             lv_obj_t * child = obj->spec_attr->children[i];
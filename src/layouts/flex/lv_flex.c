@@ -7,7 +7,7 @@
  *      INCLUDES
  *********************/
 #include "lv_flex.h"
-#include "../lv_layout.h"
+#include "../lv_layout_private.h"
 #include "../../core/lv_obj_private.h"
 
 #if LV_USE_FLEX
@@ -28,6 +28,9 @@ typedef struct {
     uint8_t row : 1;
     uint8_t wrap : 1;
     uint8_t rev : 1;
+#if LV_LAYOUT_CACHE_MIN_CHILD_CNT
+    lv_layout_cache_t * cache;  /**< Use the measurements from here if not NULL*/
+#endif
 } flex_t;
 
 typedef struct {
@@ -64,8 +67,19 @@ static void children_repos(lv_obj_t * cont, flex_t * f, int32_t item_first_id, i
 static void place_content(lv_flex_align_t place, int32_t max_size, int32_t content_size, int32_t item_cnt,
                           int32_t * start_pos, int32_t * gap);
 static lv_obj_t * get_next_item(lv_obj_t * cont, bool rev, int32_t * item_id);
-static int32_t lv_obj_get_width_with_margin(const lv_obj_t * obj);
-static int32_t lv_obj_get_height_with_margin(const lv_obj_t * obj);
+static void move_item(lv_obj_t * item, int32_t diff_x, int32_t diff_y);
+static int32_t get_main_size(const flex_t * f, const lv_obj_t * item, int32_t item_id);
+static int32_t get_cross_size(const flex_t * f, const lv_obj_t * item, int32_t item_id);
+static int32_t get_margin(const flex_t * f, const lv_obj_t * item, int32_t item_id, bool main_axis, bool end);
+static uint8_t get_grow(const flex_t * f, const lv_obj_t * item, int32_t item_id);
+static int32_t get_min_size(const flex_t * f, const lv_obj_t * item, int32_t item_id);
+static int32_t get_max_size(const flex_t * f, const lv_obj_t * item, int32_t item_id);
+static void get_translate(const flex_t * f, const lv_obj_t * item, int32_t item_id, int32_t * tr_x, int32_t * tr_y);
+#if LV_LAYOUT_CACHE_MIN_CHILD_CNT
+    static void measure_cb(lv_obj_t * item, lv_layout_cache_item_t * rec, void * user_data);
+    static int32_t find_dirty_track(const lv_layout_cache_t * cache, int32_t first_dirty);
+    static void shift_tracks(lv_obj_t * cont, const flex_t * f, int32_t track_first_item, int32_t diff);
+#endif
 
 /**********************
  *  GLOBAL VARIABLES
@@ -165,6 +179,23 @@ static void flex_update(lv_obj_t * cont, void * user_data)
         else if(track_cross_place == LV_FLEX_ALIGN_END) track_cross_place = LV_FLEX_ALIGN_START;
     }
 
+#if LV_LAYOUT_CACHE_MIN_CHILD_CNT
+    /*The tracks can be cached only if a track's position doesn't depend on the later tracks*/
+    int32_t first_dirty = -1;
+    bool cache_tracks = false;
+    f.cache = lv_layout_cache_get(cont, LV_LAYOUT_FLEX);
+    if(f.cache) {
+        first_dirty = lv_layout_cache_update_items(cont, f.cache, measure_cb, &f);
+        cache_tracks = !f.rev && track_cross_place == LV_FLEX_ALIGN_START;
+
+        /*Removing or adding children can change the last track even if no child has changed*/
+        if(f.cache->item_cnt != f.cache->solved_cnt) {
+            int32_t last_id = (int32_t)f.cache->item_cnt - 1;
+            if(first_dirty < 0 || first_dirty > last_id) first_dirty = last_id;
+        }
+    }
+#endif
+
     int32_t total_track_cross_size = 0;
     int32_t gap = 0;
     uint32_t track_cnt = 0;
@@ -196,6 +227,24 @@ static void flex_update(lv_obj_t * cont, void * user_data)
         *cross_pos += total_track_cross_size;
     }
 
+#if LV_LAYOUT_CACHE_MIN_CHILD_CNT
+    int32_t cross_start = *cross_pos;
+    int32_t old_track_first_item = 0;
+    bool reuse_tracks = cache_tracks && f.cache->solved;
+    if(reuse_tracks) {
+        if(first_dirty < 0) {
+            /*Nothing has changed so all children are already in place*/
+            track_first_item = (int32_t)cont->spec_attr->child_cnt;
+        }
+        else {
+            /*The tracks before the first changed child are not affected*/
+            track_first_item = find_dirty_track(f.cache, first_dirty);
+            old_track_first_item = track_first_item;
+            *cross_pos += f.cache->items[track_first_item].track_pos;
+        }
+    }
+#endif
+
     while(track_first_item < (int32_t)cont->spec_attr->child_cnt && track_first_item >= 0) {
         track_t t;
         t.grow_dsc_calc = 1;
@@ -206,6 +255,28 @@ static void flex_update(lv_obj_t * cont, void * user_data)
             *cross_pos -= t.track_cross_size;
         }
         children_repos(cont, &f, track_first_item, next_track_first_item, abs_x, abs_y, max_main_size, item_gap, &t);
+
+#if LV_LAYOUT_CACHE_MIN_CHILD_CNT
+        if(f.cache) {
+            int32_t id;
+            for(id = track_first_item; id != next_track_first_item; id += f.rev ? -1 : 1) {
+                lv_layout_cache_item_placed(f.cache, (uint32_t)id);
+            }
+        }
+
+        if(cache_tracks) {
+            lv_layout_cache_item_t * items = f.cache->items;
+            /*Step over the old tracks covered by this track before overwriting them*/
+            while(reuse_tracks && old_track_first_item < next_track_first_item &&
+                  old_track_first_item < (int32_t)f.cache->solved_cnt) {
+                old_track_first_item = items[old_track_first_item].track_end;
+            }
+
+            items[track_first_item].track_end = next_track_first_item;
+            items[track_first_item].track_pos = *cross_pos - cross_start;
+        }
+#endif
+
         track_first_item = next_track_first_item;
         lv_free(t.grow_dsc);
         t.grow_dsc = NULL;
@@ -215,9 +286,28 @@ static void flex_update(lv_obj_t * cont, void * user_data)
         else {
             *cross_pos += t.track_cross_size + gap + track_gap;
         }
+
+#if LV_LAYOUT_CACHE_MIN_CHILD_CNT
+        /*If the next track starts where it started last time and there are no more changed children
+         *the rest of the tracks are the same, only their position might be different*/
+        if(reuse_tracks && f.cache->dirty_cnt == 0 && old_track_first_item == track_first_item &&
+           track_first_item < (int32_t)f.cache->solved_cnt &&
+           track_first_item < (int32_t)cont->spec_attr->child_cnt) {
+            shift_tracks(cont, &f, track_first_item,
+                         *cross_pos - cross_start - f.cache->items[track_first_item].track_pos);
+            break;
+        }
+#endif
     }
     LV_ASSERT_MEM_INTEGRITY();
 
+#if LV_LAYOUT_CACHE_MIN_CHILD_CNT
+    if(f.cache) {
+        f.cache->solved = cache_tracks;
+        f.cache->solved_cnt = f.cache->item_cnt;
+    }
+#endif
+
     if(w_set == LV_SIZE_CONTENT || h_set == LV_SIZE_CONTENT) {
         lv_obj_refr_size(cont);
     }
@@ -240,9 +330,6 @@ static int32_t find_track_end(lv_obj_t * cont, flex_t * f, int32_t item_start_id
     if(f->wrap && ((f->row && w_set == LV_SIZE_CONTENT) || (!f->row && h_set == LV_SIZE_CONTENT))) {
         f->wrap = false;
     }
-    int32_t(*get_main_size)(const lv_obj_t *) = (f->row ? lv_obj_get_width_with_margin : lv_obj_get_height_with_margin);
-    int32_t(*get_cross_size)(const lv_obj_t *) = (!f->row ? lv_obj_get_width_with_margin :
-                                                  lv_obj_get_height_with_margin);
 
     t->track_main_size = 0;
     t->track_fix_main_size = 0;
@@ -258,10 +345,9 @@ static int32_t find_track_end(lv_obj_t * cont, flex_t * f, int32_t item_start_id
         if(item_id != item_start_id && lv_obj_has_flag(item, LV_OBJ_FLAG_FLEX_IN_NEW_TRACK)) break;
 
         if(!lv_obj_has_flag_any(item, LV_OBJ_FLAG_IGNORE_LAYOUT | LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING)) {
-            uint8_t grow_value = lv_obj_get_style_flex_grow(item, LV_PART_MAIN);
+            uint8_t grow_value = get_grow(f, item, item_id);
             if(grow_value) {
-                int32_t min_size = f->row ? lv_obj_get_style_min_width(item, LV_PART_MAIN)
-                                   : lv_obj_get_style_min_height(item, LV_PART_MAIN);
+                int32_t min_size = get_min_size(f, item, item_id);
 
                 int32_t req_size = min_size;
                 if(item_id != item_start_id) req_size += item_gap; /*No gap before the first item*/
@@ -283,10 +369,8 @@ static int32_t find_track_end(lv_obj_t * cont, flex_t * f, int32_t item_start_id
 
 
                     new_dsc[t->grow_item_cnt - 1].item = item;
-                    new_dsc[t->grow_item_cnt - 1].min_size = f->row ? lv_obj_get_style_min_width(item, LV_PART_MAIN)
-                                                             : lv_obj_get_style_min_height(item, LV_PART_MAIN);
-                    new_dsc[t->grow_item_cnt - 1].max_size = f->row ? lv_obj_get_style_max_width(item, LV_PART_MAIN)
-                                                             : lv_obj_get_style_max_height(item, LV_PART_MAIN);
+                    new_dsc[t->grow_item_cnt - 1].min_size = min_size;
+                    new_dsc[t->grow_item_cnt - 1].max_size = get_max_size(f, item, item_id);
                     new_dsc[t->grow_item_cnt - 1].grow_value = grow_value;
                     new_dsc[t->grow_item_cnt - 1].clamped = 0;
 
@@ -294,14 +378,14 @@ static int32_t find_track_end(lv_obj_t * cont, flex_t * f, int32_t item_start_id
                 }
             }
             else {
-                int32_t item_size = get_main_size(item);
+                int32_t item_size = get_main_size(f, item, item_id);
                 int32_t req_size = item_size;
                 if(item_id != item_start_id) req_size += item_gap; /*No gap before the first item*/
                 if(f->wrap && t->track_fix_main_size + grow_min_size_sum + req_size > max_main_size) break;
                 t->track_fix_main_size += req_size;
             }
 
-            t->track_cross_size = LV_MAX(get_cross_size(item), t->track_cross_size);
+            t->track_cross_size = LV_MAX(get_cross_size(f, item, item_id), t->track_cross_size);
             t->item_cnt++;
         }
 
@@ -318,8 +402,8 @@ static int32_t find_track_end(lv_obj_t * cont, flex_t * f, int32_t item_start_id
         item = cont->spec_attr->children[item_id];
         get_next_item(cont, f->rev, &item_id);
         if(item) {
-            t->track_cross_size = get_cross_size(item);
-            t->track_main_size = get_main_size(item);
+            t->track_cross_size = get_cross_size(f, item, item_start_id);
+            t->track_main_size = get_main_size(f, item, item_start_id);
             t->item_cnt = 1;
         }
     }
@@ -337,12 +421,6 @@ static void children_repos(lv_obj_t * cont, flex_t * f, int32_t item_first_id, i
     int32_t (*area_get_main_size)(const lv_area_t *) = (f->row ? lv_area_get_width : lv_area_get_height);
     int32_t (*area_get_cross_size)(const lv_area_t *) = (!f->row ? lv_area_get_width : lv_area_get_height);
 
-    typedef int32_t (*margin_func_t)(const lv_obj_t *, uint32_t);
-    margin_func_t get_margin_main_start = (f->row ? lv_obj_get_style_margin_left : lv_obj_get_style_margin_top);
-    margin_func_t get_margin_main_end = (f->row ? lv_obj_get_style_margin_right : lv_obj_get_style_margin_bottom);
-    margin_func_t get_margin_cross_start = (!f->row ? lv_obj_get_style_margin_left : lv_obj_get_style_margin_top);
-    margin_func_t get_margin_cross_end = (!f->row ? lv_obj_get_style_margin_right : lv_obj_get_style_margin_bottom);
-
     /*Calculate the size of grow items first*/
     uint32_t i;
     bool grow_reiterate  = true;
@@ -393,7 +471,7 @@ static void children_repos(lv_obj_t * cont, flex_t * f, int32_t item_first_id, i
             item = get_next_item(cont, f->rev, &item_first_id);
             continue;
         }
-        int32_t grow_size = lv_obj_get_style_flex_grow(item, LV_PART_MAIN);
+        int32_t grow_size = get_grow(f, item, item_first_id);
         if(grow_size) {
             int32_t s = 0;
             for(i = 0; i < t->grow_item_cnt; i++) {
@@ -434,45 +512,40 @@ static void children_repos(lv_obj_t * cont, flex_t * f, int32_t item_first_id, i
                 /*Round up the cross size to avoid rounding error when dividing by 2
                  *The issue comes up e,g, with column direction with center cross direction if an element's width changes*/
                 cross_pos = (((t->track_cross_size + 1) & (~1)) - area_get_cross_size(&item->coords)) / 2;
-                cross_pos += (get_margin_cross_start(item, LV_PART_MAIN) - get_margin_cross_end(item, LV_PART_MAIN)) / 2;
+                cross_pos += (get_margin(f, item, item_first_id, false, false) -
+                              get_margin(f, item, item_first_id, false, true)) / 2;
                 break;
             case LV_FLEX_ALIGN_END:
                 cross_pos = t->track_cross_size - area_get_cross_size(&item->coords);
-                cross_pos -= get_margin_cross_end(item, LV_PART_MAIN);
+                cross_pos -= get_margin(f, item, item_first_id, false, true);
                 break;
             default:
-                cross_pos += get_margin_cross_start(item, LV_PART_MAIN);
+                cross_pos += get_margin(f, item, item_first_id, false, false);
                 break;
         }
 
         if(f->row && rtl) main_pos -= area_get_main_size(&item->coords);
 
         /*Handle percentage value of translate*/
-        int32_t tr_x = lv_obj_get_style_translate_x(item, LV_PART_MAIN);
-        int32_t tr_y = lv_obj_get_style_translate_y(item, LV_PART_MAIN);
+        int32_t tr_x;
+        int32_t tr_y;
+        get_translate(f, item, item_first_id, &tr_x, &tr_y);
         int32_t w = lv_obj_get_width(item);
         int32_t h = lv_obj_get_height(item);
         if(LV_COORD_IS_PCT(tr_x)) tr_x = (w * LV_COORD_GET_PCT(tr_x)) / 100;
         if(LV_COORD_IS_PCT(tr_y)) tr_y = (h * LV_COORD_GET_PCT(tr_y)) / 100;
 
+        int32_t margin_main_start = get_margin(f, item, item_first_id, true, false);
         int32_t diff_x = abs_x - item->coords.x1 + tr_x;
         int32_t diff_y = abs_y - item->coords.y1 + tr_y;
-        diff_x += f->row ? main_pos + get_margin_main_start(item, LV_PART_MAIN) : cross_pos;
-        diff_y += f->row ? cross_pos : main_pos + get_margin_main_start(item, LV_PART_MAIN);
-
-        if(diff_x || diff_y) {
-            lv_obj_invalidate(item);
-            item->coords.x1 += diff_x;
-            item->coords.x2 += diff_x;
-            item->coords.y1 += diff_y;
-            item->coords.y2 += diff_y;
-            lv_obj_invalidate(item);
-            lv_obj_move_children_by(item, diff_x, diff_y, false);
-        }
+        diff_x += f->row ? main_pos + margin_main_start : cross_pos;
+        diff_y += f->row ? cross_pos : main_pos + margin_main_start;
+
+        move_item(item, diff_x, diff_y);
 
         if(!(f->row && rtl)) main_pos += area_get_main_size(&item->coords) + item_gap + place_gap
-                                             + get_margin_main_start(item, LV_PART_MAIN)
-                                             + get_margin_main_end(item, LV_PART_MAIN);
+                                             + margin_main_start
+                                             + get_margin(f, item, item_first_id, true, true);
         else main_pos -= item_gap + place_gap;
 
         item = get_next_item(cont, f->rev, &item_first_id);
@@ -535,18 +608,153 @@ static lv_obj_t * get_next_item(lv_obj_t * cont, bool rev, int32_t * item_id)
     }
 }
 
-static int32_t lv_obj_get_width_with_margin(const lv_obj_t * obj)
+static void move_item(lv_obj_t * item, int32_t diff_x, int32_t diff_y)
+{
+    if(diff_x == 0 && diff_y == 0) return;
+
+    lv_obj_invalidate(item);
+    item->coords.x1 += diff_x;
+    item->coords.x2 += diff_x;
+    item->coords.y1 += diff_y;
+    item->coords.y2 += diff_y;
+    lv_obj_invalidate(item);
+    lv_obj_move_children_by(item, diff_x, diff_y, false);
+}
+
+/*The getters below use the cached measurements if available and read the styles otherwise*/
+
+static int32_t get_main_size(const flex_t * f, const lv_obj_t * item, int32_t item_id)
+{
+    int32_t size = f->row ? lv_obj_get_width(item) : lv_obj_get_height(item);
+    return get_margin(f, item, item_id, true, false) + size + get_margin(f, item, item_id, true, true);
+}
+
+static int32_t get_cross_size(const flex_t * f, const lv_obj_t * item, int32_t item_id)
+{
+    int32_t size = f->row ? lv_obj_get_height(item) : lv_obj_get_width(item);
+    return get_margin(f, item, item_id, false, false) + size + get_margin(f, item, item_id, false, true);
+}
+
+static int32_t get_margin(const flex_t * f, const lv_obj_t * item, int32_t item_id, bool main_axis, bool end)
+{
+    /*The main axis is horizontal in rows and the cross axis is horizontal in columns*/
+    bool hor = main_axis == f->row;
+#if LV_LAYOUT_CACHE_MIN_CHILD_CNT
+    if(f->cache) {
+        const lv_layout_cache_item_t * rec = &f->cache->items[item_id];
+        if(hor) return end ? rec->margin_right : rec->margin_left;
+        else return end ? rec->margin_bottom : rec->margin_top;
+    }
+#else
+    LV_UNUSED(item_id);
+#endif
+    if(hor) return end ? lv_obj_get_style_margin_right(item, LV_PART_MAIN) : lv_obj_get_style_margin_left(item,
+                                                                                                              LV_PART_MAIN);
+    else return end ? lv_obj_get_style_margin_bottom(item, LV_PART_MAIN) : lv_obj_get_style_margin_top(item,
+                                                                                                           LV_PART_MAIN);
+}
+
+static uint8_t get_grow(const flex_t * f, const lv_obj_t * item, int32_t item_id)
+{
+#if LV_LAYOUT_CACHE_MIN_CHILD_CNT
+    if(f->cache) return f->cache->items[item_id].grow;
+#else
+    LV_UNUSED(f);
+    LV_UNUSED(item_id);
+#endif
+    return lv_obj_get_style_flex_grow(item, LV_PART_MAIN);
+}
+
+static int32_t get_min_size(const flex_t * f, const lv_obj_t * item, int32_t item_id)
+{
+#if LV_LAYOUT_CACHE_MIN_CHILD_CNT
+    if(f->cache) return f->cache->items[item_id].min_size;
+#else
+    LV_UNUSED(item_id);
+#endif
+    return f->row ? lv_obj_get_style_min_width(item, LV_PART_MAIN) : lv_obj_get_style_min_height(item, LV_PART_MAIN);
+}
+
+static int32_t get_max_size(const flex_t * f, const lv_obj_t * item, int32_t item_id)
+{
+#if LV_LAYOUT_CACHE_MIN_CHILD_CNT
+    if(f->cache) return f->cache->items[item_id].max_size;
+#else
+    LV_UNUSED(item_id);
+#endif
+    return f->row ? lv_obj_get_style_max_width(item, LV_PART_MAIN) : lv_obj_get_style_max_height(item, LV_PART_MAIN);
+}
+
+static void get_translate(const flex_t * f, const lv_obj_t * item, int32_t item_id, int32_t * tr_x, int32_t * tr_y)
+{
+#if LV_LAYOUT_CACHE_MIN_CHILD_CNT
+    if(f->cache) {
+        *tr_x = f->cache->items[item_id].translate_x;
+        *tr_y = f->cache->items[item_id].translate_y;
+        return;
+    }
+#else
+    LV_UNUSED(f);
+    LV_UNUSED(item_id);
+#endif
+    *tr_x = lv_obj_get_style_translate_x(item, LV_PART_MAIN);
+    *tr_y = lv_obj_get_style_translate_y(item, LV_PART_MAIN);
+}
+
+#if LV_LAYOUT_CACHE_MIN_CHILD_CNT
+
+static void measure_cb(lv_obj_t * item, lv_layout_cache_item_t * rec, void * user_data)
+{
+    flex_t * f = user_data;
+    rec->grow = lv_obj_get_style_flex_grow(item, LV_PART_MAIN);
+    rec->min_size = f->row ? lv_obj_get_style_min_width(item, LV_PART_MAIN) : lv_obj_get_style_min_height(item,
+                                                                                                           LV_PART_MAIN);
+    rec->max_size = f->row ? lv_obj_get_style_max_width(item, LV_PART_MAIN) : lv_obj_get_style_max_height(item,
+                                                                                                           LV_PART_MAIN);
+}
+
+/**
+ * Find the track which contains the first changed child using the tracks of the last update
+ * @param cache         pointer to a solved layout cache
+ * @param first_dirty   index of the first changed child
+ * @return              index of the first child of the track
+ */
+static int32_t find_dirty_track(const lv_layout_cache_t * cache, int32_t first_dirty)
 {
-    return lv_obj_get_style_margin_left(obj, LV_PART_MAIN)
-           + lv_obj_get_width(obj)
-           + lv_obj_get_style_margin_right(obj, LV_PART_MAIN);
+    int32_t id = 0;
+    while(1) {
+        int32_t end = cache->items[id].track_end;
+        if(end > first_dirty || end >= (int32_t)cache->solved_cnt) return id;
+        id = end;
+    }
 }
 
-static int32_t lv_obj_get_height_with_margin(const lv_obj_t * obj)
+/**
+ * Move the tracks of the last update in the cross direction
+ * @param cont              pointer to a flex container
+ * @param f                 the flex parameters
+ * @param track_first_item  index of the first child of the first track to move
+ * @param diff              move the tracks by this much
+ */
+static void shift_tracks(lv_obj_t * cont, const flex_t * f, int32_t track_first_item, int32_t diff)
 {
-    return lv_obj_get_style_margin_top(obj, LV_PART_MAIN)
-           + lv_obj_get_height(obj)
-           + lv_obj_get_style_margin_bottom(obj, LV_PART_MAIN);
+    if(diff == 0) return;
+
+    lv_layout_cache_item_t * items = f->cache->items;
+    int32_t child_cnt = (int32_t)cont->spec_attr->child_cnt;
+    int32_t id = track_first_item;
+    while(id < child_cnt) {
+        int32_t end = LV_MIN(items[id].track_end, child_cnt);
+        items[id].track_pos += diff;
+        for(; id < end; id++) {
+            lv_obj_t * item = cont->spec_attr->children[id];
+            if(lv_obj_has_flag_any(item, LV_OBJ_FLAG_IGNORE_LAYOUT | LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING)) continue;
+            if(f->row) move_item(item, 0, diff);
+            else move_item(item, diff, 0);
+        }
+    }
 }
 
+#endif /*LV_LAYOUT_CACHE_MIN_CHILD_CNT*/
+
 #endif /*LV_USE_FLEX*/
@@ -11,7 +11,7 @@
 #if LV_USE_GRID
 
 #include "../../stdlib/lv_string.h"
-#include "../lv_layout.h"
+#include "../lv_layout_private.h"
 #include "../../core/lv_obj_private.h"
 #include "../../core/lv_global.h"
 /*********************
@@ -54,15 +54,23 @@ typedef struct {
  *  STATIC PROTOTYPES
  **********************/
 static void grid_update(lv_obj_t * cont, void * user_data);
-static void calc(lv_obj_t * obj, lv_grid_calc_t * calc);
+static void calc(lv_obj_t * obj, lv_grid_calc_t * calc, const lv_layout_cache_t * cache);
 static void calc_free(lv_grid_calc_t * calc);
-static void calc_cols(lv_obj_t * cont, lv_grid_calc_t * c);
-static void calc_rows(lv_obj_t * cont, lv_grid_calc_t * c);
-static void item_repos(lv_obj_t * item, lv_grid_calc_t * c, item_repos_hint_t * hint);
+static void calc_cols(lv_obj_t * cont, lv_grid_calc_t * c, const lv_layout_cache_t * cache);
+static void calc_rows(lv_obj_t * cont, lv_grid_calc_t * c, const lv_layout_cache_t * cache);
+static void calc_content_sizes(const lv_layout_cache_t * cache, const int32_t * templ, uint32_t track_num,
+                               int32_t * size_array, bool col);
+static void item_repos(lv_obj_t * item, lv_grid_calc_t * c, item_repos_hint_t * hint,
+                       const lv_layout_cache_item_t * rec);
 static int32_t grid_align(int32_t cont_size, bool auto_size, lv_grid_align_t align, int32_t gap,
                           uint32_t track_num,
                           int32_t * size_array, int32_t * pos_array, bool reverse);
 static uint32_t count_tracks(const int32_t * templ);
+#if LV_LAYOUT_CACHE_MIN_CHILD_CNT
+    static void measure_cb(lv_obj_t * item, lv_layout_cache_item_t * rec, void * user_data);
+    static uint8_t * update_track_cache(lv_layout_cache_t * cache, const lv_grid_calc_t * c);
+    static bool item_tracks_changed(const lv_layout_cache_item_t * rec, const lv_grid_calc_t * c, const uint8_t * changed);
+#endif
 
 static inline const int32_t * get_col_dsc(lv_obj_t * obj)
 {
@@ -104,15 +112,30 @@ static inline lv_grid_align_t get_grid_row_align(lv_obj_t * obj)
 {
     return lv_obj_get_style_grid_row_align(obj, 0);
 }
-static inline int32_t get_margin_hor(lv_obj_t * obj)
+/*The margin getters use the cached measurements if `rec` is not NULL*/
+static inline int32_t get_margin_left(lv_obj_t * obj, const lv_layout_cache_item_t * rec)
+{
+    return rec ? rec->margin_left : lv_obj_get_style_margin_left(obj, LV_PART_MAIN);
+}
+static inline int32_t get_margin_right(lv_obj_t * obj, const lv_layout_cache_item_t * rec)
+{
+    return rec ? rec->margin_right : lv_obj_get_style_margin_right(obj, LV_PART_MAIN);
+}
+static inline int32_t get_margin_top(lv_obj_t * obj, const lv_layout_cache_item_t * rec)
+{
+    return rec ? rec->margin_top : lv_obj_get_style_margin_top(obj, LV_PART_MAIN);
+}
+static inline int32_t get_margin_bottom(lv_obj_t * obj, const lv_layout_cache_item_t * rec)
+{
+    return rec ? rec->margin_bottom : lv_obj_get_style_margin_bottom(obj, LV_PART_MAIN);
+}
+static inline int32_t get_margin_hor(lv_obj_t * obj, const lv_layout_cache_item_t * rec)
 {
-    return lv_obj_get_style_margin_left(obj, LV_PART_MAIN)
-           + lv_obj_get_style_margin_right(obj, LV_PART_MAIN);
+    return get_margin_left(obj, rec) + get_margin_right(obj, rec);
 }
-static inline int32_t get_margin_ver(lv_obj_t * obj)
+static inline int32_t get_margin_ver(lv_obj_t * obj, const lv_layout_cache_item_t * rec)
 {
-    return lv_obj_get_style_margin_top(obj, LV_PART_MAIN)
-           + lv_obj_get_style_margin_bottom(obj, LV_PART_MAIN);
+    return get_margin_top(obj, rec) + get_margin_bottom(obj, rec);
 }
 
 static inline int32_t lv_div_round_closest(int32_t dividend, int32_t divisor)
@@ -193,8 +216,20 @@ static void grid_update(lv_obj_t * cont, void * user_data)
     //    const int32_t * row_templ = get_row_dsc(cont);
     //    if(col_templ == NULL || row_templ == NULL) return;
 
+    lv_layout_cache_t * cache = NULL;
+#if LV_LAYOUT_CACHE_MIN_CHILD_CNT
+    /*Subgrids depend on the template of the parent too, so don't cache them*/
+    if(get_col_dsc(cont) && get_row_dsc(cont)) {
+        cache = lv_layout_cache_get(cont, LV_LAYOUT_GRID);
+        if(cache) lv_layout_cache_update_items(cont, cache, measure_cb, NULL);
+    }
+    else {
+        lv_layout_cache_delete(cont);
+    }
+#endif
+
     lv_grid_calc_t c;
-    calc(cont, &c);
+    calc(cont, &c, cache);
 
     item_repos_hint_t hint;
     lv_memzero(&hint, sizeof(hint));
@@ -206,11 +241,31 @@ static void grid_update(lv_obj_t * cont, void * user_data)
     hint.grid_abs.x = pad_left + cont->coords.x1 - lv_obj_get_scroll_x(cont);
     hint.grid_abs.y = pad_top + cont->coords.y1 - lv_obj_get_scroll_y(cont);
 
+#if LV_LAYOUT_CACHE_MIN_CHILD_CNT
+    /*If the tracks of the last update are known only the changed children
+     *and the children of the changed tracks need to be placed*/
+    uint8_t * changed_tracks = cache ? update_track_cache(cache, &c) : NULL;
+#endif
+
     uint32_t i;
     for(i = 0; i < cont->spec_attr->child_cnt; i++) {
         lv_obj_t * item = cont->spec_attr->children[i];
-        item_repos(item, &c, &hint);
+#if LV_LAYOUT_CACHE_MIN_CHILD_CNT
+        if(cache) {
+            const lv_layout_cache_item_t * rec = &cache->items[i];
+            if(changed_tracks && !rec->dirty && !item_tracks_changed(rec, &c, changed_tracks)) continue;
+
+            item_repos(item, &c, &hint, rec);
+            lv_layout_cache_item_placed(cache, i);
+            continue;
+        }
+#endif
+        item_repos(item, &c, &hint, NULL);
     }
+#if LV_LAYOUT_CACHE_MIN_CHILD_CNT
+    lv_free(changed_tracks);
+    if(cache) cache->solved_cnt = cache->item_cnt;
+#endif
     calc_free(&c);
 
     int32_t w_set = lv_obj_get_style_width(cont, LV_PART_MAIN);
@@ -228,17 +283,18 @@ static void grid_update(lv_obj_t * cont, void * user_data)
  * Calculate the grid cells coordinates
  * @param cont an object that has a grid
  * @param calc store the calculated cells sizes here
+ * @param cache the layout cache of `cont` or NULL to read the children's styles
  * @note `lv_grid_calc_free(calc_out)` needs to be called when `calc_out` is not needed anymore
  */
-static void calc(lv_obj_t * cont, lv_grid_calc_t * calc_out)
+static void calc(lv_obj_t * cont, lv_grid_calc_t * calc_out, const lv_layout_cache_t * cache)
 {
     if(lv_obj_get_child(cont, 0) == NULL) {
         lv_memzero(calc_out, sizeof(lv_grid_calc_t));
         return;
     }
 
-    calc_rows(cont, calc_out);
-    calc_cols(cont, calc_out);
+    calc_rows(cont, calc_out, cache);
+    calc_cols(cont, calc_out, cache);
 
     int32_t col_gap = lv_obj_get_style_pad_column(cont, LV_PART_MAIN);
     int32_t row_gap = lv_obj_get_style_pad_row(cont, LV_PART_MAIN);
@@ -272,7 +328,7 @@ static void calc_free(lv_grid_calc_t * calc)
     lv_free(calc->h);
 }
 
-static void calc_cols(lv_obj_t * cont, lv_grid_calc_t * c)
+static void calc_cols(lv_obj_t * cont, lv_grid_calc_t * c, const lv_layout_cache_t * cache)
 {
 
     const int32_t * col_templ;
@@ -304,24 +360,29 @@ static void calc_cols(lv_obj_t * cont, lv_grid_calc_t * c)
 
     /*Set sizes for CONTENT cells*/
     uint32_t i;
-    for(i = 0; i < c->col_num; i++) {
-        int32_t size = LV_COORD_MIN;
-        if(IS_CONTENT(col_templ[i])) {
-            /*Check the size of children of this cell*/
-            uint32_t ci;
-            for(ci = 0; ci < lv_obj_get_child_count(cont); ci++) {
-                lv_obj_t * item = lv_obj_get_child(cont, ci);
-                if(lv_obj_has_flag_any(item, LV_OBJ_FLAG_IGNORE_LAYOUT | LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING)) continue;
-                uint32_t col_span = get_col_span(item);
-                if(col_span != 1) continue;
-
-                uint32_t col_pos = get_col_pos(item);
-                if(col_pos != i) continue;
-
-                size = LV_MAX(size, lv_obj_get_width(item));
+    if(cache) {
+        calc_content_sizes(cache, col_templ, c->col_num, c->w, true);
+    }
+    else {
+        for(i = 0; i < c->col_num; i++) {
+            int32_t size = LV_COORD_MIN;
+            if(IS_CONTENT(col_templ[i])) {
+                /*Check the size of children of this cell*/
+                uint32_t ci;
+                for(ci = 0; ci < lv_obj_get_child_count(cont); ci++) {
+                    lv_obj_t * item = lv_obj_get_child(cont, ci);
+                    if(lv_obj_has_flag_any(item, LV_OBJ_FLAG_IGNORE_LAYOUT | LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING)) continue;
+                    uint32_t col_span = get_col_span(item);
+                    if(col_span != 1) continue;
+
+                    uint32_t col_pos = get_col_pos(item);
+                    if(col_pos != i) continue;
+
+                    size = LV_MAX(size, lv_obj_get_width(item));
+                }
+                if(size >= 0) c->w[i] = size;
+                else c->w[i] = 0;
             }
-            if(size >= 0) c->w[i] = size;
-            else c->w[i] = 0;
         }
     }
 
@@ -365,7 +426,7 @@ static void calc_cols(lv_obj_t * cont, lv_grid_calc_t * c)
     }
 }
 
-static void calc_rows(lv_obj_t * cont, lv_grid_calc_t * c)
+static void calc_rows(lv_obj_t * cont, lv_grid_calc_t * c, const lv_layout_cache_t * cache)
 {
     const int32_t * row_templ;
     row_templ = get_row_dsc(cont);
@@ -393,24 +454,29 @@ static void calc_rows(lv_obj_t * cont, lv_grid_calc_t * c)
     c->h = lv_malloc(sizeof(int32_t) * c->row_num);
     /*Set sizes for CONTENT cells*/
     uint32_t i;
-    for(i = 0; i < c->row_num; i++) {
-        int32_t size = LV_COORD_MIN;
-        if(IS_CONTENT(row_templ[i])) {
-            /*Check the size of children of this cell*/
-            uint32_t ci;
-            for(ci = 0; ci < lv_obj_get_child_count(cont); ci++) {
-                lv_obj_t * item = lv_obj_get_child(cont, ci);
-                if(lv_obj_has_flag_any(item, LV_OBJ_FLAG_IGNORE_LAYOUT | LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING)) continue;
-                uint32_t row_span = get_row_span(item);
-                if(row_span != 1) continue;
-
-                uint32_t row_pos = get_row_pos(item);
-                if(row_pos != i) continue;
-
-                size = LV_MAX(size, lv_obj_get_height(item));
+    if(cache) {
+        calc_content_sizes(cache, row_templ, c->row_num, c->h, false);
+    }
+    else {
+        for(i = 0; i < c->row_num; i++) {
+            int32_t size = LV_COORD_MIN;
+            if(IS_CONTENT(row_templ[i])) {
+                /*Check the size of children of this cell*/
+                uint32_t ci;
+                for(ci = 0; ci < lv_obj_get_child_count(cont); ci++) {
+                    lv_obj_t * item = lv_obj_get_child(cont, ci);
+                    if(lv_obj_has_flag_any(item, LV_OBJ_FLAG_IGNORE_LAYOUT | LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING)) continue;
+                    uint32_t row_span = get_row_span(item);
+                    if(row_span != 1) continue;
+
+                    uint32_t row_pos = get_row_pos(item);
+                    if(row_pos != i) continue;
+
+                    size = LV_MAX(size, lv_obj_get_height(item));
+                }
+                if(size >= 0) c->h[i] = size;
+                else c->h[i] = 0;
             }
-            if(size >= 0) c->h[i] = size;
-            else c->h[i] = 0;
         }
     }
 
@@ -460,18 +526,21 @@ static void calc_rows(lv_obj_t * cont, lv_grid_calc_t * c)
  * @param calc the calculated grid of `cont`
  * @param child_id_ext helper value if the ID of the child is know (order from the oldest) else -1
  * @param grid_abs helper value, the absolute position of the grid, NULL if unknown
+ * @param rec the cached measurements of the item or NULL to read its styles
  */
-static void item_repos(lv_obj_t * item, lv_grid_calc_t * c, item_repos_hint_t * hint)
+static void item_repos(lv_obj_t * item, lv_grid_calc_t * c, item_repos_hint_t * hint,
+                       const lv_layout_cache_item_t * rec)
 {
     if(lv_obj_has_flag_any(item, LV_OBJ_FLAG_IGNORE_LAYOUT | LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING)) return;
-    uint32_t col_span = get_col_span(item);
-    uint32_t row_span = get_row_span(item);
+    uint32_t col_span = rec ? (uint32_t)rec->col_span : (uint32_t)get_col_span(item);
+    uint32_t row_span = rec ? (uint32_t)rec->row_span : (uint32_t)get_row_span(item);
     if(row_span == 0 || col_span == 0) return;
 
-    uint32_t col_pos = get_col_pos(item);
-    uint32_t row_pos = get_row_pos(item);
-    lv_grid_align_t col_align = get_cell_col_align(item);
-    lv_grid_align_t row_align = get_cell_row_align(item);
+    uint32_t col_pos = rec ? (uint32_t)rec->col_pos : (uint32_t)get_col_pos(item);
+    uint32_t row_pos = rec ? (uint32_t)rec->row_pos : (uint32_t)get_row_pos(item);
+    lv_grid_align_t col_align = rec ? rec->x_align : get_cell_col_align(item);
+    lv_grid_align_t row_align = rec ? rec->y_align : get_cell_row_align(item);
+    bool rtl = rec ? rec->rtl : lv_obj_get_style_base_dir(item, LV_PART_MAIN) == LV_BASE_DIR_RTL;
 
     int32_t col_x1 = c->x[col_pos];
     int32_t col_x2 = c->x[col_pos + col_span - 1] + c->w[col_pos + col_span - 1];
@@ -482,7 +551,7 @@ static void item_repos(lv_obj_t * item, lv_grid_calc_t * c, item_repos_hint_t *
     int32_t row_h = row_y2 - row_y1;
 
     /*If the item has RTL base dir switch start and end*/
-    if(lv_obj_get_style_base_dir(item, LV_PART_MAIN) == LV_BASE_DIR_RTL) {
+    if(rtl) {
         if(col_align == LV_GRID_ALIGN_START) col_align = LV_GRID_ALIGN_END;
         else if(col_align == LV_GRID_ALIGN_END) col_align = LV_GRID_ALIGN_START;
     }
@@ -495,21 +564,20 @@ static void item_repos(lv_obj_t * item, lv_grid_calc_t * c, item_repos_hint_t *
     switch(col_align) {
         default:
         case LV_GRID_ALIGN_START:
-            x = c->x[col_pos] + lv_obj_get_style_margin_left(item, LV_PART_MAIN);
+            x = c->x[col_pos] + get_margin_left(item, rec);
             item->w_layout = 0;
             break;
         case LV_GRID_ALIGN_STRETCH:
-            x = c->x[col_pos] + lv_obj_get_style_margin_left(item, LV_PART_MAIN);
-            item_w = col_w - get_margin_hor(item);
+            x = c->x[col_pos] + get_margin_left(item, rec);
+            item_w = col_w - get_margin_hor(item, rec);
             item->w_layout = 1;
             break;
         case LV_GRID_ALIGN_CENTER:
-            x = c->x[col_pos] + (col_w - item_w) / 2 + (lv_obj_get_style_margin_left(item, LV_PART_MAIN) -
-                                                        lv_obj_get_style_margin_right(item, LV_PART_MAIN)) / 2;
+            x = c->x[col_pos] + (col_w - item_w) / 2 + (get_margin_left(item, rec) - get_margin_right(item, rec)) / 2;
             item->w_layout = 0;
             break;
         case LV_GRID_ALIGN_END:
-            x = c->x[col_pos] + col_w - lv_obj_get_width(item) - lv_obj_get_style_margin_right(item, LV_PART_MAIN);
+            x = c->x[col_pos] + col_w - lv_obj_get_width(item) - get_margin_right(item, rec);
             item->w_layout = 0;
             break;
     }
@@ -517,21 +585,20 @@ static void item_repos(lv_obj_t * item, lv_grid_calc_t * c, item_repos_hint_t *
     switch(row_align) {
         default:
         case LV_GRID_ALIGN_START:
-            y = c->y[row_pos] + lv_obj_get_style_margin_top(item, LV_PART_MAIN);
+            y = c->y[row_pos] + get_margin_top(item, rec);
             item->h_layout = 0;
             break;
         case LV_GRID_ALIGN_STRETCH:
-            y = c->y[row_pos] + lv_obj_get_style_margin_top(item, LV_PART_MAIN);
-            item_h = row_h - get_margin_ver(item);
+            y = c->y[row_pos] + get_margin_top(item, rec);
+            item_h = row_h - get_margin_ver(item, rec);
             item->h_layout = 1;
             break;
         case LV_GRID_ALIGN_CENTER:
-            y = c->y[row_pos] + (row_h - item_h) / 2 + (lv_obj_get_style_margin_top(item, LV_PART_MAIN) -
-                                                        lv_obj_get_style_margin_bottom(item, LV_PART_MAIN)) / 2;
+            y = c->y[row_pos] + (row_h - item_h) / 2 + (get_margin_top(item, rec) - get_margin_bottom(item, rec)) / 2;
             item->h_layout = 0;
             break;
         case LV_GRID_ALIGN_END:
-            y = c->y[row_pos] + row_h - lv_obj_get_height(item) - lv_obj_get_style_margin_bottom(item, LV_PART_MAIN);
+            y = c->y[row_pos] + row_h - lv_obj_get_height(item) - get_margin_bottom(item, rec);
             item->h_layout = 0;
             break;
     }
@@ -550,8 +617,8 @@ static void item_repos(lv_obj_t * item, lv_grid_calc_t * c, item_repos_hint_t *
     }
 
     /*Handle percentage value of translate*/
-    int32_t tr_x = lv_obj_get_style_translate_x(item, LV_PART_MAIN);
-    int32_t tr_y = lv_obj_get_style_translate_y(item, LV_PART_MAIN);
+    int32_t tr_x = rec ? rec->translate_x : lv_obj_get_style_translate_x(item, LV_PART_MAIN);
+    int32_t tr_y = rec ? rec->translate_y : lv_obj_get_style_translate_y(item, LV_PART_MAIN);
     int32_t w = lv_obj_get_width(item);
     int32_t h = lv_obj_get_height(item);
     if(LV_COORD_IS_PCT(tr_x)) tr_x = (w * LV_COORD_GET_PCT(tr_x)) / 100;
@@ -662,4 +729,124 @@ static uint32_t count_tracks(const int32_t * templ)
     return i;
 }
 
+/**
+ * Set the size of the CONTENT tracks from the cached measurements of the children.
+ * Unlike checking the children for each track it needs only one pass.
+ * @param cache         the layout cache of the container
+ * @param templ         the column or row template
+ * @param track_num     number of tracks in `templ`
+ * @param size_array    write the size of the CONTENT tracks here
+ * @param col           true: process the columns; false: process the rows
+ */
+static void calc_content_sizes(const lv_layout_cache_t * cache, const int32_t * templ, uint32_t track_num,
+                               int32_t * size_array, bool col)
+{
+    uint32_t i;
+    for(i = 0; i < track_num; i++) {
+        size_array[i] = 0;
+    }
+
+    for(i = 0; i < cache->item_cnt; i++) {
+        const lv_layout_cache_item_t * rec = &cache->items[i];
+        if(lv_obj_has_flag_any(rec->obj, LV_OBJ_FLAG_IGNORE_LAYOUT | LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_FLOATING)) continue;
+
+        uint32_t span = (uint32_t)(col ? rec->col_span : rec->row_span);
+        if(span != 1) continue;
+
+        uint32_t pos = (uint32_t)(col ? rec->col_pos : rec->row_pos);
+        if(pos >= track_num || !IS_CONTENT(templ[pos])) continue;
+
+        int32_t size = col ? lv_obj_get_width(rec->obj) : lv_obj_get_height(rec->obj);
+        size_array[pos] = LV_MAX(size_array[pos], size);
+    }
+}
+
+#if LV_LAYOUT_CACHE_MIN_CHILD_CNT
+
+static void measure_cb(lv_obj_t * item, lv_layout_cache_item_t * rec, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    rec->col_pos = get_col_pos(item);
+    rec->col_span = get_col_span(item);
+    rec->row_pos = get_row_pos(item);
+    rec->row_span = get_row_span(item);
+    rec->x_align = get_cell_col_align(item);
+    rec->y_align = get_cell_row_align(item);
+    rec->rtl = lv_obj_get_style_base_dir(item, LV_PART_MAIN) == LV_BASE_DIR_RTL;
+}
+
+/**
+ * Compare the calculated tracks with the tracks of the last update and save them in the cache.
+ * The cache stores the column and row count and then the `x`, `w`, `y`, `h` arrays.
+ * @param cache     the layout cache of the container
+ * @param c         the calculated grid
+ * @return          an array with a non-zero element for each column and then each row whose position or size
+ *                  has changed, or NULL if all children need to be placed. Needs to be freed with `lv_free`.
+ */
+static uint8_t * update_track_cache(lv_layout_cache_t * cache, const lv_grid_calc_t * c)
+{
+    uint32_t col_num = c->col_num;
+    uint32_t row_num = c->row_num;
+    int32_t * tracks = cache->tracks;
+    uint8_t * changed = NULL;
+    uint32_t i;
+
+    if(cache->solved && (uint32_t)tracks[0] == col_num && (uint32_t)tracks[1] == row_num) {
+        changed = lv_malloc(col_num + row_num);
+        if(changed) {
+            const int32_t * old_x = &tracks[2];
+            const int32_t * old_w = &old_x[col_num];
+            const int32_t * old_y = &old_w[col_num];
+            const int32_t * old_h = &old_y[row_num];
+            for(i = 0; i < col_num; i++) {
+                changed[i] = old_x[i] != c->x[i] || old_w[i] != c->w[i];
+            }
+            for(i = 0; i < row_num; i++) {
+                changed[col_num + i] = old_y[i] != c->y[i] || old_h[i] != c->h[i];
+            }
+        }
+    }
+
+    cache->solved = 0;
+    if(!lv_layout_cache_reserve_tracks(cache, 2 + 2 * (col_num + row_num))) return changed;
+
+    tracks = cache->tracks;
+    tracks[0] = (int32_t)col_num;
+    tracks[1] = (int32_t)row_num;
+    lv_memcpy(&tracks[2], c->x, col_num * sizeof(int32_t));
+    lv_memcpy(&tracks[2 + col_num], c->w, col_num * sizeof(int32_t));
+    lv_memcpy(&tracks[2 + 2 * col_num], c->y, row_num * sizeof(int32_t));
+    lv_memcpy(&tracks[2 + 2 * col_num + row_num], c->h, row_num * sizeof(int32_t));
+    cache->solved = 1;
+
+    return changed;
+}
+
+/**
+ * Check if any track of a child's cell has changed
+ * @param rec       the cached measurements of the child
+ * @param c         the calculated grid
+ * @param changed   the changed tracks returned by `update_track_cache`
+ * @return          true: the child needs to be placed again
+ */
+static bool item_tracks_changed(const lv_layout_cache_item_t * rec, const lv_grid_calc_t * c, const uint8_t * changed)
+{
+    uint32_t col_end = (uint32_t)rec->col_pos + (uint32_t)rec->col_span;
+    uint32_t row_end = (uint32_t)rec->row_pos + (uint32_t)rec->row_span;
+    if(col_end > c->col_num || row_end > c->row_num) return true;
+
+    uint32_t i;
+    for(i = (uint32_t)rec->col_pos; i < col_end; i++) {
+        if(changed[i]) return true;
+    }
+    for(i = (uint32_t)rec->row_pos; i < row_end; i++) {
+        if(changed[c->col_num + i]) return true;
+    }
+
+    return false;
+}
+
+#endif /*LV_LAYOUT_CACHE_MIN_CHILD_CNT*/
+
 #endif /*LV_USE_GRID*/
@@ -9,6 +9,8 @@
 #include "lv_layout_private.h"
 #include "../core/lv_global.h"
 #include "../core/lv_obj.h"
+#include "../core/lv_obj_private.h"
+#include "../stdlib/lv_string.h"
 
 /*********************
  *      DEFINES
@@ -16,6 +18,15 @@
 #define layout_cnt LV_GLOBAL_DEFAULT()->layout_count
 #define layout_list_def LV_GLOBAL_DEFAULT()->layout_list
 
+/*The flags which change how a child is placed*/
+#if LV_USE_FLEX
+    #define LAYOUT_FLAGS    (LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_IGNORE_LAYOUT | LV_OBJ_FLAG_FLOATING | \
+                             LV_OBJ_FLAG_FLEX_IN_NEW_TRACK | LV_OBJ_FLAG_LAYOUT_1 | LV_OBJ_FLAG_LAYOUT_2)
+#else
+    #define LAYOUT_FLAGS    (LV_OBJ_FLAG_HIDDEN | LV_OBJ_FLAG_IGNORE_LAYOUT | LV_OBJ_FLAG_FLOATING | \
+                             LV_OBJ_FLAG_LAYOUT_1 | LV_OBJ_FLAG_LAYOUT_2)
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -23,6 +34,10 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+#if LV_LAYOUT_CACHE_MIN_CHILD_CNT
+    static void measure_item(lv_obj_t * item, lv_layout_cache_item_t * rec, lv_layout_cache_measure_cb_t measure_cb,
+                             void * user_data);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -74,6 +89,159 @@ void lv_layout_apply(lv_obj_t * obj)
     }
 }
 
+#if LV_LAYOUT_CACHE_MIN_CHILD_CNT
+
+lv_layout_cache_t * lv_layout_cache_get(lv_obj_t * obj, uint32_t layout)
+{
+    uint32_t child_cnt = lv_obj_get_child_count(obj);
+    if(child_cnt < LV_LAYOUT_CACHE_MIN_CHILD_CNT) {
+        lv_layout_cache_delete(obj);
+        return NULL;
+    }
+
+    lv_layout_cache_t * cache = obj->spec_attr->layout_cache;
+    if(cache == NULL) {
+        cache = lv_malloc_zeroed(sizeof(lv_layout_cache_t));
+        if(cache == NULL) return NULL;
+        obj->spec_attr->layout_cache = cache;
+    }
+
+    if(cache->item_size < child_cnt) {
+        lv_layout_cache_item_t * new_items = lv_realloc(cache->items, child_cnt * sizeof(lv_layout_cache_item_t));
+        if(new_items == NULL) {
+            lv_layout_cache_delete(obj);
+            return NULL;
+        }
+        cache->items = new_items;
+        cache->item_size = child_cnt;
+    }
+
+    /*Mark the new elements as unknown*/
+    uint32_t i;
+    for(i = cache->item_cnt; i < child_cnt; i++) {
+        cache->items[i].obj = NULL;
+    }
+    cache->item_cnt = child_cnt;
+
+    if(cache->layout != layout) {
+        cache->layout = layout;
+        cache->measured = 0;
+        cache->solved = 0;
+    }
+
+    /*The tracks can be reused only if the container hasn't changed*/
+    lv_point_t origin;
+    origin.x = obj->coords.x1 + lv_obj_get_style_space_left(obj, LV_PART_MAIN) - lv_obj_get_scroll_x(obj);
+    origin.y = obj->coords.y1 + lv_obj_get_style_space_top(obj, LV_PART_MAIN) - lv_obj_get_scroll_y(obj);
+    int32_t content_w = lv_obj_get_content_width(obj);
+    int32_t content_h = lv_obj_get_content_height(obj);
+    bool rtl = lv_obj_get_style_base_dir(obj, LV_PART_MAIN) == LV_BASE_DIR_RTL;
+
+    if(origin.x != cache->origin.x || origin.y != cache->origin.y ||
+       content_w != cache->content_w || content_h != cache->content_h ||
+       rtl != cache->rtl || obj->w_layout != cache->w_layout || obj->h_layout != cache->h_layout) {
+        cache->origin = origin;
+        cache->content_w = content_w;
+        cache->content_h = content_h;
+        cache->rtl = rtl;
+        cache->w_layout = obj->w_layout;
+        cache->h_layout = obj->h_layout;
+        cache->solved = 0;
+    }
+
+    return cache;
+}
+
+int32_t lv_layout_cache_update_items(lv_obj_t * obj, lv_layout_cache_t * cache, lv_layout_cache_measure_cb_t measure_cb,
+                                     void * user_data)
+{
+    int32_t first_dirty = -1;
+    cache->dirty_cnt = 0;
+    uint32_t i;
+    for(i = 0; i < cache->item_cnt; i++) {
+        lv_obj_t * item = obj->spec_attr->children[i];
+        lv_layout_cache_item_t * rec = &cache->items[i];
+        if(!cache->measured || rec->obj != item) {
+            measure_item(item, rec, measure_cb, user_data);
+        }
+        else if(rec->w != lv_obj_get_width(item) || rec->h != lv_obj_get_height(item) ||
+                rec->flags != (item->flags & LAYOUT_FLAGS)) {
+            rec->dirty = 1;
+        }
+
+        if(rec->dirty) {
+            if(first_dirty < 0) first_dirty = (int32_t)i;
+            cache->dirty_cnt++;
+        }
+    }
+
+    cache->measured = 1;
+    return first_dirty;
+}
+
+void lv_layout_cache_item_placed(lv_layout_cache_t * cache, uint32_t id)
+{
+    lv_layout_cache_item_t * rec = &cache->items[id];
+    rec->w = lv_obj_get_width(rec->obj);
+    rec->h = lv_obj_get_height(rec->obj);
+    rec->flags = rec->obj->flags & LAYOUT_FLAGS;
+    if(rec->dirty) {
+        rec->dirty = 0;
+        cache->dirty_cnt--;
+    }
+}
+
+bool lv_layout_cache_reserve_tracks(lv_layout_cache_t * cache, uint32_t cnt)
+{
+    if(cache->track_size >= cnt) return true;
+
+    int32_t * new_tracks = lv_realloc(cache->tracks, cnt * sizeof(int32_t));
+    if(new_tracks == NULL) return false;
+
+    cache->tracks = new_tracks;
+    cache->track_size = cnt;
+    return true;
+}
+
+void lv_layout_cache_invalidate(lv_obj_t * obj)
+{
+    if(obj && obj->spec_attr && obj->spec_attr->layout_cache) {
+        obj->spec_attr->layout_cache->measured = 0;
+        obj->spec_attr->layout_cache->solved = 0;
+    }
+}
+
+void lv_layout_cache_delete(lv_obj_t * obj)
+{
+    lv_layout_cache_t * cache = obj->spec_attr ? obj->spec_attr->layout_cache : NULL;
+    if(cache == NULL) return;
+
+    lv_free(cache->items);
+    lv_free(cache->tracks);
+    lv_free(cache);
+    obj->spec_attr->layout_cache = NULL;
+}
+
+#endif /*LV_LAYOUT_CACHE_MIN_CHILD_CNT*/
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
+
+#if LV_LAYOUT_CACHE_MIN_CHILD_CNT
+
+static void measure_item(lv_obj_t * item, lv_layout_cache_item_t * rec, lv_layout_cache_measure_cb_t measure_cb,
+                         void * user_data)
+{
+    rec->obj = item;
+    rec->margin_left = lv_obj_get_style_margin_left(item, LV_PART_MAIN);
+    rec->margin_right = lv_obj_get_style_margin_right(item, LV_PART_MAIN);
+    rec->margin_top = lv_obj_get_style_margin_top(item, LV_PART_MAIN);
+    rec->margin_bottom = lv_obj_get_style_margin_bottom(item, LV_PART_MAIN);
+    rec->translate_x = lv_obj_get_style_translate_x(item, LV_PART_MAIN);
+    rec->translate_y = lv_obj_get_style_translate_y(item, LV_PART_MAIN);
+    measure_cb(item, rec, user_data);
+    rec->dirty = 1;
+}
+
+#endif /*LV_LAYOUT_CACHE_MIN_CHILD_CNT*/
@@ -15,6 +15,7 @@ extern "C" {
  *********************/
 
 #include "lv_layout.h"
+#include "../core/lv_obj.h"
 
 /*********************
  *      DEFINES
@@ -29,6 +30,71 @@ typedef struct {
     void * user_data;
 } lv_layout_dsc_t;
 
+/**
+ * The measurements of a child from the last layout update.
+ * The style properties are read again only after `lv_layout_cache_invalidate()`.
+ */
+typedef struct {
+    lv_obj_t * obj;             /**< The child the measurements belong to*/
+    int32_t w;                  /**< Size of the child after the last layout update*/
+    int32_t h;
+    lv_obj_flag_t flags;        /**< Layout related flags of the child after the last layout update*/
+    int32_t margin_left;
+    int32_t margin_right;
+    int32_t margin_top;
+    int32_t margin_bottom;
+    int32_t translate_x;        /**< Can be a percentage value too*/
+    int32_t translate_y;
+
+    /*Used by flex*/
+    int32_t min_size;           /**< Min. size in the main direction*/
+    int32_t max_size;           /**< Max. size in the main direction*/
+    int32_t track_end;          /**< If a track starts with this child: index of the first child of the next track*/
+    int32_t track_pos;          /**< If a track starts with this child: position of the track in the cross direction*/
+    uint8_t grow;
+
+    /*Used by grid*/
+    uint8_t x_align;
+    uint8_t y_align;
+    uint8_t rtl : 1;
+    int32_t col_pos;
+    int32_t col_span;
+    int32_t row_pos;
+    int32_t row_span;
+
+    uint8_t dirty : 1;          /**< The child was added, moved in the tree or changed since the last layout update*/
+} lv_layout_cache_item_t;
+
+/**
+ * Called to read the layout specific style properties of a child
+ * @param item          pointer to a child
+ * @param rec           store the properties here
+ * @param user_data     custom data
+ */
+typedef void (*lv_layout_cache_measure_cb_t)(lv_obj_t * item, lv_layout_cache_item_t * rec, void * user_data);
+
+struct _lv_layout_cache_t {
+    lv_layout_cache_item_t * items;     /**< One element for each child*/
+    uint32_t item_cnt;
+    uint32_t item_size;                 /**< Allocated elements in `items`*/
+    int32_t * tracks;                   /**< Layout specific data about the tracks*/
+    uint32_t track_size;                /**< Allocated elements in `tracks`*/
+    uint32_t solved_cnt;                /**< Number of children when the tracks were calculated*/
+    uint32_t dirty_cnt;                 /**< Number of dirty children not placed yet*/
+
+    /*The container's properties at the last layout update*/
+    uint32_t layout;
+    lv_point_t origin;                  /**< Absolute position of the content area including the scroll*/
+    int32_t content_w;
+    int32_t content_h;
+    uint8_t rtl : 1;
+    uint8_t w_layout : 1;
+    uint8_t h_layout : 1;
+
+    uint8_t measured : 1;               /**< The style properties stored in `items` are up to date*/
+    uint8_t solved : 1;                 /**< The tracks and the positions of the children are up to date*/
+};
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -47,6 +113,63 @@ void lv_layout_deinit(void);
  */
 void lv_layout_apply(lv_obj_t * obj);
 
+#if LV_LAYOUT_CACHE_MIN_CHILD_CNT
+
+/**
+ * Get the layout cache of a container for a layout update. It's created if required.
+ * If the container has changed since the last layout update the cache is marked as not solved.
+ * @param obj       pointer to a container
+ * @param layout    ID of the layout using the cache
+ * @return          the cache or NULL if the container has too few children or out of memory
+ */
+lv_layout_cache_t * lv_layout_cache_get(lv_obj_t * obj, uint32_t layout);
+
+/**
+ * Compare the children of a container with their cached measurements.
+ * The changed children are measured again and marked as dirty.
+ * @param obj           pointer to a container
+ * @param cache         the layout cache of `obj`
+ * @param measure_cb    called to read the layout specific properties of the children
+ * @param user_data     passed to `measure_cb`
+ * @return              index of the first dirty child or -1 if none of them has changed
+ */
+int32_t lv_layout_cache_update_items(lv_obj_t * obj, lv_layout_cache_t * cache, lv_layout_cache_measure_cb_t measure_cb,
+                                     void * user_data);
+
+/**
+ * Save the size and flags of a child after it was placed and clear its dirty flag
+ * @param cache     pointer to a layout cache
+ * @param id        index of the child
+ */
+void lv_layout_cache_item_placed(lv_layout_cache_t * cache, uint32_t id);
+
+/**
+ * Make sure the cache can store the given number of track values
+ * @param cache     pointer to a layout cache
+ * @param cnt       number of values
+ * @return          false: out of memory
+ */
+bool lv_layout_cache_reserve_tracks(lv_layout_cache_t * cache, uint32_t cnt);
+
+/**
+ * Mark the cached measurements of the children of a container as outdated.
+ * Should be called when the styles of the container or its children change.
+ * @param obj       pointer to a container (can be NULL)
+ */
+void lv_layout_cache_invalidate(lv_obj_t * obj);
+
+/**
+ * Free the layout cache of a container
+ * @param obj       pointer to a container
+ */
+void lv_layout_cache_delete(lv_obj_t * obj);
+
+#else
+
+#define lv_layout_cache_invalidate(obj) LV_UNUSED(obj)
+
+#endif /*LV_LAYOUT_CACHE_MIN_CHILD_CNT*/
+
 /**********************
  *      MACROS
  **********************/
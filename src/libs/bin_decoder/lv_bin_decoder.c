@@ -14,6 +14,7 @@
 #include "../../stdlib/lv_sprintf.h"
 #include "../../libs/rle/lv_rle.h"
 #include "../../core/lv_global.h"
+#include "../../misc/lv_area_private.h"
 
 #if LV_USE_LZ4_EXTERNAL
     #include <lz4.h>
@@ -30,6 +31,7 @@
 #define DECODER_NAME    "BIN"
 
 #define image_cache_draw_buf_handlers &(LV_GLOBAL_DEFAULT()->image_cache_draw_buf_handlers)
+#define img_tile_cache_p (LV_GLOBAL_DEFAULT()->img_tile_cache)
 
 /**********************
  *      TYPEDEFS
@@ -47,6 +49,23 @@ typedef struct _lv_image_compressed_t {
     const uint8_t * data; /*Compressed data*/
 } lv_image_compressed_t;
 
+/**
+ * Header of tiled image data. It's followed by the tile index table (an `lv_image_tile_t`
+ * for each tile in row-major order) and the data of the tiles.
+ */
+typedef struct _lv_image_tiled_t {
+    uint16_t tile_w;        /*Width of the tiles. The tiles on the right and bottom edge are padded*/
+    uint16_t tile_h;        /*Height of the tiles*/
+    uint16_t tile_stride;   /*Stride of the decompressed tiles in bytes*/
+    uint16_t reserved;      /*Reserved to be used later*/
+} lv_image_tiled_t;
+
+typedef struct _lv_image_tile_t {
+    uint32_t offset;        /*Offset of the tile data from the beginning of `lv_image_tiled_t`*/
+    uint32_t method: 4;     /*Compression method of the tile, see `lv_image_compress_t`*/
+    uint32_t size : 28;     /*Size of the tile data in bytes*/
+} lv_image_tile_t;
+
 typedef struct {
     lv_fs_file_t * f;
     lv_color32_t * palette;
@@ -56,6 +75,9 @@ typedef struct {
     lv_draw_buf_t * decompressed;       /*Decompressed data could be used directly, thus must also be draw buf*/
     lv_draw_buf_t c_array;              /*An C-array image that need to be converted to a draw buf*/
     lv_draw_buf_t * decoded_partial;    /*A draw buf for decoded image via get_area_cb*/
+    lv_image_tiled_t tiled;
+    lv_image_tile_t * tiles;            /*Tile index table of tiled images*/
+    lv_cache_entry_t * tile_entry;      /*Tile cache entry of the tile returned last by get_area_cb*/
 } decoder_data_t;
 
 /**********************
@@ -76,6 +98,14 @@ static lv_result_t decode_compressed(lv_image_decoder_t * decoder, lv_image_deco
 static lv_fs_res_t fs_read_file_at(lv_fs_file_t * f, uint32_t pos, void * buff, uint32_t btr, uint32_t * br);
 
 static lv_result_t decompress_image(lv_image_decoder_dsc_t * dsc, const lv_image_compressed_t * compressed);
+static lv_result_t decompress_data(lv_color_format_t cf, lv_image_compress_t method, const uint8_t * input,
+                                   uint32_t input_len, uint8_t * output, uint32_t out_len);
+
+static lv_result_t open_tiled(lv_image_decoder_dsc_t * dsc);
+static lv_result_t get_area_tiled(lv_image_decoder_dsc_t * dsc, const lv_area_t * full_area, lv_area_t * decoded_area);
+static lv_draw_buf_t * get_tile(lv_image_decoder_dsc_t * dsc, uint32_t tile_index);
+static lv_draw_buf_t * decode_tile(lv_image_decoder_dsc_t * dsc, uint32_t tile_index);
+static lv_result_t read_tiled_data(lv_image_decoder_dsc_t * dsc, uint32_t offset, void * buf, uint32_t len);
 
 /**********************
  *  STATIC VARIABLES
@@ -85,6 +115,8 @@ static lv_result_t decompress_image(lv_image_decoder_dsc_t * dsc, const lv_image
  *      MACROS
  **********************/
 
+#define TILE_CNT(size, tile_size) (((size) + (tile_size) - 1) / (tile_size))
+
 /**********************
  *   GLOBAL FUNCTIONS
  **********************/
@@ -215,7 +247,10 @@ lv_result_t lv_bin_decoder_open(lv_image_decoder_t * decoder, lv_image_decoder_d
 
         lv_color_format_t cf = dsc->header.cf;
 
-        if(dsc->header.flags & LV_IMAGE_FLAGS_COMPRESSED) {
+        if(dsc->header.flags & LV_IMAGE_FLAGS_TILED) {
+            res = open_tiled(dsc);
+        }
+        else if(dsc->header.flags & LV_IMAGE_FLAGS_COMPRESSED) {
             res = decode_compressed(decoder, dsc);
         }
         else if(LV_COLOR_FORMAT_IS_INDEXED(cf)) {
@@ -255,7 +290,10 @@ lv_result_t lv_bin_decoder_open(lv_image_decoder_t * decoder, lv_image_decoder_d
         }
 
         lv_color_format_t cf = image->header.cf;
-        if(dsc->header.flags & LV_IMAGE_FLAGS_COMPRESSED) {
+        if(dsc->header.flags & LV_IMAGE_FLAGS_TILED) {
+            res = open_tiled(dsc);
+        }
+        else if(dsc->header.flags & LV_IMAGE_FLAGS_COMPRESSED) {
             res = decode_compressed(decoder, dsc);
         }
         else if(LV_COLOR_FORMAT_IS_INDEXED(cf)) {
@@ -383,6 +421,11 @@ void lv_bin_decoder_close(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t *
         decoder_data->decoded_partial = NULL;
     }
 
+    if(decoder_data && decoder_data->tile_entry) {
+        lv_cache_release(img_tile_cache_p, decoder_data->tile_entry, NULL);
+        decoder_data->tile_entry = NULL;
+    }
+
     free_decoder_data(dsc);
 }
 
@@ -391,6 +434,10 @@ lv_result_t lv_bin_decoder_get_area(lv_image_decoder_t * decoder, lv_image_decod
 {
     LV_UNUSED(decoder); /*Unused*/
 
+    if(dsc->header.flags & LV_IMAGE_FLAGS_TILED) {
+        return get_area_tiled(dsc, full_area, decoded_area);
+    }
+
     lv_color_format_t cf = dsc->header.cf;
     /*Check if cf is supported*/
 
@@ -558,6 +605,7 @@ static void free_decoder_data(lv_image_decoder_dsc_t * dsc)
     if(decoder_data->decoded) lv_draw_buf_destroy(decoder_data->decoded);
     if(decoder_data->decompressed) lv_draw_buf_destroy(decoder_data->decompressed);
     lv_free(decoder_data->palette);
+    lv_free(decoder_data->tiles);
     lv_free(decoder_data);
     dsc->user_data = NULL;
 }
@@ -1097,8 +1145,6 @@ static lv_result_t decompress_image(lv_image_decoder_dsc_t * dsc, const lv_image
     uint8_t * img_data;
     uint32_t out_len = compressed->decompressed_size;
     uint32_t input_len = compressed->compressed_size;
-    LV_UNUSED(input_len);
-    LV_UNUSED(out_len);
 
     lv_draw_buf_t * decompressed = lv_draw_buf_create_ex(image_cache_draw_buf_handlers, dsc->header.w, dsc->header.h,
                                                          dsc->header.cf,
@@ -1116,53 +1162,299 @@ static lv_result_t decompress_image(lv_image_decoder_dsc_t * dsc, const lv_image
 
     img_data = decompressed->data;
 
-    if(compressed->method == LV_IMAGE_COMPRESS_RLE) {
+    if(decompress_data(dsc->header.cf, compressed->method, compressed->data, input_len, img_data,
+                       out_len) != LV_RESULT_OK) {
+        lv_draw_buf_destroy(decompressed);
+        return LV_RESULT_INVALID;
+    }
+
+    decoder_data->decompressed = decompressed; /*Free on decoder close*/
+    return LV_RESULT_OK;
+}
+
+static lv_result_t decompress_data(lv_color_format_t cf, lv_image_compress_t method, const uint8_t * input,
+                                   uint32_t input_len, uint8_t * output, uint32_t out_len)
+{
+    LV_UNUSED(input);
+    LV_UNUSED(input_len);
+    LV_UNUSED(output);
+    LV_UNUSED(out_len);
+
+    if(method == LV_IMAGE_COMPRESS_RLE) {
 #if LV_USE_RLE
         /*Compress always happen on byte*/
         uint32_t pixel_byte;
-        if(dsc->header.cf == LV_COLOR_FORMAT_RGB565A8)
+        if(cf == LV_COLOR_FORMAT_RGB565A8)
             pixel_byte = 2;
         else
-            pixel_byte = (lv_color_format_get_bpp(dsc->header.cf) + 7) >> 3;
-        const uint8_t * input = compressed->data;
-        uint8_t * output = img_data;
+            pixel_byte = (lv_color_format_get_bpp(cf) + 7) >> 3;
         uint32_t len;
         len = lv_rle_decompress(input, input_len, output, out_len, pixel_byte);
-        if(len != compressed->decompressed_size) {
+        if(len != out_len) {
             LV_LOG_WARN("Decompress failed: %" LV_PRIu32 ", got: %" LV_PRIu32, out_len, len);
-            lv_draw_buf_destroy(decompressed);
             return LV_RESULT_INVALID;
         }
 #else
+        LV_UNUSED(cf);
         LV_LOG_WARN("RLE decompress is not enabled");
-        lv_draw_buf_destroy(decompressed);
         return LV_RESULT_INVALID;
 #endif
     }
-    else if(compressed->method == LV_IMAGE_COMPRESS_LZ4) {
+    else if(method == LV_IMAGE_COMPRESS_LZ4) {
+        LV_UNUSED(cf);
 #if LV_USE_LZ4
-        const char * input = (const char *)compressed->data;
-        char * output = (char *)img_data;
         int len;
-        len = LZ4_decompress_safe(input, output, input_len, out_len);
-        if(len < 0 || (uint32_t)len != compressed->decompressed_size) {
+        len = LZ4_decompress_safe((const char *)input, (char *)output, input_len, out_len);
+        if(len < 0 || (uint32_t)len != out_len) {
             LV_LOG_WARN("Decompress failed: %" LV_PRId32 ", got: %" LV_PRId32, out_len, len);
-            lv_draw_buf_destroy(decompressed);
             return LV_RESULT_INVALID;
         }
 #else
         LV_LOG_WARN("LZ4 decompress is not enabled");
-        lv_draw_buf_destroy(decompressed);
         return LV_RESULT_INVALID;
 #endif
     }
     else {
-        LV_UNUSED(img_data);
-        LV_LOG_WARN("Unknown compression method: %d", compressed->method);
-        lv_draw_buf_destroy(decompressed);
+        LV_UNUSED(cf);
+        LV_LOG_WARN("Unknown compression method: %d", method);
         return LV_RESULT_INVALID;
     }
 
-    decoder_data->decompressed = decompressed; /*Free on decoder close*/
+    return LV_RESULT_OK;
+}
+
+static lv_result_t open_tiled(lv_image_decoder_dsc_t * dsc)
+{
+    decoder_data_t * decoder_data = get_decoder_data(dsc);
+    if(decoder_data == NULL) {
+        return LV_RESULT_INVALID;
+    }
+
+    /*The tiles are drawn directly so they can't be converted*/
+    lv_color_format_t cf = dsc->header.cf;
+    if(LV_COLOR_FORMAT_IS_INDEXED(cf) || (LV_COLOR_FORMAT_IS_ALPHA_ONLY(cf) && cf != LV_COLOR_FORMAT_A8)) {
+        LV_LOG_WARN("Tiled image with CF: %d is not supported", cf);
+        return LV_RESULT_INVALID;
+    }
+
+    lv_image_tiled_t * tiled = &decoder_data->tiled;
+    if(read_tiled_data(dsc, 0, tiled, sizeof(lv_image_tiled_t)) != LV_RESULT_OK) {
+        LV_LOG_WARN("Read tiled header failed");
+        return LV_RESULT_INVALID;
+    }
+
+    if(tiled->tile_w == 0 || tiled->tile_h == 0) {
+        LV_LOG_WARN("Invalid tile size: %dx%d", tiled->tile_w, tiled->tile_h);
+        return LV_RESULT_INVALID;
+    }
+
+    uint32_t tile_cnt = TILE_CNT(dsc->header.w, tiled->tile_w) * TILE_CNT(dsc->header.h, tiled->tile_h);
+    uint32_t index_size = tile_cnt * sizeof(lv_image_tile_t);
+    decoder_data->tiles = lv_malloc(index_size);
+    if(decoder_data->tiles == NULL) {
+        LV_LOG_WARN("No memory for the tile index table");
+        return LV_RESULT_INVALID;
+    }
+
+    if(read_tiled_data(dsc, sizeof(lv_image_tiled_t), decoder_data->tiles, index_size) != LV_RESULT_OK) {
+        LV_LOG_WARN("Read tile index table failed");
+        return LV_RESULT_INVALID;
+    }
+
+    /*The tiles are decoded in get_area_cb*/
+    return LV_RESULT_OK;
+}
+
+static lv_result_t get_area_tiled(lv_image_decoder_dsc_t * dsc, const lv_area_t * full_area, lv_area_t * decoded_area)
+{
+    decoder_data_t * decoder_data = dsc->user_data;
+    if(decoder_data == NULL || decoder_data->tiles == NULL) {
+        LV_LOG_ERROR("Unexpected null decoder data");
+        return LV_RESULT_INVALID;
+    }
+
+    int32_t tile_w = decoder_data->tiled.tile_w;
+    int32_t tile_h = decoder_data->tiled.tile_h;
+
+    lv_area_t img_area;
+    lv_area_set(&img_area, 0, 0, dsc->header.w - 1, dsc->header.h - 1);
+    lv_area_t area;
+    if(!lv_area_intersect(&area, full_area, &img_area)) {
+        return LV_RESULT_INVALID;
+    }
+
+    /*Return the tiles intersecting with the area one by one in row-major order*/
+    int32_t x;
+    int32_t y;
+    if(decoded_area->y1 == LV_COORD_MIN) {
+        x = area.x1 / tile_w * tile_w;
+        y = area.y1 / tile_h * tile_h;
+    }
+    else {
+        x = decoded_area->x1 + tile_w;
+        y = decoded_area->y1;
+        if(x > area.x2) {
+            x = area.x1 / tile_w * tile_w;
+            y += tile_h;
+        }
+    }
+
+    if(y > area.y2) {
+        return LV_RESULT_INVALID;
+    }
+
+    uint32_t tile_index = (y / tile_h) * TILE_CNT(dsc->header.w, tile_w) + x / tile_w;
+    lv_draw_buf_t * tile = get_tile(dsc, tile_index);
+    if(tile == NULL) {
+        return LV_RESULT_INVALID;
+    }
+
+    decoded_area->x1 = x;
+    decoded_area->y1 = y;
+    decoded_area->x2 = x + tile_w - 1;
+    decoded_area->y2 = y + tile_h - 1;
+
+    dsc->decoded = tile; /*Return decoded tile*/
+    return LV_RESULT_OK;
+}
+
+static lv_draw_buf_t * get_tile(lv_image_decoder_dsc_t * dsc, uint32_t tile_index)
+{
+    decoder_data_t * decoder_data = dsc->user_data;
+
+    /*The previous tile is not needed anymore*/
+    if(decoder_data->tile_entry) {
+        lv_cache_release(img_tile_cache_p, decoder_data->tile_entry, NULL);
+        decoder_data->tile_entry = NULL;
+    }
+
+    bool use_cache = lv_image_tile_cache_is_enabled() && !dsc->args.no_cache;
+
+    lv_image_tile_cache_data_t search_key;
+    search_key.src = dsc->src;
+    search_key.src_type = dsc->src_type;
+    search_key.tile_index = tile_index;
+
+    if(use_cache) {
+        lv_cache_entry_t * entry = lv_cache_acquire(img_tile_cache_p, &search_key, NULL);
+        if(entry) {
+            decoder_data->tile_entry = entry;
+            lv_image_tile_cache_data_t * cached_data = lv_cache_entry_get_data(entry);
+            return cached_data->decoded;
+        }
+    }
+
+    lv_draw_buf_t * tile = decode_tile(dsc, tile_index);
+    if(tile == NULL) {
+        return NULL;
+    }
+
+    if(use_cache) {
+        search_key.slot.size = tile->data_size;
+        lv_cache_entry_t * entry = lv_cache_add(img_tile_cache_p, &search_key, NULL);
+        if(entry) {
+            lv_image_tile_cache_data_t * cached_data = lv_cache_entry_get_data(entry);
+            cached_data->decoded = tile;
+
+            /*Duplicate the file name as the source might be freed before the cache entry*/
+            if(cached_data->src_type == LV_IMAGE_SRC_FILE) cached_data->src = lv_strdup(cached_data->src);
+
+            decoder_data->tile_entry = entry;
+            return tile;
+        }
+    }
+
+    /*Not cached, keep it until the next tile is decoded or the decoder is closed*/
+    if(decoder_data->decoded_partial) lv_draw_buf_destroy(decoder_data->decoded_partial);
+    decoder_data->decoded_partial = tile;
+    return tile;
+}
+
+static lv_draw_buf_t * decode_tile(lv_image_decoder_dsc_t * dsc, uint32_t tile_index)
+{
+    decoder_data_t * decoder_data = dsc->user_data;
+    const lv_image_tiled_t * tiled = &decoder_data->tiled;
+    const lv_image_tile_t * tile_info = &decoder_data->tiles[tile_index];
+
+    lv_draw_buf_t * tile = lv_draw_buf_create_ex(image_cache_draw_buf_handlers, tiled->tile_w, tiled->tile_h,
+                                                 dsc->header.cf, tiled->tile_stride);
+    if(tile == NULL) {
+        LV_LOG_WARN("No memory for tile %" LV_PRIu32, tile_index);
+        return NULL;
+    }
+
+    lv_result_t res;
+    if(tile_info->method == LV_IMAGE_COMPRESS_NONE) {
+        if(tile_info->size != tile->data_size) {
+            LV_LOG_WARN("Tile size mismatch: %" LV_PRIu32 " != %" LV_PRIu32, (uint32_t)tile_info->size, tile->data_size);
+            res = LV_RESULT_INVALID;
+        }
+        else {
+            res = read_tiled_data(dsc, tile_info->offset, tile->data, tile_info->size);
+        }
+    }
+    else if(dsc->src_type == LV_IMAGE_SRC_FILE) {
+        uint8_t * file_buf = lv_malloc(tile_info->size);
+        if(file_buf == NULL) {
+            LV_LOG_WARN("No memory for compressed tile");
+            res = LV_RESULT_INVALID;
+        }
+        else {
+            res = read_tiled_data(dsc, tile_info->offset, file_buf, tile_info->size);
+            if(res == LV_RESULT_OK) {
+                res = decompress_data(dsc->header.cf, tile_info->method, file_buf, tile_info->size, tile->data, tile->data_size);
+            }
+            lv_free(file_buf);
+        }
+    }
+    else {
+        const lv_image_dsc_t * image = dsc->src;
+        if(tile_info->offset + tile_info->size > image->data_size) {
+            LV_LOG_WARN("Tile %" LV_PRIu32 " is out of the image data", tile_index);
+            res = LV_RESULT_INVALID;
+        }
+        else {
+            res = decompress_data(dsc->header.cf, tile_info->method, image->data + tile_info->offset, tile_info->size,
+                                  tile->data, tile->data_size);
+        }
+    }
+
+    if(res != LV_RESULT_OK) {
+        LV_LOG_WARN("Decode tile %" LV_PRIu32 " failed", tile_index);
+        lv_draw_buf_destroy(tile);
+        return NULL;
+    }
+
+    if(dsc->header.flags & LV_IMAGE_FLAGS_PREMULTIPLIED) {
+        lv_draw_buf_set_flag(tile, LV_IMAGE_FLAGS_PREMULTIPLIED);
+    }
+
+    lv_draw_buf_t * adjusted = lv_image_decoder_post_process(dsc, tile);
+    if(adjusted != tile) lv_draw_buf_destroy(tile);
+
+    return adjusted;
+}
+
+/**
+ * Read data of a tiled image
+ * @param dsc       pointer to the decoder descriptor
+ * @param offset    offset from the beginning of the tiled header
+ * @param buf       buffer to read the data to
+ * @param len       number of bytes to read
+ * @return          LV_RESULT_OK: `len` bytes were read; LV_RESULT_INVALID: error
+ */
+static lv_result_t read_tiled_data(lv_image_decoder_dsc_t * dsc, uint32_t offset, void * buf, uint32_t len)
+{
+    if(dsc->src_type == LV_IMAGE_SRC_FILE) {
+        decoder_data_t * decoder_data = dsc->user_data;
+        uint32_t rn;
+        lv_fs_res_t res = fs_read_file_at(decoder_data->f, sizeof(lv_image_header_t) + offset, buf, len, &rn);
+        return res == LV_FS_RES_OK && rn == len ? LV_RESULT_OK : LV_RESULT_INVALID;
+    }
+
+    const lv_image_dsc_t * image = dsc->src;
+    if(offset + len > image->data_size) return LV_RESULT_INVALID;
+
+    lv_memcpy(buf, image->data + offset, len);
     return LV_RESULT_OK;
 }
@@ -28,6 +28,7 @@
 #define LV_DRAW_SW_ASM_NONE         0
 #define LV_DRAW_SW_ASM_NEON         1
 #define LV_DRAW_SW_ASM_HELIUM       2
+#define LV_DRAW_SW_ASM_SSE2         3
 #define LV_DRAW_SW_ASM_CUSTOM       255
 
 #define LV_NEMA_HAL_CUSTOM          0
@@ -233,6 +234,17 @@
             #endif
         #endif
     #endif
+
+    /** Serve small allocations (<= 256 bytes) from fixed size-class slabs instead of TLSF.
+     *  Reduces fragmentation and the cost of allocating small objects (widgets, events, draw tasks, etc.)
+     *  at the price of some memory kept in partially used slab pages. */
+    #ifndef LV_USE_MEM_SLAB
+        #ifdef CONFIG_LV_USE_MEM_SLAB
+            #define LV_USE_MEM_SLAB CONFIG_LV_USE_MEM_SLAB
+        #else
+            #define LV_USE_MEM_SLAB 0
+        #endif
+    #endif
 #endif  /*LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN*/
 
 /*====================
@@ -258,6 +270,29 @@
     #endif
 #endif
 
+/** Extra cost of redrawing an invalidated area in addition to its pixels (e.g. preparing the layer
+ * and flushing), expressed in pixels. Two invalidated areas are joined if their bounding box
+ * is smaller than the sum of their sizes plus this value.
+ * - 0: join only the areas whose bounding box is smaller than the sum of their sizes */
+#ifndef LV_INV_AREA_OVERHEAD
+    #ifdef CONFIG_LV_INV_AREA_OVERHEAD
+        #define LV_INV_AREA_OVERHEAD CONFIG_LV_INV_AREA_OVERHEAD
+    #else
+        #define LV_INV_AREA_OVERHEAD 0      /**< [px] */
+    #endif
+#endif
+
+/** 1: Keep the timers in a min-heap ordered by their next deadline so that `lv_timer_handler()`
+ *  checks only the timers which are due instead of all the timers.
+ *  Useful with many timers. */
+#ifndef LV_USE_TIMER_HEAP
+    #ifdef CONFIG_LV_USE_TIMER_HEAP
+        #define LV_USE_TIMER_HEAP CONFIG_LV_USE_TIMER_HEAP
+    #else
+        #define LV_USE_TIMER_HEAP 0
+    #endif
+#endif
+
 /*=================
  * OPERATING SYSTEM
  *=================*/
@@ -382,6 +417,17 @@
     #endif
 #endif
 
+/** Allocate the draw tasks of a frame from a bump arena of this size which is reset
+ *  when all the tasks are finished. If the arena is full `lv_malloc()` is used.
+ *  Set it to 0 to allocate every draw task with `lv_malloc()`. */
+#ifndef LV_DRAW_TASK_ARENA_SIZE
+    #ifdef CONFIG_LV_DRAW_TASK_ARENA_SIZE
+        #define LV_DRAW_TASK_ARENA_SIZE CONFIG_LV_DRAW_TASK_ARENA_SIZE
+    #else
+        #define LV_DRAW_TASK_ARENA_SIZE 0   /**< [bytes]*/
+    #endif
+#endif
+
 #ifndef LV_USE_DRAW_SW
     #ifdef LV_KCONFIG_PRESENT
         #ifdef CONFIG_LV_USE_DRAW_SW
@@ -525,6 +571,19 @@
         #endif
     #endif
 
+    /** Split large draw tasks into horizontal bands which can be stolen and rendered
+     *  by the idle draw units in parallel. Fills, borders, shadows, images and layers
+     *  covering at least this many pixels are split.
+     *  - Requires `LV_DRAW_SW_DRAW_UNIT_CNT > 1`.
+     *  - 0: disable splitting */
+    #ifndef LV_DRAW_SW_SPLIT_MIN_AREA
+        #ifdef CONFIG_LV_DRAW_SW_SPLIT_MIN_AREA
+            #define LV_DRAW_SW_SPLIT_MIN_AREA CONFIG_LV_DRAW_SW_SPLIT_MIN_AREA
+        #else
+            #define LV_DRAW_SW_SPLIT_MIN_AREA   0
+        #endif
+    #endif
+
     /** Use Arm-2D to accelerate software (sw) rendering. */
     #ifndef LV_USE_DRAW_ARM2D_SYNC
         #ifdef CONFIG_LV_USE_DRAW_ARM2D_SYNC
@@ -583,6 +642,12 @@
         #endif
     #endif
 
+    /** Use optimized blending routines:
+     *  - LV_DRAW_SW_ASM_NONE:   portable C implementation
+     *  - LV_DRAW_SW_ASM_NEON:   ARM NEON
+     *  - LV_DRAW_SW_ASM_HELIUM: ARM Helium
+     *  - LV_DRAW_SW_ASM_SSE2:   x86 SSE2 intrinsics (RGB565 and XRGB8888 destinations)
+     *  - LV_DRAW_SW_ASM_CUSTOM: include `LV_DRAW_SW_ASM_CUSTOM_INCLUDE` */
     #ifndef LV_USE_DRAW_SW_ASM
         #ifdef CONFIG_LV_USE_DRAW_SW_ASM
             #define LV_USE_DRAW_SW_ASM CONFIG_LV_USE_DRAW_SW_ASM
@@ -1231,6 +1296,28 @@
     #endif
 #endif
 
+/** Default size of the cache of the decoded tiles of tiled images (in bytes).
+ *  Only the tiles which are drawn are decoded. If size is 0, the tiles are decoded
+ *  every time they are drawn. */
+#ifndef LV_IMAGE_TILE_CACHE_DEF_SIZE
+    #ifdef CONFIG_LV_IMAGE_TILE_CACHE_DEF_SIZE
+        #define LV_IMAGE_TILE_CACHE_DEF_SIZE CONFIG_LV_IMAGE_TILE_CACHE_DEF_SIZE
+    #else
+        #define LV_IMAGE_TILE_CACHE_DEF_SIZE 0
+    #endif
+#endif
+
+/** 1: Decode images which are not in the image cache in the background (on a thread if `LV_USE_OS` is set)
+ *  instead of while drawing. They are not drawn until they are decoded and their area is redrawn then.
+ *  Also enables `lv_image_prefetch()` to warm the image cache. Requires `LV_CACHE_DEF_SIZE > 0`. */
+#ifndef LV_USE_IMAGE_DECODER_ASYNC
+    #ifdef CONFIG_LV_USE_IMAGE_DECODER_ASYNC
+        #define LV_USE_IMAGE_DECODER_ASYNC CONFIG_LV_USE_IMAGE_DECODER_ASYNC
+    #else
+        #define LV_USE_IMAGE_DECODER_ASYNC 0
+    #endif
+#endif
+
 /** Number of stops allowed per gradient. Increase this to allow more stops.
  *  This adds (sizeof(lv_color_t) + 1) bytes per additional stop. */
 #ifndef LV_GRADIENT_MAX_STOPS
@@ -1255,6 +1342,16 @@
     #endif
 #endif
 
+/** Keep the properties of non-constant styles sorted and find them with binary search.
+ * Makes getting properties from styles with many properties faster, but adding new properties is a little slower. */
+#ifndef LV_STYLE_SORTED_PROPS
+    #ifdef CONFIG_LV_STYLE_SORTED_PROPS
+        #define LV_STYLE_SORTED_PROPS CONFIG_LV_STYLE_SORTED_PROPS
+    #else
+        #define LV_STYLE_SORTED_PROPS   0
+    #endif
+#endif
+
 /** Add 2 x 32-bit variables to each `lv_obj_t` to speed up getting style properties */
 #ifndef LV_OBJ_STYLE_CACHE
     #ifdef CONFIG_LV_OBJ_STYLE_CACHE
@@ -1264,6 +1361,44 @@
     #endif
 #endif
 
+/** Number of resolved style properties cached per object and (part, state) pair.
+ * The cache is allocated on the first style property read of the object and
+ * it's invalidated when a style of the object changes.
+ * Requires `LV_OBJ_STYLE_CACHE`. It should be a power of 2, e.g. 32 (16 bytes per entry on 64-bit systems).
+ * - 0: disable the value cache */
+#ifndef LV_OBJ_STYLE_VALUE_CACHE_CNT
+    #ifdef CONFIG_LV_OBJ_STYLE_VALUE_CACHE_CNT
+        #define LV_OBJ_STYLE_VALUE_CACHE_CNT CONFIG_LV_OBJ_STYLE_VALUE_CACHE_CNT
+    #else
+        #define LV_OBJ_STYLE_VALUE_CACHE_CNT    0
+    #endif
+#endif
+
+/** Index the children of widgets having at least this many children in a grid by their position.
+ * Input devices then check only the children under the pointer instead of all of them.
+ * The index of a widget is rebuilt on the next search after a child is added, moved or resized.
+ * - 0: disable the index */
+#ifndef LV_OBJ_HIT_INDEX_MIN_CHILD_CNT
+    #ifdef CONFIG_LV_OBJ_HIT_INDEX_MIN_CHILD_CNT
+        #define LV_OBJ_HIT_INDEX_MIN_CHILD_CNT CONFIG_LV_OBJ_HIT_INDEX_MIN_CHILD_CNT
+    #else
+        #define LV_OBJ_HIT_INDEX_MIN_CHILD_CNT  0
+    #endif
+#endif
+
+/** Size of the cache of retained layers in bytes.
+ * Widgets marked with `lv_obj_set_layer_retained()` keep the content of their transform or
+ * opa_layered layer here, so only the blending is redone while the transform or opacity animates.
+ * A layer is rendered again when its widget or one of the children is invalidated.
+ * - 0: disable the cache */
+#ifndef LV_OBJ_LAYER_CACHE_SIZE
+    #ifdef CONFIG_LV_OBJ_LAYER_CACHE_SIZE
+        #define LV_OBJ_LAYER_CACHE_SIZE CONFIG_LV_OBJ_LAYER_CACHE_SIZE
+    #else
+        #define LV_OBJ_LAYER_CACHE_SIZE         0
+    #endif
+#endif
+
 /** Add `id` field to `lv_obj_t` */
 #ifndef LV_USE_OBJ_ID
     #ifdef CONFIG_LV_USE_OBJ_ID
@@ -1790,6 +1925,28 @@
     #endif
 #endif
 
+/** Number of decoded glyph bitmaps of the built-in (fmt_txt) fonts to keep in an LRU cache.
+ *  Useful for compressed fonts where decompressing a glyph on every draw is expensive.
+ *  - 0: disables caching */
+#ifndef LV_FONT_FMT_TXT_CACHE_CNT
+    #ifdef CONFIG_LV_FONT_FMT_TXT_CACHE_CNT
+        #define LV_FONT_FMT_TXT_CACHE_CNT CONFIG_LV_FONT_FMT_TXT_CACHE_CNT
+    #else
+        #define LV_FONT_FMT_TXT_CACHE_CNT 0
+    #endif
+#endif
+#if LV_FONT_FMT_TXT_CACHE_CNT
+    /** Number of `(font, letter) -> glyph id` pairs to remember for the fonts with sparse cmaps.
+     *  Must be a power of 2. */
+    #ifndef LV_FONT_FMT_TXT_GID_CACHE_CNT
+        #ifdef CONFIG_LV_FONT_FMT_TXT_GID_CACHE_CNT
+            #define LV_FONT_FMT_TXT_GID_CACHE_CNT CONFIG_LV_FONT_FMT_TXT_GID_CACHE_CNT
+        #else
+            #define LV_FONT_FMT_TXT_GID_CACHE_CNT 64
+        #endif
+    #endif
+#endif
+
 /** Enable drawing placeholders when glyph dsc is not found. */
 #ifndef LV_USE_FONT_PLACEHOLDER
     #ifdef LV_KCONFIG_PRESENT
@@ -2527,6 +2684,18 @@
     #endif
 #endif
 
+/** Cache the measurements of the children of flex and grid containers having at least this many children.
+ * When only a few children change, the layouts then reposition only the affected tracks
+ * instead of measuring and placing every child again.
+ * - 0: disable the cache */
+#ifndef LV_LAYOUT_CACHE_MIN_CHILD_CNT
+    #ifdef CONFIG_LV_LAYOUT_CACHE_MIN_CHILD_CNT
+        #define LV_LAYOUT_CACHE_MIN_CHILD_CNT CONFIG_LV_LAYOUT_CACHE_MIN_CHILD_CNT
+    #else
+        #define LV_LAYOUT_CACHE_MIN_CHILD_CNT 0
+    #endif
+#endif
+
 /*====================
  * 3RD PARTS LIBRARIES
  *====================*/
@@ -3152,7 +3321,7 @@
         #endif
     #endif
     #if LV_USE_PROFILER_BUILTIN
-        /** Default profiler trace buffer size */
+        /** Default profiler trace buffer size of each thread */
         #ifndef LV_PROFILER_BUILTIN_BUF_SIZE
             #ifdef CONFIG_LV_PROFILER_BUILTIN_BUF_SIZE
                 #define LV_PROFILER_BUILTIN_BUF_SIZE CONFIG_LV_PROFILER_BUILTIN_BUF_SIZE
@@ -3713,6 +3882,17 @@
             #define LV_LINUX_FBDEV_BUFFER_SIZE   60
         #endif
     #endif
+
+    /** Render into a screen sized buffer and copy only the changed areas to two framebuffer pages,
+     *  showing them with `FBIOPAN_DISPLAY`. If the driver can't pan, the changed areas are copied
+     *  once per frame to the visible framebuffer. The render mode and buffer count are ignored. */
+    #ifndef LV_LINUX_FBDEV_PAGE_FLIP
+        #ifdef CONFIG_LV_LINUX_FBDEV_PAGE_FLIP
+            #define LV_LINUX_FBDEV_PAGE_FLIP CONFIG_LV_LINUX_FBDEV_PAGE_FLIP
+        #else
+            #define LV_LINUX_FBDEV_PAGE_FLIP     0
+        #endif
+    #endif
 #endif
 
 /** Use Nuttx to open window and handle touchscreen */
@@ -14,6 +14,7 @@
 #include "core/lv_refr_private.h"
 #include "core/lv_obj_style_private.h"
 #include "core/lv_group_private.h"
+#include "core/lv_obj_layer_cache_private.h"
 #include "lv_init.h"
 #include "core/lv_global.h"
 #include "core/lv_obj.h"
@@ -206,6 +207,10 @@ void lv_init(void)
 
     lv_group_init();
 
+#if LV_FONT_FMT_TXT_CACHE_CNT
+    lv_font_fmt_txt_cache_init();
+#endif
+
 #if LV_USE_FREETYPE
     /* Since the drawing unit needs to register the freetype event,
      * initialize the freetype module first
@@ -262,11 +267,15 @@ void lv_init(void)
     /*Initialize the screen refresh system*/
     lv_refr_init();
 
+#if LV_OBJ_LAYER_CACHE_SIZE
+    lv_obj_layer_cache_init();
+#endif
+
 #if LV_USE_SYSMON
     lv_sysmon_builtin_init();
 #endif
 
-    lv_image_decoder_init(LV_CACHE_DEF_SIZE, LV_IMAGE_HEADER_CACHE_DEF_CNT);
+    lv_image_decoder_init(LV_CACHE_DEF_SIZE, LV_IMAGE_HEADER_CACHE_DEF_CNT, LV_IMAGE_TILE_CACHE_DEF_SIZE);
     lv_bin_decoder_init();  /*LVGL built-in binary image decoder*/
 
 #if LV_USE_DRAW_VG_LITE
@@ -425,8 +434,16 @@ void lv_deinit(void)
     lv_theme_mono_deinit();
 #endif
 
+#if LV_OBJ_LAYER_CACHE_SIZE
+    lv_obj_layer_cache_deinit();
+#endif
+
     lv_image_decoder_deinit();
 
+#if LV_FONT_FMT_TXT_CACHE_CNT
+    lv_font_fmt_txt_cache_deinit();
+#endif
+
     lv_refr_deinit();
 
     lv_obj_style_deinit();
@@ -20,6 +20,7 @@ extern "C" {
 
 #include "lv_image_cache.h"
 #include "lv_image_header_cache.h"
+#include "lv_image_tile_cache.h"
 
 /*********************
  *      DEFINES
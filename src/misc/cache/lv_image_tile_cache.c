@@ -0,0 +1,166 @@
+/**
+* @file lv_image_tile_cache.c
+*
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../draw/lv_image_decoder_private.h"
+#include "../lv_assert.h"
+#include "../../core/lv_global.h"
+#include "../../misc/lv_iter.h"
+#include "../../stdlib/lv_mem.h"
+#include "../../stdlib/lv_string.h"
+
+#include "lv_image_tile_cache.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define CACHE_NAME  "IMAGE_TILE"
+
+#define img_tile_cache_p (LV_GLOBAL_DEFAULT()->img_tile_cache)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static lv_cache_compare_res_t image_tile_cache_compare_cb(const lv_image_tile_cache_data_t * lhs,
+                                                          const lv_image_tile_cache_data_t * rhs);
+static void image_tile_cache_free_cb(lv_image_tile_cache_data_t * entry, void * user_data);
+
+/**********************
+ *  GLOBAL VARIABLES
+ **********************/
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_result_t lv_image_tile_cache_init(uint32_t size)
+{
+    if(img_tile_cache_p != NULL) {
+        return LV_RESULT_OK;
+    }
+
+    img_tile_cache_p = lv_cache_create(&lv_cache_class_lru_rb_size,
+    sizeof(lv_image_tile_cache_data_t), size, (lv_cache_ops_t) {
+        .compare_cb = (lv_cache_compare_cb_t) image_tile_cache_compare_cb,
+        .create_cb = NULL,
+        .free_cb = (lv_cache_free_cb_t) image_tile_cache_free_cb,
+    });
+
+    lv_cache_set_name(img_tile_cache_p, CACHE_NAME);
+    return img_tile_cache_p != NULL ? LV_RESULT_OK : LV_RESULT_INVALID;
+}
+
+void lv_image_tile_cache_resize(uint32_t new_size, bool evict_now)
+{
+    lv_cache_set_max_size(img_tile_cache_p, new_size, NULL);
+    if(evict_now) {
+        lv_cache_reserve(img_tile_cache_p, new_size, NULL);
+    }
+}
+
+void lv_image_tile_cache_drop(const void * src)
+{
+    if(src == NULL) {
+        lv_cache_drop_all(img_tile_cache_p, NULL);
+        return;
+    }
+
+    lv_image_tile_cache_data_t search_key = {
+        .src = src,
+        .src_type = lv_image_src_get_type(src),
+    };
+
+    /*The tiles of an image are not known so look for them one by one.
+     *The iterator returns the cache entries which start with the tile data.*/
+    lv_image_tile_cache_data_t * tile = lv_malloc(lv_cache_entry_get_size(sizeof(lv_image_tile_cache_data_t)));
+    LV_ASSERT_MALLOC(tile);
+    if(tile == NULL) return;
+
+    while(1) {
+        lv_iter_t * iter = lv_cache_iter_create(img_tile_cache_p);
+        if(iter == NULL) break;
+
+        bool found = false;
+        while(lv_iter_next(iter, tile) == LV_RESULT_OK) {
+            search_key.tile_index = tile->tile_index;
+            if(image_tile_cache_compare_cb(&search_key, tile) == 0) {
+                found = true;
+                break;
+            }
+        }
+        lv_iter_destroy(iter);
+
+        if(!found) break;
+        lv_cache_drop(img_tile_cache_p, &search_key, NULL);
+    }
+
+    lv_free(tile);
+}
+
+bool lv_image_tile_cache_is_enabled(void)
+{
+    return lv_cache_is_enabled(img_tile_cache_p);
+}
+
+lv_iter_t * lv_image_tile_cache_iter_create(void)
+{
+    return lv_cache_iter_create(img_tile_cache_p);
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static lv_cache_compare_res_t image_tile_cache_compare_cb(
+    const lv_image_tile_cache_data_t * lhs,
+    const lv_image_tile_cache_data_t * rhs)
+{
+    if(lhs->src_type != rhs->src_type) {
+        return lhs->src_type > rhs->src_type ? 1 : -1;
+    }
+
+    if(lhs->src_type == LV_IMAGE_SRC_FILE) {
+        int32_t cmp_res = lv_strcmp(lhs->src, rhs->src);
+        if(cmp_res != 0) {
+            return cmp_res > 0 ? 1 : -1;
+        }
+    }
+    else if(lhs->src != rhs->src) {
+        return lhs->src > rhs->src ? 1 : -1;
+    }
+
+    if(lhs->tile_index != rhs->tile_index) {
+        return lhs->tile_index > rhs->tile_index ? 1 : -1;
+    }
+
+    return 0;
+}
+
+static void image_tile_cache_free_cb(lv_image_tile_cache_data_t * entry, void * user_data)
+{
+    LV_UNUSED(user_data);
+
+    lv_draw_buf_destroy(entry->decoded);
+
+    /*Free the duplicated file name*/
+    if(entry->src_type == LV_IMAGE_SRC_FILE) lv_free((void *)entry->src);
+}
@@ -0,0 +1,78 @@
+/**
+* @file lv_image_tile_cache.h
+*
+ */
+
+#ifndef LV_IMAGE_TILE_CACHE_H
+#define LV_IMAGE_TILE_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../lv_conf_internal.h"
+#include "../lv_types.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Initialize the cache of the decoded tiles of tiled images.
+ * @param  size  initial size of the cache in bytes.
+ * @return LV_RESULT_OK: initialization succeeded, LV_RESULT_INVALID: failed.
+ */
+lv_result_t lv_image_tile_cache_init(uint32_t size);
+
+/**
+ * Resize the image tile cache.
+ * If set to 0, the cache is disabled and the tiles are decoded every time they are drawn.
+ * @param new_size  new size of the cache in bytes.
+ * @param evict_now true: evict the tiles should be removed by the eviction policy, false: wait for the next cache cleanup.
+ */
+void lv_image_tile_cache_resize(uint32_t new_size, bool evict_now);
+
+/**
+ * Drop the cached tiles of an image. Use NULL to drop all tiles.
+ * It's also automatically called when an image is invalidated.
+ * @param src pointer to an image source.
+ */
+void lv_image_tile_cache_drop(const void * src);
+
+/**
+ * Return true if the image tile cache is enabled.
+ * @return true: enabled, false: disabled.
+ */
+bool lv_image_tile_cache_is_enabled(void);
+
+/**
+ * Create an iterator to iterate over the image tile cache.
+ * @return an iterator to iterate over the image tile cache.
+ */
+lv_iter_t * lv_image_tile_cache_iter_create(void);
+
+/*************************
+ *    GLOBAL VARIABLES
+ *************************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_IMAGE_TILE_CACHE_H*/
@@ -29,8 +29,10 @@
 /**In an anim. time this bit indicates that the value is speed, and not time*/
 #define LV_ANIM_SPEED_MASK 0x80000000
 
+/**Initial number of hash buckets and array slots*/
+#define LV_ANIM_INDEX_MIN_SIZE 16
+
 #define state LV_GLOBAL_DEFAULT()->anim_state
-#define anim_ll_p &(state.anim_ll)
 
 /**********************
  *      TYPEDEFS
@@ -47,7 +49,12 @@ static int32_t lv_anim_path_cubic_bezier(const lv_anim_t * a, int32_t x1,
 static void lv_anim_pause_for_internal(lv_anim_t * a, uint32_t ms);
 static void resolve_time(lv_anim_t * a);
 static bool remove_concurrent_anims(lv_anim_t * a_current);
-static void remove_anim(void * a);
+static void remove_anim(lv_anim_t * a);
+static uint32_t anim_hash(const void * var);
+static bool anim_index_add(lv_anim_node_t * node);
+static void anim_index_remove(lv_anim_t * a);
+static bool anim_hash_resize(uint32_t bucket_cnt);
+static void anim_arr_compact(void);
 
 /**********************
  *  STATIC VARIABLES
@@ -68,7 +75,13 @@ static void remove_anim(void * a);
 
 void lv_anim_core_init(void)
 {
-    lv_ll_init(anim_ll_p, sizeof(lv_anim_t));
+    state.anim_arr = NULL;
+    state.anim_arr_cnt = 0;
+    state.anim_arr_size = 0;
+    state.anim_arr_lock = 0;
+    state.anim_cnt = 0;
+    state.hash_buckets = NULL;
+    state.hash_bucket_cnt = 0;
     state.timer = lv_timer_create(anim_timer, LV_DEF_REFR_PERIOD, NULL);
     anim_mark_list_change(); /*Turn off the animation timer*/
     state.anim_list_changed = false;
@@ -78,6 +91,14 @@ void lv_anim_core_init(void)
 void lv_anim_core_deinit(void)
 {
     lv_anim_delete_all();
+
+    lv_free(state.anim_arr);
+    state.anim_arr = NULL;
+    state.anim_arr_cnt = 0;
+    state.anim_arr_size = 0;
+    lv_free(state.hash_buckets);
+    state.hash_buckets = NULL;
+    state.hash_bucket_cnt = 0;
 }
 
 void lv_anim_init(lv_anim_t * a)
@@ -95,14 +116,21 @@ lv_anim_t * lv_anim_start(const lv_anim_t * a)
 {
     LV_TRACE_ANIM("begin");
 
-    /*Add the new animation to the animation linked list*/
-    lv_anim_t * new_anim = lv_ll_ins_head(anim_ll_p);
-    LV_ASSERT_MALLOC(new_anim);
-    if(new_anim == NULL) return NULL;
+    /*Add the new animation to the animation index*/
+    lv_anim_node_t * node = lv_malloc(sizeof(lv_anim_node_t));
+    LV_ASSERT_MALLOC(node);
+    if(node == NULL) return NULL;
 
     /*Initialize the animation descriptor*/
+    lv_anim_t * new_anim = &node->anim;
     lv_memcpy(new_anim, a, sizeof(lv_anim_t));
     if(a->var == a) new_anim->var = new_anim;
+
+    if(!anim_index_add(node)) {
+        lv_free(node);
+        return NULL;
+    }
+
     new_anim->run_round = state.anim_run_round;
     new_anim->last_timer_run = lv_tick_get();
     new_anim->is_paused = false;
@@ -129,7 +157,7 @@ lv_anim_t * lv_anim_start(const lv_anim_t * a)
         }
     }
 
-    /*Creating an animation changed the linked list.
+    /*Creating an animation changed the list of animations.
      *It's important if it happens in a ready callback. (see `anim_timer`)*/
     anim_mark_list_change();
 
@@ -153,22 +181,45 @@ uint32_t lv_anim_get_playtime(const lv_anim_t * a)
 
 bool lv_anim_delete(void * var, lv_anim_exec_xcb_t exec_cb)
 {
-    lv_anim_t * a;
     bool del_any = false;
-    a        = lv_ll_get_head(anim_ll_p);
-    while(a != NULL) {
-        bool del = false;
-        if((a->var == var || var == NULL) && (a->exec_cb == exec_cb || exec_cb == NULL)) {
+
+    /*Any variable: check all the animations, the newest first*/
+    if(var == NULL) {
+        state.anim_arr_lock++;
+        uint32_t i = state.anim_arr_cnt;
+        while(i > 0) {
+            i--;
+            lv_anim_node_t * node = state.anim_arr[i];
+            if(node == NULL) continue;
+            if(node->anim.exec_cb == exec_cb || exec_cb == NULL) {
+                remove_anim(&node->anim);
+                anim_mark_list_change(); /*Read by `anim_timer`. It need to know if a delete occurred*/
+                del_any = true;
+            }
+        }
+        state.anim_arr_lock--;
+
+        return del_any;
+    }
+
+    if(state.hash_buckets == NULL) return false;
+
+    /*All the animations of `var` are in the same bucket*/
+    lv_anim_node_t * node = state.hash_buckets[anim_hash(var)];
+    while(node != NULL) {
+        lv_anim_t * a = &node->anim;
+        if(a->var == var && (a->exec_cb == exec_cb || exec_cb == NULL)) {
             remove_anim(a);
-            anim_mark_list_change(); /*Read by `anim_timer`. It need to know if a delete occurred in
-                                       the linked list*/
+            anim_mark_list_change(); /*Read by `anim_timer`. It need to know if a delete occurred*/
             del_any = true;
-            del = true;
-        }
 
-        /*Always start from the head on delete, because we don't know
-         *how `anim_ll_p` was changes in `a->deleted_cb` */
-        a = del ? lv_ll_get_head(anim_ll_p) : lv_ll_get_next(anim_ll_p, a);
+            /*Always start from the head of the bucket on delete, because we don't know
+             *how the animations were changed in `a->deleted_cb` */
+            node = state.hash_buckets[anim_hash(var)];
+        }
+        else {
+            node = node->hash_next;
+        }
     }
 
     return del_any;
@@ -176,17 +227,32 @@ bool lv_anim_delete(void * var, lv_anim_exec_xcb_t exec_cb)
 
 void lv_anim_delete_all(void)
 {
-    lv_ll_clear_custom(anim_ll_p, remove_anim);
+    /*`deleted_cb` might start new animations so repeat until all are deleted*/
+    state.anim_arr_lock++;
+    while(state.anim_cnt > 0) {
+        uint32_t i = state.anim_arr_cnt;
+        while(i > 0) {
+            i--;
+            if(state.anim_arr[i]) remove_anim(&state.anim_arr[i]->anim);
+        }
+    }
+    state.anim_arr_lock--;
+
+    anim_arr_compact();
     anim_mark_list_change();
 }
 
 lv_anim_t * lv_anim_get(void * var, lv_anim_exec_xcb_t exec_cb)
 {
-    lv_anim_t * a;
-    LV_LL_READ(anim_ll_p, a) {
+    if(state.hash_buckets == NULL) return NULL;
+
+    lv_anim_node_t * node = state.hash_buckets[anim_hash(var)];
+    while(node != NULL) {
+        lv_anim_t * a = &node->anim;
         if(a->var == var && (a->exec_cb == exec_cb || exec_cb == NULL)) {
             return a;
         }
+        node = node->hash_next;
     }
 
     return NULL;
@@ -199,11 +265,7 @@ lv_timer_t * lv_anim_get_timer(void)
 
 uint16_t lv_anim_count_running(void)
 {
-    uint16_t cnt = 0;
-    lv_anim_t * a;
-    LV_LL_READ(anim_ll_p, a) cnt++;
-
-    return cnt;
+    return (uint16_t)LV_MIN(state.anim_cnt, UINT16_MAX);
 }
 
 uint32_t lv_anim_speed_clamped(uint32_t speed, uint32_t min_time, uint32_t max_time)
@@ -542,9 +604,17 @@ static void anim_timer(lv_timer_t * param)
     /*Flip the run round*/
     state.anim_run_round = state.anim_run_round ? false : true;
 
-    lv_anim_t * a = lv_ll_get_head(anim_ll_p);
-
-    while(a != NULL) {
+    /*Process the newest animations first. The animations started meanwhile are
+     *added to the end of the array so they are not processed in this round.
+     *The deleted ones are set to NULL and the array is compacted only at the end.*/
+    state.anim_arr_lock++;
+    uint32_t i = state.anim_arr_cnt;
+    while(i > 0) {
+        i--;
+        lv_anim_node_t * node = state.anim_arr[i];
+        if(node == NULL) continue;
+
+        lv_anim_t * a = &node->anim;
         uint32_t elaps = lv_tick_elaps(a->last_timer_run);
 
         if(a->is_paused) {
@@ -562,14 +632,13 @@ static void anim_timer(lv_timer_t * param)
         }
         a->last_timer_run = lv_tick_get();
 
-        /*It can be set by `lv_anim_delete()` typically in `end_cb`. If set then an animation delete
-         * happened in `anim_completed_handler` which could make this linked list reading corrupt
-         * because the list is changed meanwhile
+        /*It can be set by `lv_anim_delete()` typically in `end_cb`. If set then an animation might
+         * have been deleted in `anim_completed_handler` and `a` shouldn't be used anymore.
          */
         state.anim_list_changed = false;
 
         if(!a->is_paused && a->run_round != state.anim_run_round) {
-            a->run_round = state.anim_run_round; /*The list readying might be reset so need to know which anim has run already*/
+            a->run_round = state.anim_run_round; /*Mark that this animation has run in this round*/
 
             /*The animation will run now for the first time. Call `start_cb`*/
             if(!a->start_cb_called && a->act_time >= 0) {
@@ -616,15 +685,10 @@ static void anim_timer(lv_timer_t * param)
                 }
             }
         }
-
-        /*If the linked list changed due to anim. delete then it's not safe to continue
-         *the reading of the list from here -> start from the head*/
-        if(state.anim_list_changed)
-            a = lv_ll_get_head(anim_ll_p);
-        else
-            a = lv_ll_get_next(anim_ll_p, a);
     }
+    state.anim_arr_lock--;
 
+    anim_arr_compact();
 }
 
 /**
@@ -644,9 +708,9 @@ static void anim_completed_handler(lv_anim_t * a)
      * - no repeat, reverse play enabled (reverse_duration != 0) and reverse play is completed. */
     if(a->repeat_cnt == 0 && (a->reverse_duration == 0 || a->reverse_play_in_progress == 1)) {
 
-        /*Delete the animation from the list.
+        /*Delete the animation from the index.
          * This way the `completed_cb` will see the animations like it's animation is already deleted*/
-        lv_ll_remove(anim_ll_p, a);
+        anim_index_remove(a);
         /*Flag that the list has changed*/
         anim_mark_list_change();
 
@@ -683,7 +747,7 @@ static void anim_completed_handler(lv_anim_t * a)
 static void anim_mark_list_change(void)
 {
     state.anim_list_changed = true;
-    if(lv_ll_get_head(anim_ll_p) == NULL)
+    if(state.anim_cnt == 0)
         lv_timer_pause(state.timer);
     else
         lv_timer_resume(state.timer);
@@ -729,41 +793,159 @@ static bool remove_concurrent_anims(lv_anim_t * a_current)
 {
     if(a_current->exec_cb == NULL && a_current->custom_exec_cb == NULL) return false;
 
-    lv_anim_t * a;
     bool del_any = false;
-    a = lv_ll_get_head(anim_ll_p);
-    while(a != NULL) {
-        bool del = false;
+    void * var = a_current->var;
+
+    /*Only the animations of the same `var` need to be checked and they are in the same bucket*/
+    lv_anim_node_t * node = state.hash_buckets[anim_hash(var)];
+    while(node != NULL) {
+        lv_anim_t * a = &node->anim;
         /*We can't test for custom_exec_cb equality because in the MicroPython binding
          *a wrapper callback is used here an the real callback data is stored in the `user_data`.
          *Therefore equality check would remove all animations.*/
         if(a != a_current &&
            (a->act_time >= 0 || a->early_apply) &&
-           (a->var == a_current->var) &&
+           (a->var == var) &&
            ((a->exec_cb && a->exec_cb == a_current->exec_cb)
             /*|| (a->custom_exec_cb && a->custom_exec_cb == a_current->custom_exec_cb)*/)) {
-            lv_ll_remove(anim_ll_p, a);
-            if(a->deleted_cb != NULL) a->deleted_cb(a);
-            lv_free(a);
-            /*Read by `anim_timer`. It need to know if a delete occurred in the linked list*/
+            remove_anim(a);
+            /*Read by `anim_timer`. It need to know if a delete occurred*/
             anim_mark_list_change();
 
             del_any = true;
-            del = true;
-        }
 
-        /*Always start from the head on delete, because we don't know
-         *how `anim_ll_p` was changes in `a->deleted_cb` */
-        a = del ? lv_ll_get_head(anim_ll_p) : lv_ll_get_next(anim_ll_p, a);
+            /*Always start from the head of the bucket on delete, because we don't know
+             *how the animations were changed in `a->deleted_cb` */
+            node = state.hash_buckets[anim_hash(var)];
+        }
+        else {
+            node = node->hash_next;
+        }
     }
 
     return del_any;
 }
 
-static void remove_anim(void * a)
+static void remove_anim(lv_anim_t * a)
 {
-    lv_anim_t * anim = a;
-    lv_ll_remove(anim_ll_p, a);
-    if(anim->deleted_cb != NULL) anim->deleted_cb(anim);
+    anim_index_remove(a);
+    if(a->deleted_cb != NULL) a->deleted_cb(a);
     lv_free(a);
 }
+
+static uint32_t anim_hash(const void * var)
+{
+    /*Fibonacci hashing: the low bits of the pointers are usually 0 because of the alignment*/
+    uint32_t h = (uint32_t)((lv_uintptr_t)var >> 3) * 2654435761U;
+    return (h >> 16) & (state.hash_bucket_cnt - 1);
+}
+
+/**
+ * Add an animation to the end of the animation array and to the hash table
+ * @param node      the animation to add. `node->anim.var` needs to be set.
+ * @return          false on memory allocation error
+ */
+static bool anim_index_add(lv_anim_node_t * node)
+{
+    if(state.anim_cnt >= state.hash_bucket_cnt) {
+        uint32_t new_cnt = state.hash_bucket_cnt ? state.hash_bucket_cnt * 2 : LV_ANIM_INDEX_MIN_SIZE;
+        /*It's not a problem if it fails as long as there are buckets*/
+        if(!anim_hash_resize(new_cnt) && state.hash_buckets == NULL) return false;
+    }
+
+    if(state.anim_arr_cnt >= state.anim_arr_size) {
+        /*Make room by removing the deleted slots if there are many*/
+        if(state.anim_arr_cnt - state.anim_cnt >= state.anim_arr_cnt / 4) anim_arr_compact();
+
+        if(state.anim_arr_cnt >= state.anim_arr_size) {
+            uint32_t new_size = state.anim_arr_size ? state.anim_arr_size * 2 : LV_ANIM_INDEX_MIN_SIZE;
+            lv_anim_node_t ** new_arr = lv_realloc(state.anim_arr, new_size * sizeof(lv_anim_node_t *));
+            LV_ASSERT_MALLOC(new_arr);
+            if(new_arr == NULL) return false;
+            state.anim_arr = new_arr;
+            state.anim_arr_size = new_size;
+        }
+    }
+
+    node->arr_idx = state.anim_arr_cnt;
+    state.anim_arr[state.anim_arr_cnt] = node;
+    state.anim_arr_cnt++;
+
+    /*Add to the head of the bucket so that the newest animation is found first*/
+    uint32_t h = anim_hash(node->anim.var);
+    node->hash_next = state.hash_buckets[h];
+    state.hash_buckets[h] = node;
+
+    state.anim_cnt++;
+    return true;
+}
+
+/**
+ * Remove an animation from the hash table and the animation array. Its slot in the array is set to NULL.
+ * @param a         pointer to an animation returned by `lv_anim_start()`
+ */
+static void anim_index_remove(lv_anim_t * a)
+{
+    lv_anim_node_t * node = (lv_anim_node_t *)a;
+
+    lv_anim_node_t ** next_p = &state.hash_buckets[anim_hash(a->var)];
+    while(*next_p) {
+        if(*next_p == node) {
+            *next_p = node->hash_next;
+            break;
+        }
+        next_p = &(*next_p)->hash_next;
+    }
+
+    state.anim_arr[node->arr_idx] = NULL;
+    state.anim_cnt--;
+
+    /*If it was the last, just shrink the array*/
+    while(state.anim_arr_cnt > 0 && state.anim_arr[state.anim_arr_cnt - 1] == NULL) {
+        state.anim_arr_cnt--;
+    }
+}
+
+static bool anim_hash_resize(uint32_t bucket_cnt)
+{
+    lv_anim_node_t ** new_buckets = lv_malloc_zeroed(bucket_cnt * sizeof(lv_anim_node_t *));
+    if(new_buckets == NULL) return false;
+
+    lv_free(state.hash_buckets);
+    state.hash_buckets = new_buckets;
+    state.hash_bucket_cnt = bucket_cnt;
+
+    /*Add from the oldest so that the newest will be the first in each bucket*/
+    uint32_t i;
+    for(i = 0; i < state.anim_arr_cnt; i++) {
+        lv_anim_node_t * node = state.anim_arr[i];
+        if(node == NULL) continue;
+        uint32_t h = anim_hash(node->anim.var);
+        node->hash_next = state.hash_buckets[h];
+        state.hash_buckets[h] = node;
+    }
+
+    return true;
+}
+
+/**
+ * Remove the NULL slots of the deleted animations from the animation array keeping the order.
+ * Does nothing if the array is being iterated.
+ */
+static void anim_arr_compact(void)
+{
+    if(state.anim_arr_lock > 0) return;
+    if(state.anim_arr_cnt == state.anim_cnt) return;
+
+    uint32_t i;
+    uint32_t cnt = 0;
+    for(i = 0; i < state.anim_arr_cnt; i++) {
+        lv_anim_node_t * node = state.anim_arr[i];
+        if(node == NULL) continue;
+        node->arr_idx = cnt;
+        state.anim_arr[cnt] = node;
+        cnt++;
+    }
+    lv_memzero(&state.anim_arr[cnt], (state.anim_arr_cnt - cnt) * sizeof(lv_anim_node_t *));
+    state.anim_arr_cnt = cnt;
+}
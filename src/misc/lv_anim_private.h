@@ -24,11 +24,27 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+/**
+ * A running animation with the data to find it quickly.
+ * `lv_anim_start()` returns a pointer to `anim`.
+ */
+typedef struct _lv_anim_node_t {
+    lv_anim_t anim;                         /**< Must be the first to convert between them*/
+    struct _lv_anim_node_t * hash_next;     /**< Next animation in the same hash bucket*/
+    uint32_t arr_idx;                       /**< Index in `anim_arr`*/
+} lv_anim_node_t;
+
 typedef struct {
     bool anim_list_changed;
     bool anim_run_round;
     lv_timer_t * timer;
-    lv_ll_t anim_ll;
+    lv_anim_node_t ** anim_arr;     /**< Animations in the order of starting. Deleted ones are NULL until compacted.*/
+    uint32_t anim_arr_cnt;          /**< Number of used slots in `anim_arr` (including the NULLs)*/
+    uint32_t anim_arr_size;         /**< Number of allocated slots in `anim_arr`*/
+    uint32_t anim_arr_lock;         /**< >0: `anim_arr` is being iterated, don't compact it*/
+    uint32_t anim_cnt;              /**< Number of running animations*/
+    lv_anim_node_t ** hash_buckets; /**< Animations hashed by `var`*/
+    uint32_t hash_bucket_cnt;       /**< Always a power of 2*/
 } lv_anim_state_t;
 
 /**********************
@@ -19,6 +19,9 @@
 #define event_head LV_GLOBAL_DEFAULT()->event_header
 #define event_last_id LV_GLOBAL_DEFAULT()->event_last_register_id
 
+/*The bit of an event code in `lv_event_list_t.code_mask`*/
+#define EVENT_CODE_BIT(code)    ((uint64_t)1 << ((code) & 0x3F))
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -35,6 +38,9 @@ static void event_mark_deleting(lv_event_list_t * list, lv_event_dsc_t * dsc);
 static bool event_is_marked_deleting(lv_event_dsc_t * dsc);
 static uint32_t event_array_size(lv_event_list_t * list);
 static lv_event_dsc_t ** event_array_at(lv_event_list_t * list, uint32_t index);
+static void event_index_add(lv_event_list_t * list, uint32_t filter);
+static void event_index_rebuild(lv_event_list_t * list);
+static bool event_index_may_match(const lv_event_list_t * list, lv_event_code_t code);
 
 /**********************
  *  STATIC VARIABLES
@@ -74,6 +80,9 @@ lv_result_t lv_event_send(lv_event_list_t * list, lv_event_t * e, bool preproces
     if(list == NULL) return LV_RESULT_OK;
     if(e->deleted) return LV_RESULT_INVALID;
 
+    /*Most events (e.g. the drawing events) have no handlers at all*/
+    if(!event_index_may_match(list, e->code)) return LV_RESULT_OK;
+
     /* When obj is deleted in its own event, it will cause the `list->array` header to be released,
      * but the content still exists, which leads to memory leakage.
      * Therefore, back up the header in advance,
@@ -133,6 +142,7 @@ lv_event_dsc_t * lv_event_add(lv_event_list_t * list, lv_event_cb_t cb, lv_event
     }
 
     lv_array_push_back(&list->array, &dsc);
+    event_index_add(list, filter);
     return dsc;
 }
 
@@ -380,6 +390,7 @@ static void cleanup_event_list(lv_event_list_t * list)
     if(list->has_marked_deleting == false) return;
 
     cleanup_event_list_core(&list->array);
+    event_index_rebuild(list);
 
     list->has_marked_deleting = false;
 }
@@ -401,3 +412,31 @@ static lv_event_dsc_t ** event_array_at(lv_event_list_t * list, uint32_t index)
 {
     return lv_array_at(&list->array, index);
 }
+
+static void event_index_add(lv_event_list_t * list, uint32_t filter)
+{
+    uint32_t code = filter & ~(LV_EVENT_PREPROCESS | LV_EVENT_MARKED_DELETING);
+    if(code == LV_EVENT_ALL) list->has_all_filter = 1;
+    else list->code_mask |= EVENT_CODE_BIT(code);
+}
+
+static void event_index_rebuild(lv_event_list_t * list)
+{
+    list->code_mask = 0;
+    list->has_all_filter = 0;
+
+    const uint32_t size = event_array_size(list);
+    for(uint32_t i = 0; i < size; i++) {
+        event_index_add(list, (*event_array_at(list, i))->filter);
+    }
+}
+
+/**
+ * Check whether the list can have a handler for an event code.
+ * Codes with the same `code % 64` share a bit so `true` only means "maybe".
+ */
+static bool event_index_may_match(const lv_event_list_t * list, lv_event_code_t code)
+{
+    if(list->has_all_filter) return true;
+    return (list->code_mask & EVENT_CODE_BIT(code & ~LV_EVENT_PREPROCESS)) != 0;
+}
@@ -119,9 +119,12 @@ typedef enum {
 
 typedef struct {
     lv_array_t array;
+    uint64_t code_mask;                /**< Bit `code % 64` is set if there can be a handler for `code`.
+                                         Used to skip the list quickly when there is no matching handler */
     uint8_t is_traversing: 1;          /**< True: the list is being nested traversed */
     uint8_t has_marked_deleting: 1;    /**< True: the list has marked deleting objects
                                          when some of events are marked as deleting */
+    uint8_t has_all_filter: 1;         /**< True: there is an `LV_EVENT_ALL` handler in the list */
 } lv_event_list_t;
 
 /**
@@ -21,6 +21,11 @@
 
 #define LV_PROFILER_STR_MAX_LEN 128
 #define LV_PROFILER_TICK_PER_SEC_MAX 1000000000 /* Maximum accuracy: 1 nanosecond */
+#define LV_PROFILER_THREAD_MAX_DEF 8
+#define LV_PROFILER_FLUSH_THREAD_STACK_SIZE (8 * 1024)
+#define LV_PROFILER_BIN_BUF_SIZE 256
+#define LV_PROFILER_BIN_MAGIC "LVPF"
+#define LV_PROFILER_BIN_VERSION 1
 
 #if LV_USE_OS
     #define LV_PROFILER_MULTEX_INIT   lv_mutex_init(&profiler_ctx->mutex)
@@ -34,6 +39,13 @@
     #define LV_PROFILER_MULTEX_UNLOCK
 #endif
 
+/*Order the accesses of the ring buffer's items and indices between the writer and the reader thread*/
+#if LV_USE_OS && (defined(__GNUC__) || defined(__clang__))
+    #define LV_PROFILER_MEMORY_BARRIER __sync_synchronize()
+#else
+    #define LV_PROFILER_MEMORY_BARRIER
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -46,22 +58,55 @@ typedef struct {
     char tag;          /**< The tag of the profiler item */
     const char * func; /**< A pointer to the function associated with the profiler item */
 #if LV_USE_OS
-    int tid;           /**< The thread ID of the profiler item */
-    int cpu;         /**< The CPU ID of the profiler item */
+    int cpu;           /**< The CPU ID of the profiler item */
 #endif
 } lv_profiler_builtin_item_t;
 
+/**
+ * @brief The trace buffer of a thread.
+ * Only its thread writes the items and `head`, only the flush reads the items and writes `tail`,
+ * so no locking is required when an item is added (unless `shared_thread` is set).
+ */
+typedef struct {
+    lv_profiler_builtin_item_t * item_arr; /**< Ring buffer of profiler items */
+    volatile uint32_t head;                /**< Number of items written by the thread */
+    volatile uint32_t tail;                /**< Number of items flushed */
+    volatile uint32_t dropped;             /**< Number of items dropped because the buffer was full */
+    int tid;                               /**< The thread ID */
+    uint64_t last_tick;                    /**< Tick of the last flushed item in binary format */
+    bool announced;                        /**< The thread was already written in binary format */
+} lv_profiler_builtin_thread_t;
+
+/**
+ * @brief An entry of the hash table which assigns IDs to the function names in binary format
+ */
+typedef struct {
+    const char * str;
+    uint32_t id;
+} lv_profiler_builtin_str_t;
+
 /**
  * @brief Structure representing a context for the LVGL built-in profiler
  */
 typedef struct _lv_profiler_builtin_ctx_t {
-    lv_profiler_builtin_item_t * item_arr; /**< Pointer to an array of profiler items */
-    uint32_t item_num;                     /**< Number of profiler items in the array */
-    uint32_t cur_index;                    /**< Index of the current profiler item */
-    lv_profiler_builtin_config_t config;   /**< Configuration for the built-in profiler */
-    bool enable;                           /**< Whether the built-in profiler is enabled */
+    lv_profiler_builtin_thread_t * thread_arr; /**< Trace buffers of the threads */
+    volatile uint32_t thread_cnt;              /**< Number of used elements in `thread_arr` */
+    uint32_t item_num;                         /**< Number of profiler items in a buffer (power of 2) */
+    lv_profiler_builtin_config_t config;       /**< Configuration for the built-in profiler */
+    bool enable;                               /**< Whether the built-in profiler is enabled */
+    bool shared_thread;                        /**< The threads can't be distinguished, lock when writing */
+
+    lv_profiler_builtin_str_t * str_tab;       /**< Hash table of the function names in binary format */
+    uint32_t str_tab_size;
+    uint32_t str_cnt;
+    uint8_t bin_buf[LV_PROFILER_BIN_BUF_SIZE]; /**< Collects the binary data before `flush_bin_cb` */
+    uint32_t bin_buf_used;
+
 #if LV_USE_OS
-    lv_mutex_t mutex;                      /**< Mutex to protect the built-in profiler */
+    lv_mutex_t mutex;                          /**< Mutex to protect the flush and adding threads */
+    lv_thread_t flush_thread;                  /**< Flushes the buffers when they are half full */
+    lv_thread_sync_t flush_sync;
+    volatile bool flush_thread_exit;
 #endif
 } lv_profiler_builtin_ctx_t;
 
@@ -73,7 +118,18 @@ static uint64_t default_tick_get_cb(void);
 static void default_flush_cb(const char * buf);
 static int default_tid_get_cb(void);
 static int default_cpu_get_cb(void);
+static lv_profiler_builtin_thread_t * get_thread(void);
+static lv_profiler_builtin_thread_t * add_thread(int tid);
 static void flush_no_lock(void);
+static void flush_thread_text(lv_profiler_builtin_thread_t * t);
+static void flush_thread_bin(lv_profiler_builtin_thread_t * t);
+static uint32_t get_str_id(const char * str, bool * is_new);
+static void bin_write(const void * data, uint32_t size);
+static void bin_write_uleb(uint64_t v);
+static void bin_flush(void);
+#if LV_USE_OS
+    static void flush_thread_cb(void * user_data);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -97,6 +153,7 @@ void lv_profiler_builtin_config_init(lv_profiler_builtin_config_t * config)
     config->flush_cb = default_flush_cb;
     config->tid_get_cb = default_tid_get_cb;
     config->cpu_get_cb = default_cpu_get_cb;
+    config->thread_max = LV_PROFILER_THREAD_MAX_DEF;
 }
 
 void lv_profiler_builtin_init(const lv_profiler_builtin_config_t * config)
@@ -115,6 +172,9 @@ void lv_profiler_builtin_init(const lv_profiler_builtin_config_t * config)
         return;
     }
 
+    /*Round down to a power of 2 so that the ring buffer index can simply wrap around*/
+    while(num & (num - 1)) num &= num - 1;
+
     /*Free the old item_arr memory*/
     if(profiler_ctx) {
         lv_profiler_builtin_uninit();
@@ -122,21 +182,55 @@ void lv_profiler_builtin_init(const lv_profiler_builtin_config_t * config)
 
     profiler_ctx = lv_malloc_zeroed(sizeof(lv_profiler_builtin_ctx_t));
     LV_ASSERT_MALLOC(profiler_ctx);
+    if(profiler_ctx == NULL) return;
+
+    profiler_ctx->config = *config;
+#if LV_USE_OS
+    /*Without a way to tell the threads apart they need to share a buffer*/
+    profiler_ctx->shared_thread = profiler_ctx->config.tid_get_cb == default_tid_get_cb;
+    profiler_ctx->config.thread_max = LV_CLAMP(1, profiler_ctx->config.thread_max, 255);
+#else
+    /*There is only one thread*/
+    profiler_ctx->config.thread_max = 1;
+#endif
 
-    profiler_ctx->item_arr = lv_malloc(num * sizeof(lv_profiler_builtin_item_t));
-    LV_ASSERT_MALLOC(profiler_ctx->item_arr);
-    if(profiler_ctx->item_arr == NULL) {
+    profiler_ctx->thread_arr = lv_malloc_zeroed(profiler_ctx->config.thread_max * sizeof(lv_profiler_builtin_thread_t));
+    LV_ASSERT_MALLOC(profiler_ctx->thread_arr);
+    if(profiler_ctx->thread_arr == NULL) {
         lv_free(profiler_ctx);
         profiler_ctx = NULL;
-        LV_LOG_ERROR("malloc failed for item_arr");
+        LV_LOG_ERROR("malloc failed for thread_arr");
         return;
     }
 
     LV_PROFILER_MULTEX_INIT;
     profiler_ctx->item_num = num;
-    profiler_ctx->config = *config;
 
-    if(profiler_ctx->config.flush_cb) {
+#if LV_USE_OS
+    lv_thread_sync_init(&profiler_ctx->flush_sync);
+    lv_thread_init(&profiler_ctx->flush_thread, "profiler", LV_THREAD_PRIO_LOW, flush_thread_cb,
+                   LV_PROFILER_FLUSH_THREAD_STACK_SIZE, profiler_ctx);
+#else
+    /*Allocate the only buffer now to check the available memory*/
+    if(add_thread(1) == NULL) {
+        lv_free(profiler_ctx->thread_arr);
+        lv_free(profiler_ctx);
+        profiler_ctx = NULL;
+        LV_LOG_ERROR("malloc failed for item_arr");
+        return;
+    }
+#endif
+
+    if(profiler_ctx->config.flush_bin_cb) {
+        uint8_t header[9];
+        lv_memcpy(header, LV_PROFILER_BIN_MAGIC, 4);
+        header[4] = LV_PROFILER_BIN_VERSION;
+        uint32_t tick_per_sec = profiler_ctx->config.tick_per_sec;
+        uint32_t i;
+        for(i = 0; i < 4; i++) header[5 + i] = (uint8_t)(tick_per_sec >> (i * 8));
+        profiler_ctx->config.flush_bin_cb(header, sizeof(header));
+    }
+    else if(profiler_ctx->config.flush_cb) {
         /* add profiler header for perfetto */
         profiler_ctx->config.flush_cb("# tracer: nop\n");
         profiler_ctx->config.flush_cb("#\n");
@@ -150,8 +244,22 @@ void lv_profiler_builtin_init(const lv_profiler_builtin_config_t * config)
 void lv_profiler_builtin_uninit(void)
 {
     LV_ASSERT_NULL(profiler_ctx);
+
+#if LV_USE_OS
+    profiler_ctx->flush_thread_exit = true;
+    lv_thread_sync_signal(&profiler_ctx->flush_sync);
+    lv_thread_delete(&profiler_ctx->flush_thread);
+    lv_thread_sync_delete(&profiler_ctx->flush_sync);
+#endif
+
     LV_PROFILER_MULTEX_DEINIT;
-    lv_free(profiler_ctx->item_arr);
+
+    uint32_t i;
+    for(i = 0; i < profiler_ctx->thread_cnt; i++) {
+        lv_free(profiler_ctx->thread_arr[i].item_arr);
+    }
+    lv_free(profiler_ctx->thread_arr);
+    lv_free(profiler_ctx->str_tab);
     lv_free(profiler_ctx);
     profiler_ctx = NULL;
 }
@@ -183,26 +291,49 @@ void lv_profiler_builtin_write(const char * func, char tag)
         return;
     }
 
-    LV_PROFILER_MULTEX_LOCK;
+    lv_profiler_builtin_thread_t * t = get_thread();
+    if(t == NULL) {
+        return;
+    }
+
+#if LV_USE_OS
+    bool shared = profiler_ctx->shared_thread;
+    if(shared) LV_PROFILER_MULTEX_LOCK;
+#endif
 
-    if(profiler_ctx->cur_index >= profiler_ctx->item_num) {
+    uint32_t head = t->head;
+    if(head - t->tail >= profiler_ctx->item_num) {
+#if LV_USE_OS
+        /*Don't wait for the flush thread, it would change the timing of this thread*/
+        if(!shared) {
+            t->dropped++;
+            return;
+        }
+#endif
         flush_no_lock();
-        profiler_ctx->cur_index = 0;
     }
 
-    lv_profiler_builtin_item_t * item = &profiler_ctx->item_arr[profiler_ctx->cur_index];
+    lv_profiler_builtin_item_t * item = &t->item_arr[head & (profiler_ctx->item_num - 1)];
     item->func = func;
     item->tag = tag;
     item->tick = profiler_ctx->config.tick_get_cb();
 
 #if LV_USE_OS
-    item->tid = profiler_ctx->config.tid_get_cb();
     item->cpu = profiler_ctx->config.cpu_get_cb();
 #endif
 
-    profiler_ctx->cur_index++;
+    /*Publish the item only when it's completely written*/
+    LV_PROFILER_MEMORY_BARRIER;
+    t->head = head + 1;
 
-    LV_PROFILER_MULTEX_UNLOCK;
+#if LV_USE_OS
+    if(shared) LV_PROFILER_MULTEX_UNLOCK;
+
+    /*Wake up the flush thread once when the buffer gets half full*/
+    if(head + 1 - t->tail == profiler_ctx->item_num / 2) {
+        lv_thread_sync_signal(&profiler_ctx->flush_sync);
+    }
+#endif
 }
 
 /**********************
@@ -229,25 +360,109 @@ static int default_cpu_get_cb(void)
     return 0;
 }
 
+/**
+ * Find the trace buffer of the current thread.
+ * The threads are only appended to `thread_arr`, so it can be searched without locking.
+ */
+static lv_profiler_builtin_thread_t * get_thread(void)
+{
+#if LV_USE_OS
+    int tid = profiler_ctx->config.tid_get_cb();
+    uint32_t cnt = profiler_ctx->thread_cnt;
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        if(profiler_ctx->thread_arr[i].tid == tid) return &profiler_ctx->thread_arr[i];
+    }
+
+    return add_thread(tid);
+#else
+    return &profiler_ctx->thread_arr[0];
+#endif
+}
+
+/**
+ * Create a trace buffer for a new thread. Runs only once per thread.
+ */
+static lv_profiler_builtin_thread_t * add_thread(int tid)
+{
+    lv_profiler_builtin_thread_t * t = NULL;
+
+    LV_PROFILER_MULTEX_LOCK;
+
+    /*Check again as another thread could add the same one meanwhile*/
+    uint32_t i;
+    for(i = 0; i < profiler_ctx->thread_cnt; i++) {
+        if(profiler_ctx->thread_arr[i].tid == tid) {
+            t = &profiler_ctx->thread_arr[i];
+            break;
+        }
+    }
+
+    if(t == NULL && profiler_ctx->thread_cnt < profiler_ctx->config.thread_max) {
+        lv_profiler_builtin_item_t * item_arr = lv_malloc(profiler_ctx->item_num * sizeof(lv_profiler_builtin_item_t));
+        LV_ASSERT_MALLOC(item_arr);
+        if(item_arr) {
+            t = &profiler_ctx->thread_arr[profiler_ctx->thread_cnt];
+            t->item_arr = item_arr;
+            t->tid = tid;
+
+            /*Make the buffer visible to the other threads only when it's ready*/
+            LV_PROFILER_MEMORY_BARRIER;
+            profiler_ctx->thread_cnt++;
+        }
+    }
+    else if(t == NULL) {
+        LV_LOG_WARN("thread_max (%d) is reached, the events of thread %d are ignored",
+                    (int)profiler_ctx->config.thread_max, tid);
+    }
+
+    LV_PROFILER_MULTEX_UNLOCK;
+
+    return t;
+}
+
 static void flush_no_lock(void)
 {
-    if(!profiler_ctx->config.flush_cb) {
+    if(!profiler_ctx->config.flush_cb && !profiler_ctx->config.flush_bin_cb) {
         LV_LOG_WARN("flush_cb is not registered");
         return;
     }
 
-    uint32_t cur = 0;
+    uint32_t i;
+    for(i = 0; i < profiler_ctx->thread_cnt; i++) {
+        lv_profiler_builtin_thread_t * t = &profiler_ctx->thread_arr[i];
+        if(t->dropped) {
+            LV_LOG_WARN("%d events of thread %d were dropped, the buffer is full. Increase buf_size.",
+                        (int)t->dropped, t->tid);
+            t->dropped = 0;
+        }
+
+        if(profiler_ctx->config.flush_bin_cb) flush_thread_bin(t);
+        else flush_thread_text(t);
+    }
+
+    if(profiler_ctx->config.flush_bin_cb) bin_flush();
+}
+
+static void flush_thread_text(lv_profiler_builtin_thread_t * t)
+{
     char buf[LV_PROFILER_STR_MAX_LEN];
     uint32_t tick_per_sec = profiler_ctx->config.tick_per_sec;
-    while(cur < profiler_ctx->cur_index) {
-        lv_profiler_builtin_item_t * item = &profiler_ctx->item_arr[cur++];
+    uint32_t tail = t->tail;
+    uint32_t head = t->head;
+    LV_PROFILER_MEMORY_BARRIER;
+
+    while(tail != head) {
+        lv_profiler_builtin_item_t * item = &t->item_arr[tail & (profiler_ctx->item_num - 1)];
+        tail++;
+
         uint32_t sec = item->tick / tick_per_sec;
         uint32_t nsec = (item->tick % tick_per_sec) * (LV_PROFILER_TICK_PER_SEC_MAX / tick_per_sec);
 
 #if LV_USE_OS
         lv_snprintf(buf, sizeof(buf),
                     "   LVGL-%d [%d] %" LV_PRIu32 ".%09" LV_PRIu32 ": tracing_mark_write: %c|1|%s\n",
-                    item->tid,
+                    t->tid,
                     item->cpu,
                     sec,
                     nsec,
@@ -263,6 +478,171 @@ static void flush_no_lock(void)
 #endif
         profiler_ctx->config.flush_cb(buf);
     }
+
+    /*Release the items only after they are read*/
+    LV_PROFILER_MEMORY_BARRIER;
+    t->tail = tail;
+}
+
+/**
+ * Write the items in binary format. All numbers are little endian.
+ * - Header:   "LVPF", u8 version, u32 tick_per_sec
+ * - Thread:   'T', u8 thread index, i32 thread ID
+ * - String:   'S', ULEB128 string ID, u8 length, characters
+ * - Event:    'B' or 'E', u8 thread index, u8 CPU, ULEB128 string ID, ULEB128 tick delta to the
+ *             previous event of the thread
+ */
+static void flush_thread_bin(lv_profiler_builtin_thread_t * t)
+{
+    uint8_t thread_idx = (uint8_t)(t - profiler_ctx->thread_arr);
+    uint32_t tail = t->tail;
+    uint32_t head = t->head;
+    LV_PROFILER_MEMORY_BARRIER;
+
+    if(tail == head) return;
+
+    if(!t->announced) {
+        uint8_t rec[6];
+        rec[0] = 'T';
+        rec[1] = thread_idx;
+        uint32_t i;
+        for(i = 0; i < 4; i++) rec[2 + i] = (uint8_t)((uint32_t)t->tid >> (i * 8));
+        bin_write(rec, sizeof(rec));
+        t->announced = true;
+    }
+
+    while(tail != head) {
+        lv_profiler_builtin_item_t * item = &t->item_arr[tail & (profiler_ctx->item_num - 1)];
+        tail++;
+
+        bool is_new;
+        uint32_t id = get_str_id(item->func, &is_new);
+        if(is_new) {
+            uint32_t len = (uint32_t)lv_strlen(item->func);
+            if(len > 255) len = 255;
+            uint8_t c = 'S';
+            bin_write(&c, 1);
+            bin_write_uleb(id);
+            c = (uint8_t)len;
+            bin_write(&c, 1);
+            bin_write(item->func, len);
+        }
+
+        uint8_t rec[3];
+        rec[0] = (uint8_t)item->tag;
+        rec[1] = thread_idx;
+#if LV_USE_OS
+        rec[2] = (uint8_t)item->cpu;
+#else
+        rec[2] = 0;
+#endif
+        bin_write(rec, sizeof(rec));
+        bin_write_uleb(id);
+        bin_write_uleb(item->tick - t->last_tick);
+        t->last_tick = item->tick;
+    }
+
+    LV_PROFILER_MEMORY_BARRIER;
+    t->tail = tail;
+}
+
+/**
+ * Get the ID of a function name. The names are identified by their address, as when they are printed as text.
+ */
+static uint32_t get_str_id(const char * str, bool * is_new)
+{
+    /*Keep the load factor below 50%*/
+    if(profiler_ctx->str_cnt * 2 >= profiler_ctx->str_tab_size) {
+        uint32_t new_size = profiler_ctx->str_tab_size ? profiler_ctx->str_tab_size * 2 : 64;
+        lv_profiler_builtin_str_t * new_tab = lv_malloc_zeroed(new_size * sizeof(lv_profiler_builtin_str_t));
+        LV_ASSERT_MALLOC(new_tab);
+        if(new_tab) {
+            uint32_t i;
+            for(i = 0; i < profiler_ctx->str_tab_size; i++) {
+                lv_profiler_builtin_str_t * e = &profiler_ctx->str_tab[i];
+                if(e->str == NULL) continue;
+                uint32_t h = (uint32_t)(((uintptr_t)e->str >> 2) * 2654435761u) & (new_size - 1);
+                while(new_tab[h].str) h = (h + 1) & (new_size - 1);
+                new_tab[h] = *e;
+            }
+            lv_free(profiler_ctx->str_tab);
+            profiler_ctx->str_tab = new_tab;
+            profiler_ctx->str_tab_size = new_size;
+        }
+        else if(profiler_ctx->str_cnt + 1 >= profiler_ctx->str_tab_size) {
+            /*No space for a new entry: write the string again*/
+            *is_new = true;
+            return profiler_ctx->str_cnt;
+        }
+    }
+
+    uint32_t mask = profiler_ctx->str_tab_size - 1;
+    uint32_t h = (uint32_t)(((uintptr_t)str >> 2) * 2654435761u) & mask;
+    while(profiler_ctx->str_tab[h].str) {
+        if(profiler_ctx->str_tab[h].str == str) {
+            *is_new = false;
+            return profiler_ctx->str_tab[h].id;
+        }
+        h = (h + 1) & mask;
+    }
+
+    profiler_ctx->str_tab[h].str = str;
+    profiler_ctx->str_tab[h].id = profiler_ctx->str_cnt;
+    profiler_ctx->str_cnt++;
+    *is_new = true;
+    return profiler_ctx->str_tab[h].id;
+}
+
+static void bin_write(const void * data, uint32_t size)
+{
+    const uint8_t * d = data;
+    while(size) {
+        if(profiler_ctx->bin_buf_used == LV_PROFILER_BIN_BUF_SIZE) bin_flush();
+
+        uint32_t n = LV_MIN(size, LV_PROFILER_BIN_BUF_SIZE - profiler_ctx->bin_buf_used);
+        lv_memcpy(&profiler_ctx->bin_buf[profiler_ctx->bin_buf_used], d, n);
+        profiler_ctx->bin_buf_used += n;
+        d += n;
+        size -= n;
+    }
 }
 
+static void bin_write_uleb(uint64_t v)
+{
+    uint8_t buf[10];
+    uint32_t len = 0;
+    do {
+        buf[len] = v & 0x7F;
+        v >>= 7;
+        if(v) buf[len] |= 0x80;
+        len++;
+    } while(v);
+
+    bin_write(buf, len);
+}
+
+static void bin_flush(void)
+{
+    if(profiler_ctx->bin_buf_used == 0) return;
+
+    profiler_ctx->config.flush_bin_cb(profiler_ctx->bin_buf, profiler_ctx->bin_buf_used);
+    profiler_ctx->bin_buf_used = 0;
+}
+
+#if LV_USE_OS
+static void flush_thread_cb(void * user_data)
+{
+    lv_profiler_builtin_ctx_t * ctx = user_data;
+
+    while(1) {
+        lv_thread_sync_wait(&ctx->flush_sync);
+        if(ctx->flush_thread_exit) break;
+
+        lv_mutex_lock(&ctx->mutex);
+        flush_no_lock();
+        lv_mutex_unlock(&ctx->mutex);
+    }
+}
+#endif
+
 #endif /*LV_USE_PROFILER_BUILTIN*/
@@ -36,6 +36,13 @@ struct _lv_profiler_builtin_config_t {
     void (*flush_cb)(const char * buf); /**< Callback function to flush the profiling data */
     int (*tid_get_cb)(void);            /**< Callback function to get the current thread ID */
     int (*cpu_get_cb)(void);            /**< Callback function to get the current CPU */
+    uint32_t thread_max;                /**< Maximum number of threads with their own trace buffer */
+
+    /**
+     * If set, flush the profiling data in a compact binary format instead of text.
+     * Use `scripts/trace_bin_to_json.py` to convert it to Chrome/Perfetto JSON.
+     */
+    void (*flush_bin_cb)(const void * buf, uint32_t size);
 };
 
 
@@ -306,8 +306,22 @@ void lv_style_set_prop(lv_style_t * style, lv_style_prop_t prop, lv_style_value_
     lv_style_prop_t * props;
     int32_t i;
 
+#if LV_STYLE_SORTED_PROPS
+    /*Keep the properties sorted, so find where the new property should go*/
+    int32_t insert_i = 0;
+#endif
+
     if(style->values_and_props) {
         props = (lv_style_prop_t *)style->values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
+#if LV_STYLE_SORTED_PROPS
+        insert_i = lv_style_find_sorted_prop(props, style->prop_cnt, prop);
+        if(insert_i < style->prop_cnt && props[insert_i] == prop) {
+            lv_style_value_t * values = (lv_style_value_t *)style->values_and_props;
+            values[insert_i] = value;
+            LV_PROFILER_STYLE_END;
+            return;
+        }
+#else
         for(i = style->prop_cnt - 1; i >= 0; i--) {
             if(props[i] == prop) {
                 lv_style_value_t * values = (lv_style_value_t *)style->values_and_props;
@@ -316,6 +330,7 @@ void lv_style_set_prop(lv_style_t * style, lv_style_prop_t prop, lv_style_value_
                 return;
             }
         }
+#endif
     }
 
     size_t size = (style->prop_cnt + 1) * (sizeof(lv_style_value_t) + sizeof(lv_style_prop_t));
@@ -338,9 +353,20 @@ void lv_style_set_prop(lv_style_t * style, lv_style_prop_t prop, lv_style_value_
     props = values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
     lv_style_value_t * values = (lv_style_value_t *)values_and_props;
 
+#if LV_STYLE_SORTED_PROPS
+    /*Make place for the new property and value*/
+    for(i = style->prop_cnt - 1; i > insert_i; i--) {
+        props[i] = props[i - 1];
+        values[i] = values[i - 1];
+    }
+
+    props[insert_i] = prop;
+    values[insert_i] = value;
+#else
     /*Set the new property and value*/
     props[style->prop_cnt - 1] = prop;
     values[style->prop_cnt - 1] = value;
+#endif
 
     uint32_t group = lv_style_get_prop_group(prop);
     style->has_group |= (uint32_t)1 << group;
@@ -487,6 +487,28 @@ void lv_style_transition_dsc_init(lv_style_transition_dsc_t * tr, const lv_style
  */
 lv_style_value_t lv_style_prop_get_default(lv_style_prop_t prop);
 
+#if LV_STYLE_SORTED_PROPS
+/**
+ * Find a property in the sorted property list of a non-constant style with binary search.
+ * @param props     the sorted property IDs of a style
+ * @param prop_cnt  number of properties in `props`
+ * @param prop      the property to find
+ * @return          index of `prop` if it's found, else the index where it should be inserted
+ */
+static inline uint32_t lv_style_find_sorted_prop(const lv_style_prop_t * props, uint32_t prop_cnt,
+                                                 lv_style_prop_t prop)
+{
+    uint32_t first = 0;
+    uint32_t last = prop_cnt;
+    while(first < last) {
+        uint32_t mid = (first + last) >> 1;
+        if(props[mid] < prop) first = mid + 1;
+        else last = mid;
+    }
+    return first;
+}
+#endif
+
 /**
  * Get the value of a property
  * @param style pointer to a style
@@ -512,6 +534,14 @@ static inline lv_style_res_t lv_style_get_prop_inlined(const lv_style_t * style,
     }
     else {
         lv_style_prop_t * props = (lv_style_prop_t *)style->values_and_props + style->prop_cnt * sizeof(lv_style_value_t);
+#if LV_STYLE_SORTED_PROPS
+        uint32_t i = lv_style_find_sorted_prop(props, style->prop_cnt, prop);
+        if(i < style->prop_cnt && props[i] == prop) {
+            lv_style_value_t * values = (lv_style_value_t *)style->values_and_props;
+            *value = values[i];
+            return LV_STYLE_RES_FOUND;
+        }
+#else
         uint32_t i;
         for(i = 0; i < style->prop_cnt; i++) {
             if(props[i] == prop) {
@@ -520,6 +550,7 @@ static inline lv_style_res_t lv_style_get_prop_inlined(const lv_style_t * style,
                 return LV_STYLE_RES_FOUND;
             }
         }
+#endif
     }
     return LV_STYLE_RES_NOT_FOUND;
 }
@@ -24,6 +24,9 @@
 #define state LV_GLOBAL_DEFAULT()->timer_state
 #define timer_ll_p &(state.timer_ll)
 
+/*Deadlines are compared as signed differences so keep them closer than 2^31 ms*/
+#define TIMER_HEAP_MAX_DELAY 0x40000000
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -34,6 +37,17 @@
 static bool lv_timer_exec(lv_timer_t * timer);
 static uint32_t lv_timer_time_remaining(lv_timer_t * timer);
 static void lv_timer_handler_resume(void);
+#if LV_USE_TIMER_HEAP
+    static void timer_heap_run_due(void);
+    static uint32_t timer_heap_time_until_next(void);
+    static void timer_heap_insert(lv_timer_t * timer);
+    static void timer_heap_remove(lv_timer_t * timer);
+    static void timer_heap_update(lv_timer_t * timer);
+    static void timer_heap_set(uint32_t idx, lv_timer_t * timer);
+    static void timer_heap_sift_up(uint32_t idx);
+    static void timer_heap_sift_down(uint32_t idx);
+    static bool timer_heap_less(const lv_timer_t * a, const lv_timer_t * b);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -90,6 +104,11 @@ LV_ATTRIBUTE_TIMER_HANDLER uint32_t lv_timer_handler(void)
         }
     }
 
+#if LV_USE_TIMER_HEAP
+    /*Run only the timers which are due*/
+    timer_heap_run_due();
+    uint32_t time_until_next = timer_heap_time_until_next();
+#else
     /*Run all timer from the list*/
     lv_timer_t * next;
     lv_timer_t * timer_active;
@@ -127,6 +146,7 @@ LV_ATTRIBUTE_TIMER_HANDLER uint32_t lv_timer_handler(void)
 
         next = lv_ll_get_next(timer_head, next); /*Find the next timer*/
     }
+#endif
 
     state_p->busy_time += lv_tick_elaps(handler_start);
     uint32_t idle_period_time = lv_tick_elaps(state_p->idle_period_start);
@@ -166,6 +186,24 @@ lv_timer_t * lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void * us
 {
     lv_timer_t * new_timer = NULL;
 
+#if LV_USE_TIMER_HEAP
+    /*Make room for all timers in the heap so that resuming a timer can't fail later*/
+    if(state.timer_cnt >= state.buf_size) {
+        uint32_t new_size = state.buf_size ? state.buf_size * 2 : 16;
+        lv_timer_t ** new_heap = lv_realloc(state.heap, new_size * sizeof(lv_timer_t *));
+        LV_ASSERT_MALLOC(new_heap);
+        if(new_heap == NULL) return NULL;
+        state.heap = new_heap;
+
+        lv_timer_t ** new_due = lv_realloc(state.due, new_size * sizeof(lv_timer_t *));
+        LV_ASSERT_MALLOC(new_due);
+        if(new_due == NULL) return NULL;
+        state.due = new_due;
+
+        state.buf_size = new_size;
+    }
+#endif
+
     new_timer = lv_ll_ins_head(timer_ll_p);
     LV_ASSERT_MALLOC(new_timer);
     if(new_timer == NULL) return NULL;
@@ -178,6 +216,13 @@ lv_timer_t * lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void * us
     new_timer->user_data = user_data;
     new_timer->auto_delete = true;
 
+#if LV_USE_TIMER_HEAP
+    new_timer->seq = state.seq_cnt++;
+    new_timer->heap_idx = LV_TIMER_HEAP_IDX_NONE;
+    state.timer_cnt++;
+    timer_heap_insert(new_timer);
+#endif
+
     state.timer_created = true;
 
     lv_timer_handler_resume();
@@ -193,6 +238,20 @@ void lv_timer_set_cb(lv_timer_t * timer, lv_timer_cb_t timer_cb)
 
 void lv_timer_delete(lv_timer_t * timer)
 {
+#if LV_USE_TIMER_HEAP
+    if(timer->heap_idx == LV_TIMER_HEAP_IDX_DUE) {
+        /*Don't let `lv_timer_handler()` run it*/
+        uint32_t i;
+        for(i = 0; i < state.due_cnt; i++) {
+            if(state.due[i] == timer) state.due[i] = NULL;
+        }
+    }
+    else {
+        timer_heap_remove(timer);
+    }
+    state.timer_cnt--;
+#endif
+
     lv_ll_remove(timer_ll_p, timer);
     state.timer_deleted = true;
 
@@ -203,12 +262,18 @@ void lv_timer_pause(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->paused = true;
+#if LV_USE_TIMER_HEAP
+    timer_heap_remove(timer);
+#endif
 }
 
 void lv_timer_resume(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->paused = false;
+#if LV_USE_TIMER_HEAP
+    timer_heap_insert(timer);
+#endif
     lv_timer_handler_resume();
 }
 
@@ -216,12 +281,18 @@ void lv_timer_set_period(lv_timer_t * timer, uint32_t period)
 {
     LV_ASSERT_NULL(timer);
     timer->period = period;
+#if LV_USE_TIMER_HEAP
+    timer_heap_update(timer);
+#endif
 }
 
 void lv_timer_ready(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->last_run = lv_tick_get() - timer->period - 1;
+#if LV_USE_TIMER_HEAP
+    timer_heap_update(timer);
+#endif
 }
 
 void lv_timer_set_repeat_count(lv_timer_t * timer, int32_t repeat_count)
@@ -246,6 +317,9 @@ void lv_timer_reset(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->last_run = lv_tick_get();
+#if LV_USE_TIMER_HEAP
+    timer_heap_update(timer);
+#endif
     lv_timer_handler_resume();
 }
 
@@ -260,6 +334,17 @@ void lv_timer_core_deinit(void)
     lv_timer_enable(false);
 
     lv_ll_clear(timer_ll_p);
+
+#if LV_USE_TIMER_HEAP
+    lv_free(state.heap);
+    lv_free(state.due);
+    state.heap = NULL;
+    state.due = NULL;
+    state.heap_cnt = 0;
+    state.due_cnt = 0;
+    state.buf_size = 0;
+    state.timer_cnt = 0;
+#endif
 }
 
 uint32_t lv_timer_get_idle(void)
@@ -386,3 +471,151 @@ void lv_timer_handler_set_resume_cb(lv_timer_handler_resume_cb_t cb, void * data
     state.resume_cb = cb;
     state.resume_data = data;
 }
+
+#if LV_USE_TIMER_HEAP
+
+/**
+ * Take the due timers from the heap and run them in the order of `timer_ll`.
+ * Start again if a timer was created or deleted in the meantime, like the list based handler.
+ */
+static void timer_heap_run_due(void)
+{
+    bool changed;
+    do {
+        changed = false;
+
+        uint32_t now = lv_tick_get();
+        state.due_cnt = 0;
+        while(state.heap_cnt > 0 && (int32_t)(state.heap[0]->deadline - now) <= 0) {
+            lv_timer_t * timer = state.heap[0];
+            timer_heap_remove(timer);
+            timer->heap_idx = LV_TIMER_HEAP_IDX_DUE;
+
+            /*Insertion sort: the newest (the first in `timer_ll`) first.
+             *Usually only a few timers are due at once.*/
+            uint32_t i = state.due_cnt;
+            while(i > 0 && state.due[i - 1]->seq < timer->seq) {
+                state.due[i] = state.due[i - 1];
+                i--;
+            }
+            state.due[i] = timer;
+            state.due_cnt++;
+        }
+
+        uint32_t i;
+        for(i = 0; i < state.due_cnt; i++) {
+            lv_timer_t * timer = state.due[i];
+            if(timer == NULL) continue; /*Deleted by an other timer*/
+
+            state.timer_deleted = false;
+            state.timer_created = false;
+            lv_timer_exec(timer);
+            if(state.timer_created || state.timer_deleted) changed = true;
+
+            /*Deleted by itself*/
+            if(state.due[i] == NULL) continue;
+
+            /*Schedule it again with the new `last_run`*/
+            timer->heap_idx = LV_TIMER_HEAP_IDX_NONE;
+            if(!timer->paused) timer_heap_insert(timer);
+        }
+        state.due_cnt = 0;
+
+        if(changed) LV_TRACE_TIMER("Check the due timers again because a timer was created or deleted");
+    } while(changed);
+}
+
+static uint32_t timer_heap_time_until_next(void)
+{
+    if(state.heap_cnt == 0) return LV_NO_TIMER_READY;
+
+    int32_t diff = (int32_t)(state.heap[0]->deadline - lv_tick_get());
+    return diff > 0 ? (uint32_t)diff : 0;
+}
+
+/**
+ * Add a not paused timer to the heap. Does nothing if it's already there or it's being run.
+ */
+static void timer_heap_insert(lv_timer_t * timer)
+{
+    if(timer->heap_idx != LV_TIMER_HEAP_IDX_NONE) return;
+
+    /*Very long periods are checked again when the limited delay is over*/
+    uint32_t remaining = lv_timer_time_remaining(timer);
+    timer->deadline = lv_tick_get() + LV_MIN(remaining, TIMER_HEAP_MAX_DELAY);
+
+    timer_heap_set(state.heap_cnt, timer);
+    state.heap_cnt++;
+    timer_heap_sift_up(timer->heap_idx);
+}
+
+/**
+ * Remove a timer from the heap if it's there
+ */
+static void timer_heap_remove(lv_timer_t * timer)
+{
+    uint32_t idx = timer->heap_idx;
+    if(idx >= state.heap_cnt) return;
+
+    timer->heap_idx = LV_TIMER_HEAP_IDX_NONE;
+    state.heap_cnt--;
+    if(idx == state.heap_cnt) return;
+
+    /*Move the last one to the free slot and restore the heap order*/
+    lv_timer_t * last = state.heap[state.heap_cnt];
+    timer_heap_set(idx, last);
+    timer_heap_sift_up(idx);
+    timer_heap_sift_down(last->heap_idx);
+}
+
+/**
+ * Update the position of a timer in the heap after its `last_run` or `period` was changed
+ */
+static void timer_heap_update(lv_timer_t * timer)
+{
+    if(timer->heap_idx >= state.heap_cnt) return;
+
+    timer_heap_remove(timer);
+    timer_heap_insert(timer);
+}
+
+static void timer_heap_set(uint32_t idx, lv_timer_t * timer)
+{
+    state.heap[idx] = timer;
+    timer->heap_idx = idx;
+}
+
+static void timer_heap_sift_up(uint32_t idx)
+{
+    lv_timer_t * timer = state.heap[idx];
+    while(idx > 0) {
+        uint32_t parent = (idx - 1) / 2;
+        if(!timer_heap_less(timer, state.heap[parent])) break;
+        timer_heap_set(idx, state.heap[parent]);
+        idx = parent;
+    }
+    timer_heap_set(idx, timer);
+}
+
+static void timer_heap_sift_down(uint32_t idx)
+{
+    lv_timer_t * timer = state.heap[idx];
+    while(1) {
+        uint32_t child = idx * 2 + 1;
+        if(child >= state.heap_cnt) break;
+        if(child + 1 < state.heap_cnt && timer_heap_less(state.heap[child + 1], state.heap[child])) child++;
+        if(!timer_heap_less(state.heap[child], timer)) break;
+        timer_heap_set(idx, state.heap[child]);
+        idx = child;
+    }
+    timer_heap_set(idx, timer);
+}
+
+static bool timer_heap_less(const lv_timer_t * a, const lv_timer_t * b)
+{
+    int32_t diff = (int32_t)(a->deadline - b->deadline);
+    if(diff != 0) return diff < 0;
+    return a->seq > b->seq;
+}
+
+#endif /*LV_USE_TIMER_HEAP*/
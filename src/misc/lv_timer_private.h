@@ -20,6 +20,13 @@ extern "C" {
  *      DEFINES
  *********************/
 
+#if LV_USE_TIMER_HEAP
+/** The timer is paused so it's not in the heap */
+#define LV_TIMER_HEAP_IDX_NONE  0xFFFFFFFF
+/** The timer was taken out of the heap by `lv_timer_handler()` to run it */
+#define LV_TIMER_HEAP_IDX_DUE   0xFFFFFFFE
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -35,6 +42,11 @@ struct _lv_timer_t {
     int32_t repeat_count;      /**< 1: One time;  -1 : infinity;  n>0: residual times */
     uint32_t paused : 1;
     uint32_t auto_delete : 1;
+#if LV_USE_TIMER_HEAP
+    uint32_t deadline;         /**< Tick when the timer should run next. Used to order the timer heap */
+    uint32_t heap_idx;         /**< Index in the timer heap, or `LV_TIMER_HEAP_IDX_NONE`/`LV_TIMER_HEAP_IDX_DUE` */
+    uint32_t seq;              /**< Creation order, used to run the due timers in the order of `timer_ll` */
+#endif
 };
 
 typedef struct {
@@ -54,6 +66,16 @@ typedef struct {
 
     lv_timer_handler_resume_cb_t resume_cb;
     void * resume_data;
+
+#if LV_USE_TIMER_HEAP
+    lv_timer_t ** heap;        /**< Min-heap of the not paused timers ordered by `deadline` */
+    uint32_t heap_cnt;
+    lv_timer_t ** due;         /**< The timers being run by `lv_timer_handler()`. Deleted ones are set to NULL */
+    uint32_t due_cnt;
+    uint32_t buf_size;         /**< Allocated size of `heap` and `due` (at least the number of timers) */
+    uint32_t timer_cnt;
+    uint32_t seq_cnt;
+#endif
 } lv_timer_state_t;
 
 /**********************
@@ -149,6 +149,8 @@ typedef struct _lv_image_cache_data_t lv_image_cache_data_t;
 
 typedef struct _lv_image_header_cache_data_t lv_image_header_cache_data_t;
 
+typedef struct _lv_image_tile_cache_data_t lv_image_tile_cache_data_t;
+
 typedef struct _lv_draw_mask_t lv_draw_mask_t;
 
 typedef struct _lv_grad_t lv_grad_t;
@@ -165,12 +167,20 @@ typedef struct _lv_obj_style_t lv_obj_style_t;
 
 typedef struct _lv_obj_style_transition_dsc_t lv_obj_style_transition_dsc_t;
 
+typedef struct _lv_obj_style_value_cache_entry_t lv_obj_style_value_cache_entry_t;
+
 typedef struct _lv_hit_test_info_t lv_hit_test_info_t;
 
 typedef struct _lv_cover_check_info_t lv_cover_check_info_t;
 
 typedef struct _lv_obj_spec_attr_t lv_obj_spec_attr_t;
 
+typedef struct _lv_obj_hit_index_t lv_obj_hit_index_t;
+
+typedef struct _lv_obj_hit_index_iter_t lv_obj_hit_index_iter_t;
+
+typedef struct _lv_layout_cache_t lv_layout_cache_t;
+
 typedef struct _lv_image_t lv_image_t;
 
 typedef struct _lv_animimg_t lv_animimg_t;
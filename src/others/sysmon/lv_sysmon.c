@@ -196,6 +196,8 @@ static void perf_monitor_disp_event_cb(lv_event_t * e)
         case LV_EVENT_REFR_READY:
             info->measured.refr_elaps_sum += lv_tick_elaps(info->measured.refr_start);
             info->measured.refr_cnt++;
+            info->measured.inv_px_sum += lv_display_get_invalidated_px_count(disp);
+            info->measured.refr_px_sum += lv_display_get_refreshed_px_count(disp);
             break;
         case LV_EVENT_RENDER_START:
             info->measured.render_in_progress = 1;
@@ -262,6 +264,9 @@ static void perf_update_timer_cb(lv_timer_t * t)
                                                                      info->measured.flush_in_render_elaps_sum) /
                                                                     info->measured.render_cnt) : 0;
 
+    info->calculated.inv_px_avg = info->measured.refr_cnt ? (info->measured.inv_px_sum / info->measured.refr_cnt) : 0;
+    info->calculated.refr_px_avg = info->measured.refr_cnt ? (info->measured.refr_px_sum / info->measured.refr_cnt) : 0;
+
     info->calculated.cpu_avg_total = ((info->calculated.cpu_avg_total * (info->calculated.run_cnt - 1)) +
                                       info->calculated.cpu) / info->calculated.run_cnt;
     info->calculated.fps_avg_total = ((info->calculated.fps_avg_total * (info->calculated.run_cnt - 1)) +
@@ -289,10 +294,11 @@ static void perf_observer_cb(lv_observer_t * observer, lv_subject_t * subject)
     LV_LOG("sysmon: "
            "%" LV_PRIu32 " FPS (refr_cnt: %" LV_PRIu32 " | redraw_cnt: %" LV_PRIu32"), "
            "refr %" LV_PRIu32 "ms (render %" LV_PRIu32 "ms | flush %" LV_PRIu32 "ms), "
-           "CPU %" LV_PRIu32 "%%\n",
+           "CPU %" LV_PRIu32 "%%, "
+           "px redrawn %" LV_PRIu32 " (invalidated %" LV_PRIu32 ")\n",
            perf->calculated.fps, perf->measured.refr_cnt, perf->measured.render_cnt,
            perf->calculated.refr_avg_time, perf->calculated.render_avg_time, perf->calculated.flush_avg_time,
-           perf->calculated.cpu);
+           perf->calculated.cpu, perf->calculated.refr_px_avg, perf->calculated.inv_px_avg);
 #else
     lv_label_set_text_fmt(
         label,
@@ -46,6 +46,8 @@ struct _lv_sysmon_perf_info_t {
         uint32_t flush_in_render_elaps_sum;
         uint32_t flush_not_in_render_start;
         uint32_t flush_not_in_render_elaps_sum;
+        uint32_t inv_px_sum;
+        uint32_t refr_px_sum;
         uint32_t last_report_timestamp;
         uint32_t render_in_progress : 1;
     } measured;
@@ -56,6 +58,8 @@ struct _lv_sysmon_perf_info_t {
         uint32_t refr_avg_time;
         uint32_t render_avg_time;       /**< Pure rendering time without flush time*/
         uint32_t flush_avg_time;        /**< Pure flushing time without rendering time*/
+        uint32_t inv_px_avg;            /**< Invalidated pixels per refresh*/
+        uint32_t refr_px_avg;           /**< Redrawn pixels per refresh. Can be more than `inv_px_avg` due to joined areas*/
         uint32_t cpu_avg_total;
         uint32_t fps_avg_total;
         uint32_t run_cnt;
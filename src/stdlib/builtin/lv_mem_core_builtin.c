@@ -38,18 +38,54 @@
 #endif
 #define state LV_GLOBAL_DEFAULT()->tlsf_state
 
+#if LV_USE_MEM_SLAB
+    /*Target size of a slab page. Pages of the large classes hold at least `SLAB_MIN_SLOT_CNT` slots*/
+    #define SLAB_PAGE_SIZE          1024
+    #define SLAB_MIN_SLOT_CNT       4
+    #define SLAB_PAGE_HEADER_SIZE   ((sizeof(lv_mem_slab_page_t) + ALIGN_MASK) & ~ALIGN_MASK)
+
+    /*Every slot starts with a word storing the address of its page with bit 0 set.
+     *TLSF stores the size of the block in front of the pointers it returns and there
+     *bit 0 is the "free" flag which is always 0 for allocated blocks.
+     *So the word before a pointer tells which allocator it belongs to.*/
+    #define SLAB_TAG                ((size_t)1)
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
+#if LV_USE_MEM_SLAB
+struct _lv_mem_slab_page_t {
+    lv_mem_slab_page_t * prev;
+    lv_mem_slab_page_t * next;
+    void * free_head;           /**< Linked list of the free slots (stored in the free slots)*/
+    uint16_t used_cnt;
+    uint16_t slot_cnt;
+    uint8_t class_idx;
+};
+#endif
 
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static void * tlsf_malloc_counted(size_t size);
+static void tlsf_free_counted(void * p);
 static void lv_mem_walker(void * ptr, size_t size, int used, void * user);
+#if LV_USE_MEM_SLAB
+    static void * slab_malloc(size_t size);
+    static int32_t slab_get_class(size_t size);
+    static void * slab_alloc(uint32_t class_idx);
+    static void slab_free(void * p);
+    static void slab_page_link(lv_mem_slab_class_t * c, lv_mem_slab_page_t * page);
+    static void slab_page_unlink(lv_mem_slab_class_t * c, lv_mem_slab_page_t * page);
+#endif
 
 /**********************
  *  STATIC VARIABLES
  **********************/
+#if LV_USE_MEM_SLAB
+static const uint16_t slab_obj_size[LV_MEM_SLAB_CLASS_CNT] = {16, 32, 48, 64, 96, 128, 192, 256};
+#endif
 
 /**********************
  *      MACROS
@@ -102,6 +138,10 @@ void lv_mem_deinit(void)
 {
     lv_ll_clear(&state.pool_ll);
     lv_tlsf_destroy(state.tlsf);
+#if LV_USE_MEM_SLAB
+    /*The slab pages were in the destroyed pools*/
+    lv_memzero(state.slab, sizeof(state.slab));
+#endif
 #if LV_USE_OS
     lv_mutex_delete(&state.mutex);
 #endif
@@ -141,12 +181,11 @@ void * lv_malloc_core(size_t size)
 #if LV_USE_OS
     lv_mutex_lock(&state.mutex);
 #endif
-    void * p = lv_tlsf_malloc(state.tlsf, size);
-
-    if(p) {
-        state.cur_used += lv_tlsf_block_size(p);
-        state.max_used = LV_MAX(state.cur_used, state.max_used);
-    }
+#if LV_USE_MEM_SLAB
+    void * p = slab_malloc(size);
+#else
+    void * p = tlsf_malloc_counted(size);
+#endif
 
 #if LV_USE_OS
     lv_mutex_unlock(&state.mutex);
@@ -160,13 +199,33 @@ void * lv_realloc_core(void * p, size_t new_size)
     lv_mutex_lock(&state.mutex);
 #endif
 
-    size_t old_size = lv_tlsf_block_size(p);
-    void * p_new = lv_tlsf_realloc(state.tlsf, p, new_size);
-
-    if(p_new) {
-        state.cur_used -= old_size;
-        state.cur_used += lv_tlsf_block_size(p_new);
-        state.max_used = LV_MAX(state.cur_used, state.max_used);
+    void * p_new;
+#if LV_USE_MEM_SLAB
+    if(p && (((size_t *)p)[-1] & SLAB_TAG)) {
+        lv_mem_slab_page_t * page = (lv_mem_slab_page_t *)(((size_t *)p)[-1] & ~SLAB_TAG);
+        size_t obj_size = slab_obj_size[page->class_idx];
+        if(new_size <= obj_size) {
+            p_new = p;
+        }
+        else {
+            p_new = slab_malloc(new_size);
+            if(p_new) {
+                lv_memcpy(p_new, p, obj_size);
+                slab_free(p);
+            }
+        }
+    }
+    else
+#endif
+    {
+        size_t old_size = lv_tlsf_block_size(p);
+        p_new = lv_tlsf_realloc(state.tlsf, p, new_size);
+
+        if(p_new) {
+            state.cur_used -= old_size;
+            state.cur_used += lv_tlsf_block_size(p_new);
+            state.max_used = LV_MAX(state.cur_used, state.max_used);
+        }
     }
 #if LV_USE_OS
     lv_mutex_unlock(&state.mutex);
@@ -181,13 +240,16 @@ void lv_free_core(void * p)
     lv_mutex_lock(&state.mutex);
 #endif
 
+#if LV_USE_MEM_SLAB
+    if(((size_t *)p)[-1] & SLAB_TAG) slab_free(p);
+    else
+#endif
+    {
 #if LV_MEM_ADD_JUNK
-    lv_memset(p, 0xbb, lv_tlsf_block_size(data));
+        lv_memset(p, 0xbb, lv_tlsf_block_size(p));
 #endif
-    size_t size = lv_tlsf_block_size(p);
-    lv_tlsf_free(state.tlsf, p);
-    if(state.cur_used > size) state.cur_used -= size;
-    else state.cur_used = 0;
+        tlsf_free_counted(p);
+    }
 
 #if LV_USE_OS
     lv_mutex_unlock(&state.mutex);
@@ -216,6 +278,17 @@ void lv_mem_monitor_core(lv_mem_monitor_t * mon_p)
 
     mon_p->max_used = state.max_used;
 
+#if LV_USE_MEM_SLAB
+    uint32_t i;
+    for(i = 0; i < LV_MEM_SLAB_CLASS_CNT; i++) {
+        mon_p->slab[i].obj_size = slab_obj_size[i];
+        mon_p->slab[i].page_cnt = state.slab[i].page_cnt;
+        mon_p->slab[i].total_cnt = state.slab[i].total_cnt;
+        mon_p->slab[i].used_cnt = state.slab[i].used_cnt;
+        mon_p->slab[i].max_used_cnt = state.slab[i].max_used_cnt;
+    }
+#endif
+
     LV_TRACE_MEM("finished");
 }
 
@@ -254,6 +327,26 @@ lv_result_t lv_mem_test_core(void)
  *   STATIC FUNCTIONS
  **********************/
 
+static void * tlsf_malloc_counted(size_t size)
+{
+    void * p = lv_tlsf_malloc(state.tlsf, size);
+
+    if(p) {
+        state.cur_used += lv_tlsf_block_size(p);
+        state.max_used = LV_MAX(state.cur_used, state.max_used);
+    }
+
+    return p;
+}
+
+static void tlsf_free_counted(void * p)
+{
+    size_t size = lv_tlsf_block_size(p);
+    lv_tlsf_free(state.tlsf, p);
+    if(state.cur_used > size) state.cur_used -= size;
+    else state.cur_used = 0;
+}
+
 static void lv_mem_walker(void * ptr, size_t size, int used, void * user)
 {
     LV_UNUSED(ptr);
@@ -270,4 +363,125 @@ static void lv_mem_walker(void * ptr, size_t size, int used, void * user)
             mon_p->free_biggest_size = size;
     }
 }
+
+#if LV_USE_MEM_SLAB
+
+/**
+ * Allocate from the slab of the matching size class or from TLSF if there is none
+ */
+static void * slab_malloc(size_t size)
+{
+    void * p = NULL;
+    int32_t class_idx = slab_get_class(size);
+    if(class_idx >= 0) p = slab_alloc(class_idx);
+
+    /*If no new slab page can be allocated the small block still might fit into TLSF*/
+    if(p == NULL) p = tlsf_malloc_counted(size);
+
+    return p;
+}
+
+static int32_t slab_get_class(size_t size)
+{
+    if(size > slab_obj_size[LV_MEM_SLAB_CLASS_CNT - 1]) return -1;
+
+    int32_t i;
+    for(i = 0; i < LV_MEM_SLAB_CLASS_CNT; i++) {
+        if(size <= slab_obj_size[i]) return i;
+    }
+
+    return -1;
+}
+
+static void * slab_alloc(uint32_t class_idx)
+{
+    lv_mem_slab_class_t * c = &state.slab[class_idx];
+    lv_mem_slab_page_t * page = c->avail_head;
+
+    if(page == NULL) {
+        size_t slot_size = sizeof(size_t) + slab_obj_size[class_idx];
+        size_t slot_cnt = (SLAB_PAGE_SIZE - SLAB_PAGE_HEADER_SIZE) / slot_size;
+        if(slot_cnt < SLAB_MIN_SLOT_CNT) slot_cnt = SLAB_MIN_SLOT_CNT;
+
+        page = tlsf_malloc_counted(SLAB_PAGE_HEADER_SIZE + slot_cnt * slot_size);
+        if(page == NULL) return NULL;
+
+        page->used_cnt = 0;
+        page->slot_cnt = (uint16_t)slot_cnt;
+        page->class_idx = (uint8_t)class_idx;
+
+        /*Build the free list backward to hand out the slots in increasing address order*/
+        uint8_t * slot = (uint8_t *)page + SLAB_PAGE_HEADER_SIZE + slot_cnt * slot_size;
+        void * next = NULL;
+        size_t i;
+        for(i = 0; i < slot_cnt; i++) {
+            slot -= slot_size;
+            *(size_t *)slot = (size_t)page | SLAB_TAG;
+            void * obj = slot + sizeof(size_t);
+            *(void **)obj = next;
+            next = obj;
+        }
+        page->free_head = next;
+
+        slab_page_link(c, page);
+        c->page_cnt++;
+        c->total_cnt += slot_cnt;
+    }
+
+    void * p = page->free_head;
+    page->free_head = *(void **)p;
+    page->used_cnt++;
+    if(page->free_head == NULL) slab_page_unlink(c, page);
+
+    c->used_cnt++;
+    if(c->used_cnt > c->max_used_cnt) c->max_used_cnt = c->used_cnt;
+
+    return p;
+}
+
+static void slab_free(void * p)
+{
+    lv_mem_slab_page_t * page = (lv_mem_slab_page_t *)(((size_t *)p)[-1] & ~SLAB_TAG);
+    lv_mem_slab_class_t * c = &state.slab[page->class_idx];
+
+#if LV_MEM_ADD_JUNK
+    lv_memset(p, 0xbb, slab_obj_size[page->class_idx]);
+#endif
+
+    /*It was full so it wasn't in the list of available pages*/
+    if(page->free_head == NULL) slab_page_link(c, page);
+
+    *(void **)p = page->free_head;
+    page->free_head = p;
+    page->used_cnt--;
+    c->used_cnt--;
+
+    /*Give back empty pages to TLSF right away to not hold memory which is not used*/
+    if(page->used_cnt == 0) {
+        slab_page_unlink(c, page);
+        c->page_cnt--;
+        c->total_cnt -= page->slot_cnt;
+        tlsf_free_counted(page);
+    }
+}
+
+static void slab_page_link(lv_mem_slab_class_t * c, lv_mem_slab_page_t * page)
+{
+    page->prev = NULL;
+    page->next = c->avail_head;
+    if(c->avail_head) c->avail_head->prev = page;
+    c->avail_head = page;
+}
+
+static void slab_page_unlink(lv_mem_slab_class_t * c, lv_mem_slab_page_t * page)
+{
+    if(page->prev) page->prev->next = page->next;
+    else c->avail_head = page->next;
+    if(page->next) page->next->prev = page->prev;
+    page->prev = NULL;
+    page->next = NULL;
+}
+
+#endif /*LV_USE_MEM_SLAB*/
+
 #endif /*LV_STDLIB_BUILTIN*/
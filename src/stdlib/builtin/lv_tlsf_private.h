@@ -17,6 +17,7 @@ extern "C" {
  *********************/
 
 #include "lv_tlsf.h"
+#include "../lv_mem.h"
 #include "../../osal/lv_os.h"
 
 /*********************
@@ -27,6 +28,18 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+#if LV_USE_MEM_SLAB
+typedef struct _lv_mem_slab_page_t lv_mem_slab_page_t;
+
+typedef struct {
+    lv_mem_slab_page_t * avail_head;    /**< Pages having at least one free slot*/
+    uint32_t page_cnt;
+    uint32_t total_cnt;
+    uint32_t used_cnt;
+    uint32_t max_used_cnt;
+} lv_mem_slab_class_t;
+#endif
+
 typedef struct {
 #if LV_USE_OS
     lv_mutex_t mutex;
@@ -35,6 +48,9 @@ typedef struct {
     size_t cur_used;
     size_t max_used;
     lv_ll_t  pool_ll;
+#if LV_USE_MEM_SLAB
+    lv_mem_slab_class_t slab[LV_MEM_SLAB_CLASS_CNT];
+#endif
 } lv_tlsf_state_t;
 
 /**********************
@@ -23,12 +23,30 @@ extern "C" {
  *      DEFINES
  *********************/
 
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN && LV_USE_MEM_SLAB
+/** Number of slab size classes */
+#define LV_MEM_SLAB_CLASS_CNT   8
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
 
 typedef void * lv_mem_pool_t;
 
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN && LV_USE_MEM_SLAB
+/**
+ * Statistics of a slab size class.
+ */
+typedef struct {
+    uint32_t obj_size;      /**< Largest allocation served by this class */
+    uint32_t page_cnt;      /**< Number of slab pages allocated from the heap */
+    uint32_t total_cnt;     /**< Number of slots in all pages */
+    uint32_t used_cnt;      /**< Number of slots in use */
+    uint32_t max_used_cnt;  /**< Max number of slots used at once */
+} lv_mem_slab_monitor_t;
+#endif
+
 /**
  * Heap information structure.
  */
@@ -41,6 +59,9 @@ typedef struct {
     size_t max_used;    /**< Max size of Heap memory used */
     uint8_t used_pct;   /**< Percentage used */
     uint8_t frag_pct;   /**< Amount of fragmentation */
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN && LV_USE_MEM_SLAB
+    lv_mem_slab_monitor_t slab[LV_MEM_SLAB_CLASS_CNT];  /**< Statistics of each slab size class */
+#endif
 } lv_mem_monitor_t;
 
 /**********************
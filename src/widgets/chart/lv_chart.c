@@ -9,11 +9,13 @@
 #include "lv_chart_private.h"
 #include "../../misc/lv_area_private.h"
 #include "../../draw/lv_draw_private.h"
+#include "../../draw/lv_draw_vector_private.h"
 #include "../../core/lv_obj_private.h"
 #include "../../core/lv_obj_class_private.h"
 #if LV_USE_CHART != 0
 
 #include "../../misc/lv_assert.h"
+#include "../../misc/cache/lv_cache.h"
 
 /*********************
  *      DEFINES
@@ -25,10 +27,30 @@
 #define LV_CHART_POINT_CNT_DEF 10
 #define LV_CHART_LABEL_MAX_TEXT_LENGTH 16
 
+/*Draw decimated series with lines instead of a path if the edges of the path
+ *cross a row more times than this on average*/
+#define DECIMATED_PATH_JAG_MAX 16
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+typedef struct {
+    uint32_t col_size;      /**< Number of points in a column*/
+    uint32_t col_cnt;       /**< Number of columns if the first column is complete*/
+    uint32_t phase;         /**< Number of points already shifted out from the first column*/
+    uint32_t last_col;      /**< Index of the newest column*/
+} decimation_t;
+
+typedef struct {
+    int32_t x;
+    lv_value_precise_t top;
+    lv_value_precise_t bottom;
+    lv_value_precise_t first;
+    lv_value_precise_t last;
+    bool connected;         /**< There is a column with value before it*/
+} decimated_col_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -37,7 +59,16 @@ static void lv_chart_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void lv_chart_event(const lv_obj_class_t * class_p, lv_event_t * e);
 
 static void draw_div_lines(lv_obj_t * obj, lv_layer_t * layer);
-static void draw_series_line(lv_obj_t * obj, lv_layer_t * layer);
+static void draw_series_line(lv_obj_t * obj, lv_layer_t * layer, lv_chart_series_t * only_ser);
+static void draw_series_line_cached(lv_obj_t * obj, lv_layer_t * layer);
+static void draw_series_line_decimated(lv_obj_t * obj, lv_layer_t * layer, lv_chart_series_t * ser,
+                                       lv_draw_line_dsc_t * line_dsc, const decimation_t * d, const lv_area_t * content);
+static bool get_decimation(lv_obj_t * obj, const lv_chart_series_t * ser, int32_t w, decimation_t * d);
+static bool invalidate_decimated_shift(lv_obj_t * obj, lv_chart_series_t * ser);
+static int32_t get_streaming_step(lv_obj_t * obj, const lv_chart_series_t * ser, int32_t w, uint32_t * pos_cnt);
+static bool scroll_series_cache(lv_obj_t * obj, lv_chart_series_t * ser);
+static void render_series_cache(lv_obj_t * obj, lv_chart_series_t * ser, const lv_area_t areas[], uint32_t area_cnt);
+static void drop_series_cache(lv_obj_t * obj, bool free_buf);
 static void draw_series_bar(lv_obj_t * obj, lv_layer_t * layer);
 static void draw_series_scatter(lv_obj_t * obj, lv_layer_t * layer);
 static void draw_cursors(lv_obj_t * obj, lv_layer_t * layer);
@@ -122,6 +153,7 @@ void lv_chart_set_point_count(lv_obj_t * obj, uint32_t cnt)
         }
         if(!ser->y_ext_buf_assigned) new_points_alloc(obj, ser, cnt, &ser->y_points);
         ser->start_point = 0;
+        ser->shift_cnt = 0;
     }
 
     chart->point_cnt = cnt;
@@ -169,7 +201,30 @@ void lv_chart_set_update_mode(lv_obj_t * obj, lv_chart_update_mode_t update_mode
     if(chart->update_mode == update_mode) return;
 
     chart->update_mode = update_mode;
-    lv_obj_invalidate(obj);
+    lv_chart_refresh(obj);
+}
+
+void lv_chart_set_decimation(lv_obj_t * obj, lv_chart_decimation_t decimation)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    if(chart->decimation == decimation) return;
+
+    chart->decimation = decimation;
+    lv_chart_refresh(obj);
+}
+
+void lv_chart_set_streaming(lv_obj_t * obj, bool en)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    if(chart->streaming == en) return;
+
+    chart->streaming = en;
+    if(!en) drop_series_cache(obj, true);
+    lv_chart_refresh(obj);
 }
 
 void lv_chart_set_div_line_count(lv_obj_t * obj, uint8_t hdiv, uint8_t vdiv)
@@ -201,6 +256,22 @@ uint32_t lv_chart_get_point_count(const lv_obj_t * obj)
     return chart->point_cnt;
 }
 
+lv_chart_decimation_t lv_chart_get_decimation(const lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    return chart->decimation;
+}
+
+bool lv_chart_get_streaming(const lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    return chart->streaming;
+}
+
 uint32_t lv_chart_get_x_start_point(const lv_obj_t * obj, lv_chart_series_t * ser)
 {
     LV_ASSERT_NULL(ser);
@@ -293,6 +364,7 @@ void lv_chart_refresh(lv_obj_t * obj)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+    drop_series_cache(obj, false);
     lv_obj_invalidate(obj);
 }
 
@@ -370,6 +442,10 @@ void lv_chart_remove_series(lv_obj_t * obj, lv_chart_series_t * series)
     lv_chart_t * chart    = (lv_chart_t *)obj;
     if(!series->y_ext_buf_assigned && series->y_points) lv_free(series->y_points);
     if(!series->x_ext_buf_assigned && series->x_points) lv_free(series->x_points);
+    if(series->cache) {
+        lv_image_cache_drop(series->cache);
+        lv_draw_buf_destroy(series->cache);
+    }
 
     lv_ll_remove(&chart->series_ll, series);
     lv_free(series);
@@ -412,6 +488,7 @@ void lv_chart_set_x_start_point(lv_obj_t * obj, lv_chart_series_t * ser, uint32_
     lv_chart_t * chart  = (lv_chart_t *)obj;
     if(id >= chart->point_cnt) return;
     ser->start_point = id;
+    ser->cache_valid = 0;
 }
 
 lv_chart_series_t * lv_chart_get_series_next(const lv_obj_t * obj, const lv_chart_series_t * ser)
@@ -490,6 +567,7 @@ void lv_chart_set_all_values(lv_obj_t * obj, lv_chart_series_t * ser, int32_t va
         ser->y_points[i] = value;
     }
     ser->start_point = 0;
+    ser->shift_cnt = 0;
     lv_chart_refresh(obj);
 }
 
@@ -500,6 +578,22 @@ void lv_chart_set_next_value(lv_obj_t * obj, lv_chart_series_t * ser, int32_t va
 
     lv_chart_t * chart  = (lv_chart_t *)obj;
     ser->y_points[ser->start_point] = value;
+    ser->shift_cnt++;
+
+    /*In streaming mode scroll the rendered series and render only the new values*/
+    if(chart->streaming) {
+        ser->start_point = (ser->start_point + 1) % chart->point_cnt;
+        if(scroll_series_cache(obj, ser)) return;
+        ser->start_point = ser->start_point == 0 ? chart->point_cnt - 1 : ser->start_point - 1;
+        ser->cache_valid = 0;
+    }
+
+    /*While the decimated columns are not scrolled only the edges of the chart change*/
+    if(chart->update_mode == LV_CHART_UPDATE_MODE_SHIFT && invalidate_decimated_shift(obj, ser)) {
+        ser->start_point = (ser->start_point + 1) % chart->point_cnt;
+        return;
+    }
+
     invalidate_point(obj, ser->start_point);
     ser->start_point = (ser->start_point + 1) % chart->point_cnt;
     invalidate_point(obj, ser->start_point);
@@ -560,7 +654,7 @@ void lv_chart_set_ext_y_array(lv_obj_t * obj, lv_chart_series_t * ser, int32_t a
     if(!ser->y_ext_buf_assigned && ser->y_points) lv_free(ser->y_points);
     ser->y_ext_buf_assigned = true;
     ser->y_points = array;
-    lv_obj_invalidate(obj);
+    lv_chart_refresh(obj);
 }
 
 void lv_chart_set_ext_x_array(lv_obj_t * obj, lv_chart_series_t * ser, int32_t array[])
@@ -571,7 +665,7 @@ void lv_chart_set_ext_x_array(lv_obj_t * obj, lv_chart_series_t * ser, int32_t a
     if(!ser->x_ext_buf_assigned && ser->x_points) lv_free(ser->x_points);
     ser->x_ext_buf_assigned = true;
     ser->x_points = array;
-    lv_obj_invalidate(obj);
+    lv_chart_refresh(obj);
 }
 
 int32_t * lv_chart_get_y_array(const lv_obj_t * obj, lv_chart_series_t * ser)
@@ -660,6 +754,10 @@ static void lv_chart_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
 
         if(!ser->y_ext_buf_assigned) lv_free(ser->y_points);
         if(!ser->x_ext_buf_assigned) lv_free(ser->x_points);
+        if(ser->cache) {
+            lv_image_cache_drop(ser->cache);
+            lv_draw_buf_destroy(ser->cache);
+        }
 
         lv_ll_remove(&chart->series_ll, ser);
         lv_free(ser);
@@ -709,12 +807,16 @@ static void lv_chart_event(const lv_obj_class_t * class_p, lv_event_t * e)
         invalidate_point(obj, chart->pressed_point_id);
         chart->pressed_point_id = LV_CHART_POINT_NONE;
     }
+    else if(code == LV_EVENT_SIZE_CHANGED || code == LV_EVENT_STYLE_CHANGED) {
+        drop_series_cache(obj, false);
+    }
     else if(code == LV_EVENT_DRAW_MAIN) {
         lv_layer_t * layer = lv_event_get_layer(e);
         draw_div_lines(obj, layer);
 
         if(lv_ll_is_empty(&chart->series_ll) == false) {
-            if(chart->type == LV_CHART_TYPE_LINE) draw_series_line(obj, layer);
+            if(chart->type == LV_CHART_TYPE_LINE && chart->streaming) draw_series_line_cached(obj, layer);
+            else if(chart->type == LV_CHART_TYPE_LINE) draw_series_line(obj, layer, NULL);
             else if(chart->type == LV_CHART_TYPE_BAR) draw_series_bar(obj, layer);
             else if(chart->type == LV_CHART_TYPE_SCATTER) draw_series_scatter(obj, layer);
         }
@@ -800,7 +902,7 @@ static void draw_div_lines(lv_obj_t * obj, lv_layer_t * layer)
     layer->_clip_area = clip_area_ori;
 }
 
-static void draw_series_line(lv_obj_t * obj, lv_layer_t * layer)
+static void draw_series_line(lv_obj_t * obj, lv_layer_t * layer, lv_chart_series_t * only_ser)
 {
     lv_area_t clip_area;
     if(lv_area_intersect(&clip_area, &obj->coords, &layer->_clip_area) == false) return;
@@ -845,11 +947,17 @@ static void draw_series_line(lv_obj_t * obj, lv_layer_t * layer)
     /*If there are at least as many points as pixels then draw only vertical lines*/
     bool crowded_mode = (int32_t)chart->point_cnt >= w;
 
+    lv_area_t content;
+    content.x1 = x_ofs;
+    content.y1 = y_ofs;
+    content.x2 = x_ofs + w - 1;
+    content.y2 = y_ofs + h - 1;
+
     line_dsc.base.id1 = lv_ll_get_len(&chart->series_ll) - 1;
     point_dsc_default.base.id1 = line_dsc.base.id1;
     /*Go through all data lines*/
     LV_LL_READ_BACK(&chart->series_ll, ser) {
-        if(ser->hidden) {
+        if(ser->hidden || (only_ser && ser != only_ser)) {
             line_dsc.base.id1--;
             point_dsc_default.base.id1--;
             continue;
@@ -859,10 +967,31 @@ static void draw_series_line(lv_obj_t * obj, lv_layer_t * layer)
         line_dsc.base.id2 = 0;
         point_dsc_default.base.id2 = 0;
 
+        /*In streaming mode the points are a whole number of pixels apart and aligned to the right*/
+        int32_t ser_w = w;
+        int32_t ser_x_ofs = x_ofs;
+        uint32_t pos_cnt;
+        int32_t step = get_streaming_step(obj, ser, w, &pos_cnt);
+        if(step) {
+            ser_w = step * (int32_t)(pos_cnt - 1);
+            ser_x_ofs = x_ofs + w - ser_w;
+        }
+
+        decimation_t decimation;
+        if(get_decimation(obj, ser, w, &decimation)) {
+            lv_area_t ser_content = content;
+            ser_content.x1 = ser_x_ofs;
+            ser_content.x2 = ser_x_ofs + ser_w - 1;
+            draw_series_line_decimated(obj, layer, ser, &line_dsc, &decimation, &ser_content);
+            point_dsc_default.base.id1--;
+            line_dsc.base.id1--;
+            continue;
+        }
+
         int32_t start_point = chart->update_mode == LV_CHART_UPDATE_MODE_SHIFT ? ser->start_point : 0;
 
-        line_dsc.p1.x = x_ofs;
-        line_dsc.p2.x = x_ofs;
+        line_dsc.p1.x = ser_x_ofs;
+        line_dsc.p2.x = ser_x_ofs;
 
         int32_t p_act = start_point;
         int32_t p_prev = start_point;
@@ -878,7 +1007,7 @@ static void draw_series_line(lv_obj_t * obj, lv_layer_t * layer)
             line_dsc.p1.y = line_dsc.p2.y;
 
             if(line_dsc.p1.x > clip_area_ori.x2 + point_w + 1) break;
-            line_dsc.p2.x = (lv_value_precise_t)((w * i) / (chart->point_cnt - 1)) + x_ofs;
+            line_dsc.p2.x = (lv_value_precise_t)((ser_w * i) / (chart->point_cnt - 1)) + ser_x_ofs;
 
             p_act = (start_point + i) % chart->point_cnt;
 
@@ -955,6 +1084,210 @@ static void draw_series_line(lv_obj_t * obj, lv_layer_t * layer)
     layer->_clip_area = clip_area_ori;
 }
 
+static lv_value_precise_t get_decimated_y(lv_obj_t * obj, const lv_chart_series_t * ser, int32_t v,
+                                          const lv_area_t * content)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    int32_t h = lv_area_get_height(content);
+    int32_t y_tmp = (int32_t)(v - chart->ymin[ser->y_axis_sec]) * h;
+    y_tmp = y_tmp / (chart->ymax[ser->y_axis_sec] - chart->ymin[ser->y_axis_sec]);
+    return h - y_tmp + content->y1;
+}
+
+#if LV_USE_VECTOR_GRAPHIC
+static void add_decimated_band(lv_vector_path_t * path, const decimated_col_t * cols, uint32_t cnt, float hw)
+{
+    /*Go along the top edge and return on the bottom edge*/
+    lv_fpoint_t pt = {(float)cols[0].x - hw, (float)cols[0].top - hw};
+    lv_vector_path_move_to(path, &pt);
+
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        pt.x = (float)cols[i].x;
+        pt.y = (float)cols[i].top - hw;
+        lv_vector_path_line_to(path, &pt);
+    }
+
+    pt.x = (float)cols[cnt - 1].x + hw;
+    lv_vector_path_line_to(path, &pt);
+    pt.y = (float)cols[cnt - 1].bottom + hw;
+    lv_vector_path_line_to(path, &pt);
+
+    for(i = cnt; i > 0; i--) {
+        pt.x = (float)cols[i - 1].x;
+        pt.y = (float)cols[i - 1].bottom + hw;
+        lv_vector_path_line_to(path, &pt);
+    }
+
+    pt.x = (float)cols[0].x - hw;
+    lv_vector_path_line_to(path, &pt);
+    lv_vector_path_close(path);
+}
+
+static bool draw_decimated_path(lv_layer_t * layer, const lv_draw_line_dsc_t * line_dsc,
+                                const decimated_col_t * cols, uint32_t col_cnt, int32_t h)
+{
+    /*A band which goes up and down in every column would be slower to rasterize than the lines*/
+    int32_t jag = 0;
+    uint32_t i;
+    for(i = 1; i < col_cnt; i++) {
+        if(!cols[i].connected) continue;
+        jag += (int32_t)(LV_ABS(cols[i].top - cols[i - 1].top) + LV_ABS(cols[i].bottom - cols[i - 1].bottom));
+    }
+    if(jag > DECIMATED_PATH_JAG_MAX * h) return false;
+
+    lv_vector_path_t * path = lv_vector_path_create(LV_VECTOR_PATH_QUALITY_MEDIUM);
+    float hw = (float)line_dsc->width / 2;
+    uint32_t band_start = 0;
+    for(i = 1; i <= col_cnt; i++) {
+        if(i == col_cnt || !cols[i].connected) {
+            add_decimated_band(path, &cols[band_start], i - band_start, hw);
+            band_start = i;
+        }
+    }
+
+    lv_vector_dsc_t * vector_dsc = lv_vector_dsc_create(layer);
+    lv_vector_dsc_set_fill_color(vector_dsc, line_dsc->color);
+    lv_vector_dsc_set_fill_opa(vector_dsc, line_dsc->opa);
+    lv_vector_dsc_add_path(vector_dsc, path);
+    vector_dsc->tasks.base = line_dsc->base;    /*To allow hooking the task in LV_EVENT_DRAW_TASK_ADDED*/
+    lv_draw_vector(vector_dsc);
+    lv_vector_dsc_delete(vector_dsc);
+    lv_vector_path_delete(path);
+    return true;
+}
+#endif
+
+static void draw_series_line_decimated(lv_obj_t * obj, lv_layer_t * layer, lv_chart_series_t * ser,
+                                       lv_draw_line_dsc_t * line_dsc, const decimation_t * d, const lv_area_t * content)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    int32_t w = lv_area_get_width(content);
+
+    /*Skip the columns which are not connected to a column in the clip area*/
+    int32_t col_w = (w + d->col_cnt - 2) / (d->col_cnt - 1);
+    int32_t x_min = LV_MAX(content->x1, layer->_clip_area.x1 - col_w - line_dsc->width);
+    int32_t x_max = layer->_clip_area.x2 + col_w + line_dsc->width;
+
+    decimated_col_t * cols = lv_malloc(sizeof(decimated_col_t) * (d->last_col + 1));
+    LV_ASSERT_MALLOC(cols);
+    if(cols == NULL) return;
+    uint32_t col_cnt = 0;
+
+    uint32_t p = chart->update_mode == LV_CHART_UPDATE_MODE_SHIFT ? ser->start_point : 0;
+    uint32_t col = 0;
+    uint32_t col_left = d->col_size - d->phase;
+    int32_t v_first = 0;
+    int32_t v_last = 0;
+    int32_t v_min = 0;
+    int32_t v_max = 0;
+    bool has_value = false;
+    bool connected = false;
+
+    uint32_t i;
+    for(i = 0; i < chart->point_cnt; i++) {
+        int32_t v = ser->y_points[p];
+        if(v != LV_CHART_POINT_NONE) {
+            if(!has_value) {
+                v_first = v;
+                v_min = v;
+                v_max = v;
+                has_value = true;
+            }
+            else if(v < v_min) v_min = v;
+            else if(v > v_max) v_max = v;
+            v_last = v;
+        }
+
+        p++;
+        if(p == chart->point_cnt) p = 0;
+        col_left--;
+        if(col_left > 0 && i != chart->point_cnt - 1) continue;
+
+        /*A column is complete*/
+        int32_t x = content->x1 + w - (int32_t)(d->last_col - col) * w / (int32_t)(d->col_cnt - 1);
+        col++;
+        col_left = d->col_size;
+        if(x > x_max) break;
+        if(!has_value || x < x_min) {
+            connected = false;
+            has_value = false;
+            continue;
+        }
+
+        /*The larger value is higher. Include the last value of the previous column to connect them*/
+        decimated_col_t * c = &cols[col_cnt];
+        c->x = x;
+        c->top = get_decimated_y(obj, ser, v_max, content);
+        c->bottom = get_decimated_y(obj, ser, v_min, content);
+        c->first = get_decimated_y(obj, ser, v_first, content);
+        c->last = get_decimated_y(obj, ser, v_last, content);
+        c->connected = connected;
+        if(connected) {
+            c->top = LV_MIN(c->top, cols[col_cnt - 1].last);
+            c->bottom = LV_MAX(c->bottom, cols[col_cnt - 1].last);
+        }
+        col_cnt++;
+
+        connected = true;
+        has_value = false;
+    }
+
+#if LV_USE_VECTOR_GRAPHIC
+    if(col_cnt && draw_decimated_path(layer, line_dsc, cols, col_cnt, lv_area_get_height(content))) {
+        lv_free(cols);
+        return;
+    }
+#endif
+
+    for(i = 0; i < col_cnt; i++) {
+        const decimated_col_t * c = &cols[i];
+        line_dsc->base.id2 = i;
+
+        /*Draw the line from the previous column only if they are not adjacent*/
+        if(c->connected && c->x - cols[i - 1].x > 1) {
+            line_dsc->p1.x = cols[i - 1].x;
+            line_dsc->p1.y = cols[i - 1].last;
+            line_dsc->p2.x = c->x;
+            line_dsc->p2.y = c->first;
+            lv_draw_line(layer, line_dsc);
+        }
+
+        /*Draw one vertical line between the min and max y-values*/
+        line_dsc->p1.x = c->x;
+        line_dsc->p2.x = c->x;
+        line_dsc->p1.y = c->top;
+        line_dsc->p2.y = c->bottom;
+        if(line_dsc->p1.y == line_dsc->p2.y) line_dsc->p2.y++;    /*If they are the same no line will be drawn*/
+        lv_draw_line(layer, line_dsc);
+    }
+
+    lv_free(cols);
+}
+
+static void draw_series_line_cached(lv_obj_t * obj, lv_layer_t * layer)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+
+    lv_draw_image_dsc_t img_dsc;
+    lv_draw_image_dsc_init(&img_dsc);
+    img_dsc.base.layer = layer;
+
+    /*Keep the drawing order of `draw_series_line`*/
+    lv_chart_series_t * ser;
+    LV_LL_READ_BACK(&chart->series_ll, ser) {
+        if(ser->hidden) continue;
+
+        if(ser->cache_valid) {
+            img_dsc.src = ser->cache;
+            lv_draw_image(layer, &img_dsc, &obj->coords);
+        }
+        else {
+            draw_series_line(obj, layer, ser);
+        }
+    }
+}
+
 static void draw_series_scatter(lv_obj_t * obj, lv_layer_t * layer)
 {
 
@@ -1286,11 +1619,201 @@ static uint32_t get_index_from_x(lv_obj_t * obj, int32_t x)
     return 0;
 }
 
+static bool get_decimation(lv_obj_t * obj, const lv_chart_series_t * ser, int32_t w, decimation_t * d)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    if(chart->decimation != LV_CHART_DECIMATION_MINMAX || chart->type != LV_CHART_TYPE_LINE) return false;
+    if(w < 2 || (int32_t)chart->point_cnt < w) return false;
+
+    d->col_size = (chart->point_cnt + w - 1) / w;
+    d->col_cnt = (chart->point_cnt + d->col_size - 1) / d->col_size;
+    if(d->col_cnt < 2) return false;
+
+    /*In shift mode the columns are aligned to the added values so that they don't change
+     *until a column is filled, only the newest and oldest columns*/
+    d->phase = chart->update_mode == LV_CHART_UPDATE_MODE_SHIFT ? ser->shift_cnt % d->col_size : 0;
+    d->last_col = (d->phase + chart->point_cnt - 1) / d->col_size;
+    return true;
+}
+
+static bool invalidate_decimated_shift(lv_obj_t * obj, lv_chart_series_t * ser)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    if(lv_ll_get_head(&chart->cursor_ll)) return false;
+
+    int32_t w = lv_obj_get_content_width(obj);
+    decimation_t d;
+    if(!get_decimation(obj, ser, w, &d)) return false;
+
+    /*The new value has started a new column so all the columns are scrolled*/
+    if((d.phase + chart->point_cnt - 1) % d.col_size == 0) return false;
+
+    int32_t bwidth = lv_obj_get_style_border_width(obj, LV_PART_MAIN);
+    int32_t pleft = lv_obj_get_style_pad_left(obj, LV_PART_MAIN);
+    int32_t x_ofs = obj->coords.x1 + pleft + bwidth - lv_obj_get_scroll_left(obj);
+    int32_t line_width = lv_obj_get_style_line_width(obj, LV_PART_ITEMS);
+    int32_t col_w = (w + d.col_cnt - 2) / (d.col_cnt - 1);
+
+    lv_area_t coords;
+    lv_area_copy(&coords, &obj->coords);
+    coords.y1 -= line_width;
+    coords.y2 += line_width;
+
+    /*The newest column got a value and the oldest lost one*/
+    coords.x1 = x_ofs + w - 2 * col_w - line_width;
+    coords.x2 = x_ofs + w + line_width;
+    lv_obj_invalidate_area(obj, &coords);
+
+    coords.x1 = x_ofs - line_width;
+    coords.x2 = x_ofs + 2 * col_w + line_width;
+    lv_obj_invalidate_area(obj, &coords);
+
+    return true;
+}
+
+static int32_t get_streaming_step(lv_obj_t * obj, const lv_chart_series_t * ser, int32_t w, uint32_t * pos_cnt)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    if(!chart->streaming || chart->type != LV_CHART_TYPE_LINE) return 0;
+    if(chart->update_mode != LV_CHART_UPDATE_MODE_SHIFT) return 0;
+
+    /*The points or the decimated columns*/
+    decimation_t d;
+    if(get_decimation(obj, ser, w, &d)) *pos_cnt = d.col_cnt;
+    else *pos_cnt = chart->point_cnt;
+
+    if(*pos_cnt < 2 || (int32_t)*pos_cnt - 1 > w) return 0;
+    return w / (int32_t)(*pos_cnt - 1);
+}
+
+static bool scroll_series_cache(lv_obj_t * obj, lv_chart_series_t * ser)
+{
+    if(ser->hidden) return false;
+    if(lv_obj_get_scroll_left(obj) != 0 || lv_obj_get_scroll_top(obj) != 0) return false;
+
+    int32_t w = lv_obj_get_content_width(obj);
+    uint32_t pos_cnt;
+    int32_t step = get_streaming_step(obj, ser, w, &pos_cnt);
+    if(step == 0) return false;
+
+    int32_t obj_w = lv_obj_get_width(obj);
+    int32_t obj_h = lv_obj_get_height(obj);
+    lv_area_t full_area = {0, 0, obj_w - 1, obj_h - 1};
+    if(ser->cache && (ser->cache->header.w != obj_w || ser->cache->header.h != obj_h)) {
+        lv_image_cache_drop(ser->cache);
+        lv_draw_buf_destroy(ser->cache);
+        ser->cache = NULL;
+    }
+
+    if(ser->cache == NULL) {
+        ser->cache = lv_draw_buf_create(obj_w, obj_h, LV_COLOR_FORMAT_ARGB8888, LV_STRIDE_AUTO);
+        if(ser->cache == NULL) return false;
+        ser->cache_valid = 0;
+    }
+
+    if(!ser->cache_valid) {
+        render_series_cache(obj, ser, &full_area, 1);
+        ser->cache_valid = 1;
+        lv_obj_invalidate(obj);
+        return true;
+    }
+
+    /*A new point or decimated column moves everything to the left by one step*/
+    int32_t shift = step;
+    decimation_t d;
+    if(get_decimation(obj, ser, w, &d) && (d.phase + lv_chart_get_point_count(obj) - 1) % d.col_size != 0) shift = 0;
+
+    if(shift) {
+        uint32_t stride = ser->cache->header.stride;
+        uint8_t * row = ser->cache->data;
+        int32_t y;
+        for(y = 0; y < obj_h; y++) {
+            lv_memmove(row, row + shift * 4, (obj_w - shift) * 4);
+            row += stride;
+        }
+    }
+
+    /*Render again the left side where the oldest point was removed
+     *and the right side where the new point was added*/
+    int32_t bwidth = lv_obj_get_style_border_width(obj, LV_PART_MAIN);
+    int32_t pleft = lv_obj_get_style_pad_left(obj, LV_PART_MAIN);
+    int32_t ser_x = pleft + bwidth + w - step * (int32_t)(pos_cnt - 1);
+    int32_t margin = lv_obj_get_style_line_width(obj, LV_PART_ITEMS) + lv_obj_get_style_width(obj, LV_PART_INDICATOR);
+
+    lv_area_t areas[2];
+    areas[0] = full_area;
+    areas[0].x2 = LV_MIN(ser_x + 2 * step + margin, obj_w - 1);
+    areas[1] = full_area;
+    areas[1].x1 = LV_MAX(pleft + bwidth + w - 2 * step - shift - margin, 0);
+    render_series_cache(obj, ser, areas, 2);
+
+    /*The whole series moved if there was a shift*/
+    if(shift) {
+        lv_obj_invalidate(obj);
+    }
+    else {
+        lv_area_move(&areas[0], obj->coords.x1, obj->coords.y1);
+        lv_area_move(&areas[1], obj->coords.x1, obj->coords.y1);
+        lv_obj_invalidate_area(obj, &areas[0]);
+        lv_obj_invalidate_area(obj, &areas[1]);
+    }
+
+    return true;
+}
+
+static void render_series_cache(lv_obj_t * obj, lv_chart_series_t * ser, const lv_area_t areas[], uint32_t area_cnt)
+{
+    /*Render relative to the chart because vector graphics expect the layer to start at 0;0*/
+    lv_area_t coords_ori = obj->coords;
+    lv_area_move(&obj->coords, -coords_ori.x1, -coords_ori.y1);
+
+    lv_layer_t layer;
+    lv_layer_init(&layer);
+    layer.draw_buf = ser->cache;
+    layer.color_format = ser->cache->header.cf;
+    layer.buf_area = obj->coords;
+    layer.phy_clip_area = obj->coords;
+
+    uint32_t i;
+    for(i = 0; i < area_cnt; i++) {
+        lv_draw_buf_clear(ser->cache, &areas[i]);
+        layer._clip_area = areas[i];
+        draw_series_line(obj, &layer, ser);
+    }
+
+    while(layer.draw_task_head) {
+        lv_draw_dispatch_wait_for_request();
+        if(!lv_draw_dispatch_layer(lv_obj_get_display(obj), &layer)) {
+            lv_draw_wait_for_finish();
+            lv_draw_dispatch_request();
+        }
+    }
+
+    obj->coords = coords_ori;
+    lv_image_cache_drop(ser->cache);
+}
+
+static void drop_series_cache(lv_obj_t * obj, bool free_buf)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    lv_chart_series_t * ser;
+    LV_LL_READ(&chart->series_ll, ser) {
+        ser->cache_valid = 0;
+        if(free_buf && ser->cache) {
+            lv_image_cache_drop(ser->cache);
+            lv_draw_buf_destroy(ser->cache);
+            ser->cache = NULL;
+        }
+    }
+}
+
 static void invalidate_point(lv_obj_t * obj, uint32_t i)
 {
     lv_chart_t * chart  = (lv_chart_t *)obj;
     if(i >= chart->point_cnt) return;
 
+    drop_series_cache(obj, false);
+
     int32_t w  = lv_obj_get_content_width(obj);
     int32_t scroll_left = lv_obj_get_scroll_left(obj);
 
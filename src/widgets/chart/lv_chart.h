@@ -48,6 +48,14 @@ typedef enum {
     LV_CHART_UPDATE_MODE_CIRCULAR,  /**< Add the new data in a circular way*/
 } lv_chart_update_mode_t;
 
+/**
+ * Decimation of LINE charts having more points than pixels horizontally
+ */
+typedef enum {
+    LV_CHART_DECIMATION_NONE,       /**< Process the points one by one*/
+    LV_CHART_DECIMATION_MINMAX,     /**< Keep only the min. and max. values of the points in a pixel column*/
+} lv_chart_decimation_t;
+
 /**
  * Enumeration of the axis'
  */
@@ -101,6 +109,29 @@ void lv_chart_set_range(lv_obj_t * obj, lv_chart_axis_t axis, int32_t min, int32
  */
 void lv_chart_set_update_mode(lv_obj_t * obj, lv_chart_update_mode_t update_mode);
 
+/**
+ * Set the decimation of LINE charts. It's used only if there are at least as many points as pixels horizontally.
+ * With `LV_CHART_DECIMATION_MINMAX` the points are grouped into pixel columns and
+ * the series is drawn as one vector path (if `LV_USE_VECTOR_GRAPHIC` is enabled) or
+ * with vertical lines per column. In `LV_CHART_UPDATE_MODE_SHIFT` the columns scroll only when
+ * a column is filled, so `lv_chart_set_next_value` invalidates only the edges of the chart.
+ * @param obj           pointer to a chart object
+ * @param decimation    the decimation mode
+ */
+void lv_chart_set_decimation(lv_obj_t * obj, lv_chart_decimation_t decimation);
+
+/**
+ * Enable streaming for LINE charts in `LV_CHART_UPDATE_MODE_SHIFT`.
+ * Each series is rendered into an ARGB8888 buffer of the size of the chart. When a new value is added with
+ * `lv_chart_set_next_value` the buffer is scrolled and only the new value and the left edge are rendered.
+ * To scroll by whole pixels the points (or decimated columns) are placed a whole number of pixels apart and
+ * aligned to the right. Streaming is not used if there are more points than pixels without decimation,
+ * or the chart is scrolled.
+ * @param obj       pointer to a chart object
+ * @param en        true: enable streaming; false: disable and free the buffers
+ */
+void lv_chart_set_streaming(lv_obj_t * obj, bool en);
+
 /**
  * Set the number of horizontal and vertical division lines
  * @param obj       pointer to a chart object
@@ -123,6 +154,20 @@ lv_chart_type_t lv_chart_get_type(const lv_obj_t * obj);
  */
 uint32_t lv_chart_get_point_count(const lv_obj_t * obj);
 
+/**
+ * Get the decimation of a chart
+ * @param obj       pointer to chart object
+ * @return          the decimation mode
+ */
+lv_chart_decimation_t lv_chart_get_decimation(const lv_obj_t * obj);
+
+/**
+ * Get whether streaming is enabled
+ * @param obj       pointer to chart object
+ * @return          true: streaming is enabled
+ */
+bool lv_chart_get_streaming(const lv_obj_t * obj);
+
 /**
  * Get the current index of the x-axis start point in the data array
  * @param obj       pointer to a chart object
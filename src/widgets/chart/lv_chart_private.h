@@ -35,6 +35,9 @@ struct _lv_chart_series_t {
     int32_t * y_points;
     lv_color_t color;
     uint32_t start_point;
+    uint32_t shift_cnt;         /**< Number of values added by `lv_chart_set_next_value`. Aligns the decimated columns*/
+    lv_draw_buf_t * cache;      /**< The rendered series in streaming mode*/
+    uint32_t cache_valid : 1;
     uint32_t hidden : 1;
     uint32_t x_ext_buf_assigned : 1;
     uint32_t y_ext_buf_assigned : 1;
@@ -65,6 +68,8 @@ struct _lv_chart_t {
     uint32_t point_cnt;         /**< Number of points in all series */
     lv_chart_type_t type  : 3;  /**< Chart type */
     lv_chart_update_mode_t update_mode : 2;
+    lv_chart_decimation_t decimation : 1;
+    uint8_t streaming : 1;
 };
 
 
@@ -26,6 +26,9 @@
  *********************/
 #define MY_CLASS (&lv_table_class)
 
+/*Size of the memory blocks the cells are allocated from in virtualized mode*/
+#define ARENA_CHUNK_SIZE    4096
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -47,12 +50,34 @@ static size_t get_cell_txt_len(const char * txt);
 static void copy_cell_txt(lv_table_cell_t * dst, const char * txt);
 static void get_cell_area(lv_obj_t * obj, uint32_t row, uint32_t col, lv_area_t * area);
 static void scroll_to_selected_cell(lv_obj_t * obj);
+static int32_t get_row_y(lv_obj_t * obj, uint32_t row);
+static uint32_t get_row_at_y(lv_obj_t * obj, int32_t y);
+static void invalidate_row_y(lv_obj_t * obj, uint32_t row);
+static void measure_visible_rows(lv_obj_t * obj);
+static bool is_row_visible(lv_obj_t * obj, uint32_t row);
+static int32_t get_rows_y(lv_obj_t * obj);
+static lv_table_cell_t * alloc_cell(lv_obj_t * obj, uint32_t cell, size_t size);
+static void free_cell(lv_obj_t * obj, lv_table_cell_t * cell);
+static void * arena_alloc(lv_table_t * table, size_t size);
+static void arena_compact(lv_obj_t * obj);
+static void arena_free(lv_table_arena_chunk_t * chunk);
 
 static inline bool is_cell_empty(void * cell)
 {
     return cell == NULL;
 }
 
+static inline bool is_row_measured(const lv_table_t * table, uint32_t row)
+{
+    return table->row_measured[row >> 5] & (1UL << (row & 0x1F));
+}
+
+static inline void set_row_measured(lv_table_t * table, uint32_t row, bool measured)
+{
+    if(measured) table->row_measured[row >> 5] |= 1UL << (row & 0x1F);
+    else table->row_measured[row >> 5] &= ~(1UL << (row & 0x1F));
+}
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -112,9 +137,7 @@ void lv_table_set_cell_value(lv_obj_t * obj, uint32_t row, uint32_t col, const c
 
     size_t to_allocate = get_cell_txt_len(txt);
 
-    table->cell_data[cell] = lv_realloc(table->cell_data[cell], to_allocate);
-    LV_ASSERT_MALLOC(table->cell_data[cell]);
-    if(table->cell_data[cell] == NULL) return;
+    if(alloc_cell(obj, cell, to_allocate) == NULL) return;
 
     copy_cell_txt(table->cell_data[cell], txt);
 
@@ -170,9 +193,8 @@ void lv_table_set_cell_value_fmt(lv_obj_t * obj, uint32_t row, uint32_t col, con
 
     /*Get the size of the Arabic text and process it*/
     size_t len_ap = lv_text_ap_calc_bytes_count(raw_txt);
-    table->cell_data[cell] = lv_realloc(table->cell_data[cell], sizeof(lv_table_cell_t) + len_ap + 1);
-    LV_ASSERT_MALLOC(table->cell_data[cell]);
-    if(table->cell_data[cell] == NULL) {
+    if(alloc_cell(obj, cell, sizeof(lv_table_cell_t) + len_ap + 1) == NULL) {
+        lv_free(raw_txt);
         va_end(ap2);
         return;
     }
@@ -180,10 +202,7 @@ void lv_table_set_cell_value_fmt(lv_obj_t * obj, uint32_t row, uint32_t col, con
 
     lv_free(raw_txt);
 #else
-    table->cell_data[cell] = lv_realloc(table->cell_data[cell],
-                                        sizeof(lv_table_cell_t) + len + 1); /*+1: trailing '\0; */
-    LV_ASSERT_MALLOC(table->cell_data[cell]);
-    if(table->cell_data[cell] == NULL) {
+    if(alloc_cell(obj, cell, sizeof(lv_table_cell_t) + len + 1) == NULL) { /*+1: trailing '\0; */
         va_end(ap2);
         return;
     }
@@ -215,6 +234,17 @@ void lv_table_set_row_count(lv_obj_t * obj, uint32_t row_cnt)
     LV_ASSERT_MALLOC(table->row_h);
     if(table->row_h == NULL) return;
 
+    table->row_y = lv_realloc(table->row_y, (table->row_cnt + 1) * sizeof(table->row_y[0]));
+    LV_ASSERT_MALLOC(table->row_y);
+    if(table->row_y == NULL) return;
+    invalidate_row_y(obj, LV_MIN(old_row_cnt, row_cnt));
+
+    if(table->virtualized) {
+        table->row_measured = lv_realloc(table->row_measured, ((row_cnt + 31) / 32) * sizeof(table->row_measured[0]));
+        LV_ASSERT_MALLOC(table->row_measured);
+        if(table->row_measured == NULL) return;
+    }
+
     /*Free the unused cells*/
     if(old_row_cnt > row_cnt) {
         uint32_t old_cell_cnt = old_row_cnt * table->col_cnt;
@@ -225,7 +255,7 @@ void lv_table_set_row_count(lv_obj_t * obj, uint32_t row_cnt)
                 lv_free(table->cell_data[i]->user_data);
                 table->cell_data[i]->user_data = NULL;
             }
-            lv_free(table->cell_data[i]);
+            free_cell(obj, table->cell_data[i]);
         }
     }
 
@@ -240,7 +270,25 @@ void lv_table_set_row_count(lv_obj_t * obj, uint32_t row_cnt)
         lv_memzero(&table->cell_data[old_cell_cnt], (new_cell_cnt - old_cell_cnt) * sizeof(table->cell_data[0]));
     }
 
-    refr_size_form_row(obj, 0);
+    /*In virtualized mode the existing rows are not affected*/
+    if(!table->virtualized) {
+        refr_size_form_row(obj, 0);
+    }
+    else if(old_row_cnt < row_cnt) {
+        /*Assume one line of text in the new rows until they are measured*/
+        const lv_font_t * font = lv_obj_get_style_text_font(obj, LV_PART_ITEMS);
+        int32_t h = lv_font_get_line_height(font) + lv_obj_get_style_pad_top(obj, LV_PART_ITEMS) +
+                    lv_obj_get_style_pad_bottom(obj, LV_PART_ITEMS);
+        h = LV_CLAMP(lv_obj_get_style_min_height(obj, LV_PART_ITEMS), h, lv_obj_get_style_max_height(obj, LV_PART_ITEMS));
+
+        uint32_t i;
+        for(i = old_row_cnt; i < row_cnt; i++) table->row_h[i] = h;
+        refr_size_form_row(obj, old_row_cnt);
+    }
+    else {
+        lv_obj_refresh_self_size(obj);
+        lv_obj_invalidate(obj);
+    }
 }
 
 void lv_table_set_column_count(lv_obj_t * obj, uint32_t col_cnt)
@@ -281,7 +329,7 @@ void lv_table_set_column_count(lv_obj_t * obj, uint32_t col_cnt)
                 lv_free(table->cell_data[idx]->user_data);
                 table->cell_data[idx]->user_data = NULL;
             }
-            lv_free(table->cell_data[idx]);
+            free_cell(obj, table->cell_data[idx]);
             table->cell_data[idx] = NULL;
         }
     }
@@ -328,9 +376,7 @@ void lv_table_add_cell_ctrl(lv_obj_t * obj, uint32_t row, uint32_t col, lv_table
     uint32_t cell = row * table->col_cnt + col;
 
     if(is_cell_empty(table->cell_data[cell])) {
-        table->cell_data[cell]    = lv_malloc(sizeof(lv_table_cell_t) + 1); /*+1: trailing '\0 */
-        LV_ASSERT_MALLOC(table->cell_data[cell]);
-        if(table->cell_data[cell] == NULL) return;
+        if(alloc_cell(obj, cell, sizeof(lv_table_cell_t) + 1) == NULL) return; /*+1: trailing '\0 */
 
         table->cell_data[cell]->ctrl = 0;
         table->cell_data[cell]->user_data = NULL;
@@ -353,9 +399,7 @@ void lv_table_clear_cell_ctrl(lv_obj_t * obj, uint32_t row, uint32_t col, lv_tab
     uint32_t cell = row * table->col_cnt + col;
 
     if(is_cell_empty(table->cell_data[cell])) {
-        table->cell_data[cell]    = lv_malloc(sizeof(lv_table_cell_t) + 1); /*+1: trailing '\0 */
-        LV_ASSERT_MALLOC(table->cell_data[cell]);
-        if(table->cell_data[cell] == NULL) return;
+        if(alloc_cell(obj, cell, sizeof(lv_table_cell_t) + 1) == NULL) return; /*+1: trailing '\0 */
 
         table->cell_data[cell]->ctrl = 0;
         table->cell_data[cell]->user_data = NULL;
@@ -378,9 +422,7 @@ void lv_table_set_cell_user_data(lv_obj_t * obj, uint16_t row, uint16_t col, voi
     uint32_t cell = row * table->col_cnt + col;
 
     if(is_cell_empty(table->cell_data[cell])) {
-        table->cell_data[cell]    = lv_malloc(sizeof(lv_table_cell_t) + 1); /*+1: trailing '\0 */
-        LV_ASSERT_MALLOC(table->cell_data[cell]);
-        if(table->cell_data[cell] == NULL) return;
+        if(alloc_cell(obj, cell, sizeof(lv_table_cell_t) + 1) == NULL) return; /*+1: trailing '\0 */
 
         table->cell_data[cell]->ctrl = 0;
         table->cell_data[cell]->user_data = NULL;
@@ -414,6 +456,51 @@ void lv_table_set_selected_cell(lv_obj_t * obj, uint16_t row, uint16_t col)
     }
 }
 
+void lv_table_set_virtualized(lv_obj_t * obj, bool en)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_table_t * table = (lv_table_t *)obj;
+    if(table->virtualized == en) return;
+
+    if(en) {
+        table->row_measured = lv_malloc(((table->row_cnt + 31) / 32) * sizeof(table->row_measured[0]));
+        LV_ASSERT_MALLOC(table->row_measured);
+        if(table->row_measured == NULL) return;
+
+        /*All rows are measured in normal mode*/
+        lv_memset(table->row_measured, 0xff, ((table->row_cnt + 31) / 32) * sizeof(table->row_measured[0]));
+    }
+
+    /*Move the cells to the arena or back to the heap*/
+    uint32_t i;
+    for(i = 0; i < table->row_cnt * table->col_cnt; i++) {
+        lv_table_cell_t * cell = table->cell_data[i];
+        if(cell == NULL) continue;
+
+        size_t size = sizeof(lv_table_cell_t) + lv_strlen(cell->txt) + 1;
+        lv_table_cell_t * new_cell = en ? arena_alloc(table, size) : lv_malloc(size);
+        LV_ASSERT_MALLOC(new_cell);
+        if(new_cell == NULL) continue;
+
+        lv_memcpy(new_cell, cell, size);
+        table->cell_data[i] = new_cell;
+        if(en) lv_free(cell);
+    }
+
+    table->virtualized = en;
+
+    if(!en) {
+        arena_free(table->arena);
+        table->arena = NULL;
+        table->arena_used = 0;
+        table->arena_waste = 0;
+        lv_free(table->row_measured);
+        table->row_measured = NULL;
+        refr_size_form_row(obj, 0);
+    }
+}
+
 /*=====================
  * Getter functions
  *====================*/
@@ -502,6 +589,14 @@ void * lv_table_get_cell_user_data(lv_obj_t * obj, uint16_t row, uint16_t col)
     return table->cell_data[cell]->user_data;
 }
 
+bool lv_table_get_virtualized(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_table_t * table = (lv_table_t *)obj;
+    return table->virtualized;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -517,8 +612,11 @@ static void lv_table_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     table->row_cnt = 1;
     table->col_w = lv_malloc(table->col_cnt * sizeof(table->col_w[0]));
     table->row_h = lv_malloc(table->row_cnt * sizeof(table->row_h[0]));
+    table->row_y = lv_malloc((table->row_cnt + 1) * sizeof(table->row_y[0]));
     table->col_w[0] = LV_DPI_DEF;
     table->row_h[0] = LV_DPI_DEF;
+    table->row_y[0] = 0;
+    table->row_y_valid_cnt = 1;
     table->cell_data = lv_realloc(table->cell_data, table->row_cnt * table->col_cnt * sizeof(lv_table_cell_t *));
     table->cell_data[0] = NULL;
     table->row_act = LV_TABLE_CELL_NONE;
@@ -539,13 +637,16 @@ static void lv_table_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
                 lv_free(table->cell_data[i]->user_data);
                 table->cell_data[i]->user_data = NULL;
             }
-            lv_free(table->cell_data[i]);
+            if(!table->virtualized) lv_free(table->cell_data[i]);
             table->cell_data[i] = NULL;
         }
     }
 
+    arena_free(table->arena);
     if(table->cell_data) lv_free(table->cell_data);
     if(table->row_h) lv_free(table->row_h);
+    if(table->row_y) lv_free(table->row_y);
+    if(table->row_measured) lv_free(table->row_measured);
     if(table->col_w) lv_free(table->col_w);
 }
 
@@ -566,14 +667,16 @@ static void lv_table_event(const lv_obj_class_t * class_p, lv_event_t * e)
     if(code == LV_EVENT_STYLE_CHANGED) {
         refr_size_form_row(obj, 0);
     }
+    else if(code == LV_EVENT_SCROLL || code == LV_EVENT_SIZE_CHANGED) {
+        measure_visible_rows(obj);
+    }
     else if(code == LV_EVENT_GET_SELF_SIZE) {
         lv_point_t * p = lv_event_get_param(e);
         uint32_t i;
         int32_t w = 0;
         for(i = 0; i < table->col_cnt; i++) w += table->col_w[i];
 
-        int32_t h = 0;
-        for(i = 0; i < table->row_cnt; i++) h += table->row_h[i];
+        int32_t h = get_row_y(obj, table->row_cnt);
 
         p->x = w - 1;
         p->y = h - 1;
@@ -709,16 +812,20 @@ static void draw_main(lv_event_t * e)
 
     uint32_t col;
     uint32_t row;
-    uint32_t cell = 0;
 
-    cell_area.y2 = obj->coords.y1 + bg_top - 1 - lv_obj_get_scroll_y(obj) + border_width;
+    /*Start from the first visible row*/
+    int32_t rows_y = obj->coords.y1 + bg_top - lv_obj_get_scroll_y(obj) + border_width;
+    uint32_t row_start = get_row_at_y(obj, clip_area.y1 - rows_y);
+    uint32_t cell = row_start * table->col_cnt;
+
+    cell_area.y2 = rows_y + get_row_y(obj, row_start) - 1;
     cell_area.x1 = 0;
     cell_area.x2 = 0;
     int32_t scroll_x = lv_obj_get_scroll_x(obj) ;
     bool rtl = lv_obj_get_style_base_dir(obj, LV_PART_MAIN) == LV_BASE_DIR_RTL;
 
     /*Handle custom drawer*/
-    for(row = 0; row < table->row_cnt; row++) {
+    for(row = row_start; row < table->row_cnt; row++) {
         int32_t h_row = table->row_h[row];
 
         cell_area.y1 = cell_area.y2 + 1;
@@ -883,10 +990,20 @@ static void refr_size_form_row(lv_obj_t * obj, uint32_t start_row)
 
     lv_table_t * table = (lv_table_t *)obj;
     uint32_t i;
-    for(i = start_row; i < table->row_cnt; i++) {
-        int32_t calculated_height = get_row_height(obj, i, font, letter_space, line_space,
-                                                   cell_pad_left, cell_pad_right, cell_pad_top, cell_pad_bottom);
-        table->row_h[i] = LV_CLAMP(minh, calculated_height, maxh);
+    if(table->virtualized) {
+        /*Measure only the visible rows. The others keep their current height until they get visible.*/
+        for(i = start_row; i < table->row_cnt; i++) {
+            set_row_measured(table, i, false);
+        }
+        measure_visible_rows(obj);
+    }
+    else {
+        for(i = start_row; i < table->row_cnt; i++) {
+            int32_t calculated_height = get_row_height(obj, i, font, letter_space, line_space,
+                                                       cell_pad_left, cell_pad_right, cell_pad_top, cell_pad_bottom);
+            table->row_h[i] = LV_CLAMP(minh, calculated_height, maxh);
+        }
+        invalidate_row_y(obj, start_row);
     }
 
     lv_obj_refresh_self_size(obj);
@@ -895,6 +1012,14 @@ static void refr_size_form_row(lv_obj_t * obj, uint32_t start_row)
 
 static void refr_cell_size(lv_obj_t * obj, uint32_t row, uint32_t col)
 {
+    lv_table_t * table = (lv_table_t *)obj;
+
+    /*In virtualized mode measure the row only when it gets visible*/
+    if(table->virtualized && !is_row_visible(obj, row)) {
+        set_row_measured(table, row, false);
+        return;
+    }
+
     const int32_t cell_pad_left = lv_obj_get_style_pad_left(obj, LV_PART_ITEMS);
     const int32_t cell_pad_right = lv_obj_get_style_pad_right(obj, LV_PART_ITEMS);
     const int32_t cell_pad_top = lv_obj_get_style_pad_top(obj, LV_PART_ITEMS);
@@ -907,12 +1032,12 @@ static void refr_cell_size(lv_obj_t * obj, uint32_t row, uint32_t col)
     const int32_t minh = lv_obj_get_style_min_height(obj, LV_PART_ITEMS);
     const int32_t maxh = lv_obj_get_style_max_height(obj, LV_PART_ITEMS);
 
-    lv_table_t * table = (lv_table_t *)obj;
     int32_t calculated_height = get_row_height(obj, row, font, letter_space, line_space,
                                                cell_pad_left, cell_pad_right, cell_pad_top, cell_pad_bottom);
 
     int32_t prev_row_size = table->row_h[row];
     table->row_h[row] = LV_CLAMP(minh, calculated_height, maxh);
+    if(table->virtualized) set_row_measured(table, row, true);
 
     /*If the row height haven't changed invalidate only this cell*/
     if(prev_row_size == table->row_h[row]) {
@@ -922,6 +1047,7 @@ static void refr_cell_size(lv_obj_t * obj, uint32_t row, uint32_t col)
         lv_obj_invalidate_area(obj, &cell_area);
     }
     else {
+        invalidate_row_y(obj, row);
         lv_obj_refresh_self_size(obj);
         lv_obj_invalidate(obj);
     }
@@ -1037,15 +1163,12 @@ static lv_result_t get_pressed_cell(lv_obj_t * obj, uint32_t * row, uint32_t * c
         y -= obj->coords.y1;
         y -= lv_obj_get_style_pad_top(obj, LV_PART_MAIN);
 
-        *row = 0;
-        tmp = 0;
-
-        for(*row = 0; *row < table->row_cnt; (*row)++) {
-            tmp += table->row_h[*row];
-            if(y < tmp) {
-                is_click_on_valid_row = true;
-                break;
-            }
+        if(y < get_row_y(obj, table->row_cnt)) {
+            *row = get_row_at_y(obj, y);
+            is_click_on_valid_row = true;
+        }
+        else {
+            *row = table->row_cnt;
         }
     }
 
@@ -1105,12 +1228,7 @@ static void get_cell_area(lv_obj_t * obj, uint32_t row, uint32_t col, lv_area_t
         area->x2 = area->x1 + table->col_w[col] - 1;
     }
 
-    uint32_t r;
-    area->y1 = 0;
-    for(r = 0; r < row; r++) {
-        area->y1 += table->row_h[r];
-    }
-
+    area->y1 = get_row_y(obj, row);
     area->y1 += lv_obj_get_style_pad_top(obj, 0);
     area->y1 -= lv_obj_get_scroll_y(obj);
     area->y2 = area->y1 + table->row_h[row] - 1;
@@ -1138,4 +1256,221 @@ static void scroll_to_selected_cell(lv_obj_t * obj)
     }
 
 }
+
+/* Get the top of a row relative to the first row. Updates the cached prefix sum of the row heights if needed. */
+static int32_t get_row_y(lv_obj_t * obj, uint32_t row)
+{
+    lv_table_t * table = (lv_table_t *)obj;
+
+    uint32_t i;
+    for(i = table->row_y_valid_cnt; i <= row; i++) {
+        table->row_y[i] = table->row_y[i - 1] + table->row_h[i - 1];
+    }
+    if(table->row_y_valid_cnt <= row) table->row_y_valid_cnt = row + 1;
+
+    return table->row_y[row];
+}
+
+/* Get the row at a y coordinate relative to the first row */
+static uint32_t get_row_at_y(lv_obj_t * obj, int32_t y)
+{
+    lv_table_t * table = (lv_table_t *)obj;
+    if(table->row_cnt == 0) return 0;
+
+    get_row_y(obj, table->row_cnt);
+
+    uint32_t min = 0;
+    uint32_t max = table->row_cnt - 1;
+    while(min < max) {
+        uint32_t mid = (min + max + 1) / 2;
+        if(table->row_y[mid] <= y) min = mid;
+        else max = mid - 1;
+    }
+
+    return min;
+}
+
+/* Mark the position of the rows after `row` as outdated */
+static void invalidate_row_y(lv_obj_t * obj, uint32_t row)
+{
+    lv_table_t * table = (lv_table_t *)obj;
+    table->row_y_valid_cnt = LV_MIN(table->row_y_valid_cnt, row + 1);
+}
+
+/* Get the absolute y coordinate of the top of the first row */
+static int32_t get_rows_y(lv_obj_t * obj)
+{
+    return obj->coords.y1 + lv_obj_get_style_pad_top(obj, LV_PART_MAIN) +
+           lv_obj_get_style_border_width(obj, LV_PART_MAIN) - lv_obj_get_scroll_y(obj);
+}
+
+/* In virtualized mode measure the rows which are in the visible part of the table but were not measured yet */
+static void measure_visible_rows(lv_obj_t * obj)
+{
+    lv_table_t * table = (lv_table_t *)obj;
+    if(!table->virtualized || table->row_cnt == 0) return;
+
+    const int32_t cell_pad_left = lv_obj_get_style_pad_left(obj, LV_PART_ITEMS);
+    const int32_t cell_pad_right = lv_obj_get_style_pad_right(obj, LV_PART_ITEMS);
+    const int32_t cell_pad_top = lv_obj_get_style_pad_top(obj, LV_PART_ITEMS);
+    const int32_t cell_pad_bottom = lv_obj_get_style_pad_bottom(obj, LV_PART_ITEMS);
+
+    int32_t letter_space = lv_obj_get_style_text_letter_space(obj, LV_PART_ITEMS);
+    int32_t line_space = lv_obj_get_style_text_line_space(obj, LV_PART_ITEMS);
+    const lv_font_t * font = lv_obj_get_style_text_font(obj, LV_PART_ITEMS);
+
+    const int32_t minh = lv_obj_get_style_min_height(obj, LV_PART_ITEMS);
+    const int32_t maxh = lv_obj_get_style_max_height(obj, LV_PART_ITEMS);
+
+    int32_t rows_y = get_rows_y(obj);
+    uint32_t row = get_row_at_y(obj, obj->coords.y1 - rows_y);
+    int32_t y = rows_y + get_row_y(obj, row);
+    bool changed = false;
+
+    /*Rows below a measured row can move, so go on until the bottom is reached*/
+    for(; row < table->row_cnt && y <= obj->coords.y2; row++) {
+        if(!is_row_measured(table, row)) {
+            int32_t calculated_height = get_row_height(obj, row, font, letter_space, line_space,
+                                                       cell_pad_left, cell_pad_right, cell_pad_top, cell_pad_bottom);
+            calculated_height = LV_CLAMP(minh, calculated_height, maxh);
+            set_row_measured(table, row, true);
+            if(calculated_height != table->row_h[row]) {
+                table->row_h[row] = calculated_height;
+                invalidate_row_y(obj, row);
+                changed = true;
+            }
+        }
+        y += table->row_h[row];
+    }
+
+    if(changed) {
+        lv_obj_refresh_self_size(obj);
+        lv_obj_invalidate(obj);
+    }
+}
+
+/* Tell if a row is in the visible part of the table (not considering the parents) */
+static bool is_row_visible(lv_obj_t * obj, uint32_t row)
+{
+    lv_table_t * table = (lv_table_t *)obj;
+    int32_t y = get_rows_y(obj) + get_row_y(obj, row);
+
+    return y <= obj->coords.y2 && y + table->row_h[row] > obj->coords.y1;
+}
+
+/* Allocate a cell for `cell_data[cell]`, keeping the control bits and user data of the current cell */
+static lv_table_cell_t * alloc_cell(lv_obj_t * obj, uint32_t cell, size_t size)
+{
+    lv_table_t * table = (lv_table_t *)obj;
+
+    if(!table->virtualized) {
+        lv_table_cell_t * new_cell = lv_realloc(table->cell_data[cell], size);
+        LV_ASSERT_MALLOC(new_cell);
+        if(new_cell) table->cell_data[cell] = new_cell;
+        return new_cell;
+    }
+
+    /*Copy the cells to a new arena if most of it is occupied by replaced cells*/
+    if(table->arena_waste > ARENA_CHUNK_SIZE && table->arena_waste > table->arena_used / 2) {
+        arena_compact(obj);
+    }
+
+    lv_table_cell_t * old_cell = table->cell_data[cell];
+    if(old_cell) {
+        /*Reuse the cell if the new text fits*/
+        size_t old_size = sizeof(lv_table_cell_t) + lv_strlen(old_cell->txt) + 1;
+        if(size <= old_size) return old_cell;
+    }
+
+    lv_table_cell_t * new_cell = arena_alloc(table, size);
+    LV_ASSERT_MALLOC(new_cell);
+    if(new_cell == NULL) return NULL;
+
+    if(old_cell) {
+        lv_memcpy(new_cell, old_cell, sizeof(lv_table_cell_t));
+        free_cell(obj, old_cell);
+    }
+
+    table->cell_data[cell] = new_cell;
+    return new_cell;
+}
+
+static void free_cell(lv_obj_t * obj, lv_table_cell_t * cell)
+{
+    lv_table_t * table = (lv_table_t *)obj;
+    if(cell == NULL) return;
+
+    if(table->virtualized) table->arena_waste += sizeof(lv_table_cell_t) + lv_strlen(cell->txt) + 1;
+    else lv_free(cell);
+}
+
+static void * arena_alloc(lv_table_t * table, size_t size)
+{
+    size = LV_ALIGN_UP(size, sizeof(void *));
+
+    lv_table_arena_chunk_t * chunk = table->arena;
+    if(chunk == NULL || chunk->used + size > chunk->size) {
+        uint32_t chunk_size = LV_MAX(ARENA_CHUNK_SIZE, size);
+        chunk = lv_malloc(sizeof(lv_table_arena_chunk_t) + chunk_size);
+        if(chunk == NULL) return NULL;
+
+        chunk->size = chunk_size;
+        chunk->used = 0;
+        chunk->next = table->arena;
+        table->arena = chunk;
+    }
+
+    void * p = (uint8_t *)(chunk + 1) + chunk->used;
+    chunk->used += size;
+    table->arena_used += size;
+    return p;
+}
+
+static void arena_compact(lv_obj_t * obj)
+{
+    lv_table_t * table = (lv_table_t *)obj;
+
+    /*Allocate one chunk for all the cells, so the cells can't be lost half way*/
+    uint32_t cell_cnt = table->row_cnt * table->col_cnt;
+    size_t total_size = 0;
+    uint32_t i;
+    for(i = 0; i < cell_cnt; i++) {
+        if(table->cell_data[i]) {
+            total_size += LV_ALIGN_UP(sizeof(lv_table_cell_t) + lv_strlen(table->cell_data[i]->txt) + 1, sizeof(void *));
+        }
+    }
+
+    lv_table_arena_chunk_t * old_arena = table->arena;
+    table->arena = NULL;
+    table->arena_used = 0;
+    if(arena_alloc(table, total_size) == NULL) {
+        table->arena = old_arena;
+        table->arena_used = total_size + table->arena_waste;
+        return;
+    }
+
+    /*Allocate the cells from the beginning of the new chunk*/
+    table->arena->used = 0;
+    table->arena_used = 0;
+    for(i = 0; i < cell_cnt; i++) {
+        lv_table_cell_t * cell = table->cell_data[i];
+        if(cell == NULL) continue;
+
+        size_t size = sizeof(lv_table_cell_t) + lv_strlen(cell->txt) + 1;
+        table->cell_data[i] = arena_alloc(table, size);
+        lv_memcpy(table->cell_data[i], cell, size);
+    }
+
+    table->arena_waste = 0;
+    arena_free(old_arena);
+}
+
+static void arena_free(lv_table_arena_chunk_t * chunk)
+{
+    while(chunk) {
+        lv_table_arena_chunk_t * next = chunk->next;
+        lv_free(chunk);
+        chunk = next;
+    }
+}
 #endif
@@ -141,6 +141,16 @@ void lv_table_set_cell_user_data(lv_obj_t * obj, uint16_t row, uint16_t col, voi
  */
 void lv_table_set_selected_cell(lv_obj_t * obj, uint16_t row, uint16_t col);
 
+/**
+ * Enable the virtualized mode for tables with many rows.
+ * In this mode only the rows on the screen are measured, the other rows use the height of one line
+ * until they are scrolled in. The cell texts are allocated from larger blocks instead of one by one.
+ * It works best if the table has a fixed height and it's scrolled itself.
+ * @param obj       pointer to a table object
+ * @param en        true: enable the virtualized mode
+ */
+void lv_table_set_virtualized(lv_obj_t * obj, bool en);
+
 /*=====================
  * Getter functions
  *====================*/
@@ -202,6 +212,13 @@ void lv_table_get_selected_cell(lv_obj_t * obj, uint32_t * row, uint32_t * col);
  */
 void * lv_table_get_cell_user_data(lv_obj_t * obj, uint16_t row, uint16_t col);
 
+/**
+ * Get whether the virtualized mode is enabled
+ * @param obj       pointer to a table object
+ * @return          true: the virtualized mode is enabled
+ */
+bool lv_table_get_virtualized(lv_obj_t * obj);
+
 /**********************
  *      MACROS
  **********************/
@@ -34,6 +34,13 @@ struct _lv_table_cell_t {
     char txt[1];      /**< Variable length array */
 };
 
+/** A block of memory the cells are allocated from in virtualized mode */
+typedef struct _lv_table_arena_chunk_t {
+    struct _lv_table_arena_chunk_t * next;
+    uint32_t size;                  /**< Size of the data after the header*/
+    uint32_t used;
+} lv_table_arena_chunk_t;
+
 /** Table data */
 struct _lv_table_t {
     lv_obj_t obj;
@@ -41,9 +48,16 @@ struct _lv_table_t {
     uint32_t row_cnt;
     lv_table_cell_t ** cell_data;
     int32_t * row_h;
+    int32_t * row_y;                /**< Top of each row, `row_cnt + 1` elements (the last is the total height)*/
+    uint32_t row_y_valid_cnt;       /**< The first `row_y_valid_cnt` elements of `row_y` are up to date*/
+    uint32_t * row_measured;        /**< A bit for each row in virtualized mode: the row height is measured*/
+    lv_table_arena_chunk_t * arena; /**< The cells are allocated here in virtualized mode*/
+    uint32_t arena_used;            /**< Number of allocated bytes in `arena`*/
+    uint32_t arena_waste;           /**< Number of bytes of the replaced cells in `arena`*/
     int32_t * col_w;
     uint32_t col_act;
     uint32_t row_act;
+    uint32_t virtualized : 1;
 };
 
 
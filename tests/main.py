@@ -211,6 +211,19 @@ def generate_test_images():
                     img.to_c_array(output, compress=compress)
                     print(f"converting {os.path.basename(png)}, format: {fmt.name}, compress: {compress_name}")
 
+    tiled_formats = [(ColorFormat.ARGB8888, CompressMethod.LZ4),
+                     (ColorFormat.RGB565A8, CompressMethod.RLE),
+                     (ColorFormat.RGB565, CompressMethod.NONE)]
+    outputs = os.path.join(lvgl_test_dir, "test_images/tiled/")
+    os.makedirs(outputs, exist_ok=True)
+    for fmt, compress in tiled_formats:
+        for png in pngs:
+            img = LVGLImage().from_png(png, cf=fmt, background=0xffffff)
+            img.adjust_stride(align=16)
+            output = os.path.join(outputs, f"{Path(png).stem}_{fmt.name}_{compress.name}_tiled.c")
+            img.to_c_array(output, compress=compress, tile=(16, 16), align=16)
+            print(f"converting {os.path.basename(png)}, format: {fmt.name}, compress: {compress.name}, tiled")
+
 
 if __name__ == "__main__":
     epilog = '''This program builds and optionally runs the LVGL test programs.
@@ -30,7 +30,19 @@ extern "C" {
 #define LV_USE_STDLIB_STRING    LV_STDLIB_BUILTIN
 #define LV_USE_STDLIB_SPRINTF   LV_STDLIB_BUILTIN
 #define LV_OBJ_STYLE_CACHE      1
+#define LV_STYLE_SORTED_PROPS   1
+#define LV_OBJ_STYLE_VALUE_CACHE_CNT 32
+#define LV_FONT_FMT_TXT_CACHE_CNT 32
 #define LV_BIN_DECODER_RAM_LOAD 0
+#define LV_USE_MEM_SLAB         1
+#define LV_USE_TIMER_HEAP       1
+#define LV_OBJ_HIT_INDEX_MIN_CHILD_CNT 16
+#define LV_LAYOUT_CACHE_MIN_CHILD_CNT 1    /* Every layout test runs with the cache */
+#define LV_OBJ_LAYER_CACHE_SIZE (512 * 1024)
+#define LV_DRAW_TASK_ARENA_SIZE (8 * 1024)
+#if defined(__SSE2__)
+#define LV_USE_DRAW_SW_ASM      LV_DRAW_SW_ASM_SSE2   /* The screenshots are the same as with the C blending */
+#endif
 #endif
 
 #ifdef MICROPYTHON
@@ -126,6 +126,7 @@
 #define LV_USE_OBJ_ID_BUILTIN   1
 
 #define LV_CACHE_DEF_SIZE       (10 * 1024 * 1024)
+#define LV_USE_IMAGE_DECODER_ASYNC  1
 
 #ifndef LV_USE_LINUX_DRM
     #define LV_USE_LINUX_DRM    1
@@ -133,6 +134,7 @@
 
 #ifndef LV_USE_LINUX_FBDEV
     #define LV_USE_LINUX_FBDEV  1
+    #define LV_LINUX_FBDEV_PAGE_FLIP    1
 #endif
 
 #ifndef LV_USE_WAYLAND
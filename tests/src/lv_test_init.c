@@ -29,6 +29,11 @@ void lv_test_init(void)
     lv_profiler_builtin_set_enable(false);
 #endif
 
+#if LV_USE_IMAGE_DECODER_ASYNC
+    /* Draw the images synchronously to have them on the screenshots */
+    lv_image_decoder_async_set_enabled(false);
+#endif
+
     hal_init();
 #if LV_USE_SYSMON
 #if LV_USE_MEM_MONITOR
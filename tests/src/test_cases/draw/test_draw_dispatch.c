@@ -0,0 +1,213 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+#include <time.h>
+
+#define LAYER_W     1280
+#define LAYER_H     800
+
+static lv_layer_t layer;
+
+static int32_t dummy_dispatch(lv_draw_unit_t * draw_unit, lv_layer_t * l)
+{
+    LV_UNUSED(draw_unit);
+    LV_UNUSED(l);
+    return LV_DRAW_UNIT_IDLE;
+}
+
+void setUp(void)
+{
+    /* The dependency checks are used only if there are multiple draw units */
+    static bool unit_added = false;
+    if(!unit_added) {
+        lv_draw_unit_t * u = lv_draw_create_unit(sizeof(lv_draw_unit_t));
+        u->dispatch_cb = dummy_dispatch;
+        u->name = "DUMMY";
+        unit_added = true;
+    }
+
+    lv_area_t a = {0, 0, LAYER_W - 1, LAYER_H - 1};
+    lv_layer_init(&layer);
+    layer.buf_area = a;
+    layer._clip_area = a;
+    layer.phy_clip_area = a;
+}
+
+void tearDown(void)
+{
+    /*Let LVGL free the tasks as they might be allocated from the task arena*/
+    lv_draw_task_t * t = layer.draw_task_head;
+    while(t) {
+        t->state = LV_DRAW_TASK_STATE_READY;
+        t = t->next;
+    }
+    lv_draw_dispatch_layer(NULL, &layer);
+    TEST_ASSERT_NULL(layer.draw_task_head);
+}
+
+static void add_random_tasks(uint32_t cnt, int32_t max_size)
+{
+    lv_rand_set_seed(0x1234);
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        lv_area_t a;
+        a.x1 = lv_rand(0, LAYER_W - 1);
+        a.y1 = lv_rand(0, LAYER_H - 1);
+        a.x2 = LV_MIN(a.x1 + lv_rand(1, max_size), LAYER_W - 1);
+        a.y2 = LV_MIN(a.y1 + lv_rand(1, max_size), LAYER_H - 1);
+        lv_draw_task_t * t = lv_draw_add_task(&layer, &a);
+        t->preferred_draw_unit_id = LV_DRAW_UNIT_NONE;
+    }
+}
+
+/*Reference: an independent task can't overlap any older unfinished tasks*/
+static bool is_independent_ref(lv_draw_task_t * t_check)
+{
+    lv_draw_task_t * t = layer.draw_task_head;
+    while(t != t_check) {
+        lv_area_t a;
+        if(t->state != LV_DRAW_TASK_STATE_READY && lv_area_intersect(&a, &t->_real_area, &t_check->_real_area)) {
+            return false;
+        }
+        t = t->next;
+    }
+    return true;
+}
+
+static lv_draw_task_t * find_first_independent_ref(void)
+{
+    lv_draw_task_t * t = layer.draw_task_head;
+    while(t) {
+        if(t->state == LV_DRAW_TASK_STATE_QUEUED && is_independent_ref(t)) return t;
+        t = t->next;
+    }
+    return NULL;
+}
+
+/*Simulate the draw units: take all the available tasks, then finish the oldest ones*/
+static uint32_t run_dispatch(uint32_t * call_cnt, bool verify)
+{
+    uint32_t finished = 0;
+    *call_cnt = 0;
+    while(1) {
+        lv_draw_task_t * t;
+        while(1) {
+            t = lv_draw_get_next_available_task(&layer, NULL, 0);
+            (*call_cnt)++;
+            if(t == NULL) break;
+            if(verify) TEST_ASSERT_TRUE(is_independent_ref(t));
+            t->state = LV_DRAW_TASK_STATE_IN_PROGRESS;
+        }
+
+        /*Finish the first in progress task to let the others start*/
+        t = layer.draw_task_head;
+        while(t && t->state != LV_DRAW_TASK_STATE_IN_PROGRESS) t = t->next;
+        if(t == NULL) break;
+        t->state = LV_DRAW_TASK_STATE_READY;
+        finished++;
+    }
+
+    return finished;
+}
+
+void test_draw_dispatch_independent_tasks(void)
+{
+    lv_area_t a1 = {10, 10, 99, 99};
+    lv_area_t a2 = {200, 10, 299, 99};
+    lv_area_t a3 = {50, 50, 249, 149};
+    lv_area_t a4 = {600, 600, 699, 699};
+
+    lv_draw_task_t * t1 = lv_draw_add_task(&layer, &a1);
+    lv_draw_task_t * t2 = lv_draw_add_task(&layer, &a2);
+    lv_draw_task_t * t3 = lv_draw_add_task(&layer, &a3);
+    lv_draw_task_t * t4 = lv_draw_add_task(&layer, &a4);
+
+    TEST_ASSERT_EQUAL_PTR(t1, lv_draw_get_next_available_task(&layer, NULL, 0));
+    t1->state = LV_DRAW_TASK_STATE_IN_PROGRESS;
+    TEST_ASSERT_EQUAL_PTR(t2, lv_draw_get_next_available_task(&layer, NULL, 0));
+    t2->state = LV_DRAW_TASK_STATE_IN_PROGRESS;
+
+    /*t3 overlaps both t1 and t2*/
+    TEST_ASSERT_EQUAL_PTR(t4, lv_draw_get_next_available_task(&layer, NULL, 0));
+    TEST_ASSERT_EQUAL_PTR(t4, lv_draw_get_next_available_task(&layer, t2, 0));
+    t4->state = LV_DRAW_TASK_STATE_IN_PROGRESS;
+    TEST_ASSERT_NULL(lv_draw_get_next_available_task(&layer, NULL, 0));
+
+    t1->state = LV_DRAW_TASK_STATE_READY;
+    TEST_ASSERT_NULL(lv_draw_get_next_available_task(&layer, NULL, 0));
+    t2->state = LV_DRAW_TASK_STATE_READY;
+    TEST_ASSERT_EQUAL_PTR(t3, lv_draw_get_next_available_task(&layer, NULL, 0));
+}
+
+void test_draw_dispatch_out_of_layer_tasks(void)
+{
+    /*Areas out of the layer are clamped to the border tiles but they still block each other*/
+    lv_area_t a1 = {-100, -100, -50, -50};
+    lv_area_t a2 = {-80, -80, -10, -10};
+    lv_area_t a3 = {LAYER_W + 10, LAYER_H + 10, LAYER_W + 20, LAYER_H + 20};
+
+    lv_draw_task_t * t1 = lv_draw_add_task(&layer, &a1);
+    lv_draw_task_t * t2 = lv_draw_add_task(&layer, &a2);
+    lv_draw_task_t * t3 = lv_draw_add_task(&layer, &a3);
+
+    TEST_ASSERT_EQUAL_PTR(t1, lv_draw_get_next_available_task(&layer, NULL, 0));
+    t1->state = LV_DRAW_TASK_STATE_IN_PROGRESS;
+    TEST_ASSERT_EQUAL_PTR(t3, lv_draw_get_next_available_task(&layer, NULL, 0));
+    t1->state = LV_DRAW_TASK_STATE_READY;
+    TEST_ASSERT_EQUAL_PTR(t2, lv_draw_get_next_available_task(&layer, NULL, 0));
+}
+
+void test_draw_dispatch_matches_reference(void)
+{
+    add_random_tasks(300, 100);
+
+    /*Nothing is in progress, the first task is always available*/
+    TEST_ASSERT_EQUAL_PTR(layer.draw_task_head, lv_draw_get_next_available_task(&layer, NULL, 0));
+
+    /*If the reference finds nothing, the tile map can't find anything either*/
+    uint32_t i;
+    lv_draw_task_t * t = layer.draw_task_head;
+    for(i = 0; i < 50; i++) {
+        t->state = LV_DRAW_TASK_STATE_IN_PROGRESS;
+        t = t->next;
+        lv_draw_task_t * t_res = lv_draw_get_next_available_task(&layer, NULL, 0);
+        lv_draw_task_t * t_ref = find_first_independent_ref();
+        if(t_ref == NULL) TEST_ASSERT_NULL(t_res);
+        if(t_res) TEST_ASSERT_TRUE(is_independent_ref(t_res));
+    }
+}
+
+void test_draw_dispatch_all_tasks_finish(void)
+{
+    add_random_tasks(500, 200);
+
+    uint32_t call_cnt;
+    TEST_ASSERT_EQUAL_UINT32(500, run_dispatch(&call_cnt, true));
+}
+
+void test_draw_dispatch_benchmark(void)
+{
+    static const uint32_t task_cnts[] = {250, 500, 1000, 2000};
+    uint32_t i;
+    for(i = 0; i < sizeof(task_cnts) / sizeof(task_cnts[0]); i++) {
+        add_random_tasks(task_cnts[i], 60);
+
+        uint32_t call_cnt;
+        clock_t start = clock();
+        uint32_t finished = run_dispatch(&call_cnt, false);
+        clock_t end = clock();
+        TEST_ASSERT_EQUAL_UINT32(task_cnts[i], finished);
+
+        uint32_t us = (uint32_t)((end - start) * 1000000 / CLOCKS_PER_SEC);
+        char buf[128];
+        lv_snprintf(buf, sizeof(buf), "%" LV_PRIu32 " tasks: %" LV_PRIu32 " dispatch calls in %" LV_PRIu32 " us, %"
+                    LV_PRIu32 " ns/call", task_cnts[i], call_cnt, us, (uint32_t)((uint64_t)us * 1000 / call_cnt));
+        TEST_PRINTF("%s", buf);
+
+        tearDown();
+    }
+}
+
+#endif
@@ -0,0 +1,314 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+#include "../../src/draw/sw/blend/lv_draw_sw_blend_to_rgb565.h"
+#include "../../src/draw/sw/blend/lv_draw_sw_blend_to_rgb888.h"
+
+#include "unity/unity.h"
+#include <time.h>
+
+/* Blend random buffers with the configured blending routines (e.g. LV_DRAW_SW_ASM_SSE2)
+ * and compare them pixel by pixel with the formulas of the generic C implementation.
+ * The odd width tests the partial steps at the end of the rows,
+ * the padding of the strides is checked to be untouched.*/
+
+#define W           37
+#define H           5
+#define PAD         8
+#define MASK_STRIDE (W + 3)
+
+static uint8_t dest_buf[H * (W * 4 + PAD)];
+static uint8_t ref_buf[H * (W * 4 + PAD)];
+static uint8_t src_buf[H * (W * 4 + PAD)];
+static lv_opa_t mask_buf[H * MASK_STRIDE];
+
+static const lv_opa_t opa_values[] = {LV_OPA_COVER, LV_OPA_MAX, 200, 128, 17, 1};
+
+void setUp(void)
+{
+    lv_rand_set_seed(0x5EED);
+}
+
+void tearDown(void)
+{
+}
+
+static uint8_t rand_opa(void)
+{
+    /*Test the special 0 and 255 cases often*/
+    switch(lv_rand(0, 3)) {
+        case 0:
+            return 0;
+        case 1:
+            return 255;
+        default:
+            return (uint8_t)lv_rand(0, 255);
+    }
+}
+
+static void fill_random(void)
+{
+    uint32_t i;
+    for(i = 0; i < sizeof(dest_buf); i++) dest_buf[i] = (uint8_t)lv_rand(0, 255);
+    for(i = 0; i < sizeof(src_buf); i++) src_buf[i] = (uint8_t)lv_rand(0, 255);
+    /*Alpha channels and masks with special values*/
+    for(i = 3; i < sizeof(src_buf); i += 4) src_buf[i] = rand_opa();
+    for(i = 0; i < sizeof(mask_buf); i++) mask_buf[i] = rand_opa();
+    lv_memcpy(ref_buf, dest_buf, sizeof(dest_buf));
+}
+
+static uint16_t ref_mix_24_16(const uint8_t * c1, uint16_t c2, uint8_t mix)
+{
+    if(mix == 0) return c2;
+    if(mix == 255) return ((c1[2] & 0xF8) << 8) + ((c1[1] & 0xFC) << 3) + ((c1[0] & 0xF8) >> 3);
+
+    lv_opa_t mix_inv = 255 - mix;
+    return ((((c1[2] >> 3) * mix + ((c2 >> 11) & 0x1F) * mix_inv) << 3) & 0xF800) +
+           ((((c1[1] >> 2) * mix + ((c2 >> 5) & 0x3F) * mix_inv) >> 3) & 0x07E0) +
+           (((c1[0] >> 3) * mix + (c2 & 0x1F) * mix_inv) >> 8);
+}
+
+static void ref_mix_24_24(const uint8_t * src, uint8_t * dest, uint8_t mix)
+{
+    if(mix == 0) return;
+
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        if(mix >= LV_OPA_MAX) dest[i] = src[i];
+        else dest[i] = (uint32_t)((uint32_t)src[i] * mix + dest[i] * (255 - mix)) >> 8;
+    }
+}
+
+/*The opacity of a pixel used by the generic implementation*/
+static uint8_t ref_mix(const uint8_t * src_px, bool has_alpha, const lv_opa_t * mask, lv_opa_t opa)
+{
+    if(has_alpha) {
+        uint8_t a = src_px[3];
+        if(mask == NULL && opa >= LV_OPA_MAX) return a;
+        if(mask == NULL) return LV_OPA_MIX2(a, opa);
+        if(opa >= LV_OPA_MAX) return LV_OPA_MIX2(a, *mask);
+        return LV_OPA_MIX3(a, *mask, opa);
+    }
+    else {
+        if(mask == NULL) return opa;
+        if(opa >= LV_OPA_MAX) return *mask;
+        return LV_OPA_MIX2(*mask, opa);
+    }
+}
+
+static void init_fill_dsc(lv_draw_sw_blend_fill_dsc_t * dsc, int32_t px_size, lv_color_t color, lv_opa_t opa,
+                          bool masked)
+{
+    lv_memzero(dsc, sizeof(*dsc));
+    dsc->dest_buf = dest_buf;
+    dsc->dest_w = W;
+    dsc->dest_h = H;
+    dsc->dest_stride = W * px_size + PAD;
+    dsc->mask_buf = masked ? mask_buf : NULL;
+    dsc->mask_stride = MASK_STRIDE;
+    dsc->color = color;
+    dsc->opa = opa;
+    lv_area_set(&dsc->relative_area, 0, 0, W - 1, H - 1);
+}
+
+static void init_image_dsc(lv_draw_sw_blend_image_dsc_t * dsc, int32_t px_size, lv_color_format_t src_cf,
+                           lv_opa_t opa, bool masked)
+{
+    lv_memzero(dsc, sizeof(*dsc));
+    dsc->dest_buf = dest_buf;
+    dsc->dest_w = W;
+    dsc->dest_h = H;
+    dsc->dest_stride = W * px_size + PAD;
+    dsc->mask_buf = masked ? mask_buf : NULL;
+    dsc->mask_stride = MASK_STRIDE;
+    dsc->src_buf = src_buf;
+    dsc->src_stride = W * lv_color_format_get_size(src_cf) + PAD;
+    dsc->src_color_format = src_cf;
+    dsc->opa = opa;
+    dsc->blend_mode = LV_BLEND_MODE_NORMAL;
+    lv_area_set(&dsc->relative_area, 0, 0, W - 1, H - 1);
+    lv_area_set(&dsc->src_area, 0, 0, W - 1, H - 1);
+}
+
+void test_blend_color_to_rgb565(void)
+{
+    lv_color_t color = lv_color_hex(0x35a7f1);
+    uint16_t color16 = lv_color_to_u16(color);
+    uint32_t i;
+    for(i = 0; i < sizeof(opa_values); i++) {
+        uint32_t masked;
+        for(masked = 0; masked < 2; masked++) {
+            fill_random();
+            lv_draw_sw_blend_fill_dsc_t dsc;
+            init_fill_dsc(&dsc, 2, color, opa_values[i], masked);
+            lv_draw_sw_blend_color_to_rgb565(&dsc);
+
+            int32_t x, y;
+            for(y = 0; y < H; y++) {
+                uint16_t * ref = (uint16_t *)&ref_buf[y * dsc.dest_stride];
+                for(x = 0; x < W; x++) {
+                    const lv_opa_t * mask = masked ? &mask_buf[y * MASK_STRIDE + x] : NULL;
+                    if(mask == NULL && opa_values[i] >= LV_OPA_MAX) ref[x] = color16;
+                    else ref[x] = lv_color_16_16_mix(color16, ref[x], ref_mix(NULL, false, mask, opa_values[i]));
+                }
+            }
+            TEST_ASSERT_EQUAL_UINT8_ARRAY(ref_buf, dest_buf, sizeof(dest_buf));
+        }
+    }
+}
+
+void test_blend_rgb565_to_rgb565(void)
+{
+    uint32_t i;
+    for(i = 0; i < sizeof(opa_values); i++) {
+        uint32_t masked;
+        for(masked = 0; masked < 2; masked++) {
+            fill_random();
+            lv_draw_sw_blend_image_dsc_t dsc;
+            init_image_dsc(&dsc, 2, LV_COLOR_FORMAT_RGB565, opa_values[i], masked);
+            lv_draw_sw_blend_image_to_rgb565(&dsc);
+
+            int32_t x, y;
+            for(y = 0; y < H; y++) {
+                uint16_t * ref = (uint16_t *)&ref_buf[y * dsc.dest_stride];
+                const uint16_t * src = (const uint16_t *)&src_buf[y * dsc.src_stride];
+                for(x = 0; x < W; x++) {
+                    const lv_opa_t * mask = masked ? &mask_buf[y * MASK_STRIDE + x] : NULL;
+                    if(mask == NULL && opa_values[i] >= LV_OPA_MAX) ref[x] = src[x];
+                    else ref[x] = lv_color_16_16_mix(src[x], ref[x], ref_mix(NULL, false, mask, opa_values[i]));
+                }
+            }
+            TEST_ASSERT_EQUAL_UINT8_ARRAY(ref_buf, dest_buf, sizeof(dest_buf));
+        }
+    }
+}
+
+void test_blend_argb8888_to_rgb565(void)
+{
+    uint32_t i;
+    for(i = 0; i < sizeof(opa_values); i++) {
+        uint32_t masked;
+        for(masked = 0; masked < 2; masked++) {
+            fill_random();
+            lv_draw_sw_blend_image_dsc_t dsc;
+            init_image_dsc(&dsc, 2, LV_COLOR_FORMAT_ARGB8888, opa_values[i], masked);
+            lv_draw_sw_blend_image_to_rgb565(&dsc);
+
+            int32_t x, y;
+            for(y = 0; y < H; y++) {
+                uint16_t * ref = (uint16_t *)&ref_buf[y * dsc.dest_stride];
+                const uint8_t * src = &src_buf[y * dsc.src_stride];
+                for(x = 0; x < W; x++) {
+                    const lv_opa_t * mask = masked ? &mask_buf[y * MASK_STRIDE + x] : NULL;
+                    ref[x] = ref_mix_24_16(&src[x * 4], ref[x], ref_mix(&src[x * 4], true, mask, opa_values[i]));
+                }
+            }
+            TEST_ASSERT_EQUAL_UINT8_ARRAY(ref_buf, dest_buf, sizeof(dest_buf));
+        }
+    }
+}
+
+void test_blend_color_to_xrgb8888(void)
+{
+    lv_color_t color = lv_color_hex(0xe0127a);
+    uint32_t color32 = lv_color_to_u32(color);
+    uint32_t i;
+    for(i = 0; i < sizeof(opa_values); i++) {
+        uint32_t masked;
+        for(masked = 0; masked < 2; masked++) {
+            fill_random();
+            lv_draw_sw_blend_fill_dsc_t dsc;
+            init_fill_dsc(&dsc, 4, color, opa_values[i], masked);
+            lv_draw_sw_blend_color_to_rgb888(&dsc, 4);
+
+            int32_t x, y;
+            for(y = 0; y < H; y++) {
+                uint8_t * ref = &ref_buf[y * dsc.dest_stride];
+                for(x = 0; x < W; x++) {
+                    const lv_opa_t * mask = masked ? &mask_buf[y * MASK_STRIDE + x] : NULL;
+                    if(mask == NULL && opa_values[i] >= LV_OPA_MAX) lv_memcpy(&ref[x * 4], &color32, 4);
+                    else ref_mix_24_24((const uint8_t *)&color32, &ref[x * 4], ref_mix(NULL, false, mask, opa_values[i]));
+                }
+            }
+            TEST_ASSERT_EQUAL_UINT8_ARRAY(ref_buf, dest_buf, sizeof(dest_buf));
+        }
+    }
+}
+
+void test_blend_argb8888_to_xrgb8888(void)
+{
+    uint32_t i;
+    for(i = 0; i < sizeof(opa_values); i++) {
+        uint32_t masked;
+        for(masked = 0; masked < 2; masked++) {
+            fill_random();
+            lv_draw_sw_blend_image_dsc_t dsc;
+            init_image_dsc(&dsc, 4, LV_COLOR_FORMAT_ARGB8888, opa_values[i], masked);
+            lv_draw_sw_blend_image_to_rgb888(&dsc, 4);
+
+            int32_t x, y;
+            for(y = 0; y < H; y++) {
+                uint8_t * ref = &ref_buf[y * dsc.dest_stride];
+                const uint8_t * src = &src_buf[y * dsc.src_stride];
+                for(x = 0; x < W; x++) {
+                    const lv_opa_t * mask = masked ? &mask_buf[y * MASK_STRIDE + x] : NULL;
+                    ref_mix_24_24(&src[x * 4], &ref[x * 4], ref_mix(&src[x * 4], true, mask, opa_values[i]));
+                }
+            }
+            TEST_ASSERT_EQUAL_UINT8_ARRAY(ref_buf, dest_buf, sizeof(dest_buf));
+        }
+    }
+}
+
+void test_blend_rgb888_is_not_affected(void)
+{
+    /*24-bit destinations are always blended by the generic implementation*/
+    lv_color_t color = lv_color_hex(0x102030);
+    fill_random();
+    lv_draw_sw_blend_fill_dsc_t dsc;
+    init_fill_dsc(&dsc, 3, color, 128, true);
+    lv_draw_sw_blend_color_to_rgb888(&dsc, 3);
+
+    int32_t x, y;
+    for(y = 0; y < H; y++) {
+        uint8_t * ref = &ref_buf[y * dsc.dest_stride];
+        for(x = 0; x < W; x++) {
+            uint8_t c[3] = {color.blue, color.green, color.red};
+            ref_mix_24_24(c, &ref[x * 3], LV_OPA_MIX2(128, mask_buf[y * MASK_STRIDE + x]));
+        }
+    }
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(ref_buf, dest_buf, sizeof(dest_buf));
+}
+
+void test_blend_benchmark(void)
+{
+    static uint32_t big_dest[480 * 272];
+    static uint32_t big_src[480 * 272];
+    lv_memset(big_src, 0x80, sizeof(big_src));
+
+    lv_draw_sw_blend_image_dsc_t dsc;
+    lv_memzero(&dsc, sizeof(dsc));
+    dsc.dest_buf = big_dest;
+    dsc.dest_w = 480;
+    dsc.dest_h = 272;
+    dsc.dest_stride = 480 * 4;
+    dsc.src_buf = big_src;
+    dsc.src_stride = 480 * 4;
+    dsc.src_color_format = LV_COLOR_FORMAT_ARGB8888;
+    dsc.opa = 200;
+    dsc.blend_mode = LV_BLEND_MODE_NORMAL;
+    lv_area_set(&dsc.relative_area, 0, 0, 479, 271);
+    lv_area_set(&dsc.src_area, 0, 0, 479, 271);
+
+    uint32_t i;
+    clock_t start = clock();
+    for(i = 0; i < 20; i++) lv_draw_sw_blend_image_to_rgb888(&dsc, 4);
+    clock_t end = clock();
+
+    uint32_t us = (uint32_t)((uint64_t)(end - start) * 1000000 / CLOCKS_PER_SEC / 20);
+    char buf[128];
+    lv_snprintf(buf, sizeof(buf), "480x272 ARGB8888 to XRGB8888 with opacity: %" LV_PRIu32 " us", us);
+    TEST_PRINTF("%s", buf);
+}
+
+#endif
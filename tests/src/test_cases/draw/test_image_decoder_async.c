@@ -0,0 +1,150 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_IMAGE_DECODER_ASYNC
+
+#include <unistd.h>
+
+#define IMG_SRC "A:src/test_assets/test_img_lvgl_logo.png"
+
+void setUp(void)
+{
+    lv_image_cache_drop(NULL);
+}
+
+void tearDown(void)
+{
+    lv_image_decoder_async_set_enabled(false);
+    lv_obj_clean(lv_screen_active());
+    lv_image_cache_drop(NULL);
+}
+
+/*Run the timers (but not the refresh timer) until the background decoding is finished*/
+static void wait_decoded(void)
+{
+    lv_timer_t * refr_timer = lv_display_get_refr_timer(NULL);
+    lv_timer_pause(refr_timer);
+
+    uint32_t i;
+    for(i = 0; i < 1000 && lv_image_decoder_async_get_pending_count() > 0; i++) {
+        lv_tick_inc(LV_DEF_REFR_PERIOD);
+        lv_timer_handler();
+        usleep(1000);
+    }
+
+    lv_timer_resume(refr_timer);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_image_decoder_async_get_pending_count());
+}
+
+static bool is_cached(const void * src)
+{
+    lv_image_cache_data_t search_key;
+    search_key.src = src;
+    search_key.src_type = lv_image_src_get_type(src);
+
+    lv_cache_entry_t * entry = lv_cache_acquire(LV_GLOBAL_DEFAULT()->img_cache, &search_key, NULL);
+    if(entry == NULL) return false;
+
+    lv_cache_release(LV_GLOBAL_DEFAULT()->img_cache, entry, NULL);
+    return true;
+}
+
+static uint8_t * copy_screen(void)
+{
+    lv_draw_buf_t * buf = lv_display_get_buf_active(NULL);
+    uint8_t * copy = lv_malloc(buf->data_size);
+    lv_memcpy(copy, buf->data, buf->data_size);
+    return copy;
+}
+
+static bool screen_equals(const uint8_t * ref)
+{
+    lv_draw_buf_t * buf = lv_display_get_buf_active(NULL);
+    return lv_memcmp(ref, buf->data, buf->data_size) == 0;
+}
+
+void test_image_decoder_async_draw(void)
+{
+    lv_obj_t * img = lv_image_create(lv_screen_active());
+    lv_image_set_src(img, IMG_SRC);
+    lv_obj_center(img);
+
+    /*Reference: decoded while drawing*/
+    lv_refr_now(NULL);
+    uint8_t * ref = copy_screen();
+
+    lv_image_cache_drop(NULL);
+    lv_obj_invalidate(img);
+    lv_image_decoder_async_set_enabled(true);
+
+    /*The image is skipped while it's being decoded*/
+    lv_refr_now(NULL);
+    TEST_ASSERT_FALSE(screen_equals(ref));
+
+    /*Its area is invalidated when it's ready so a refresh draws it from the cache*/
+    wait_decoded();
+    TEST_ASSERT_TRUE(is_cached(IMG_SRC));
+    lv_refr_now(NULL);
+    TEST_ASSERT_TRUE(screen_equals(ref));
+
+    lv_free(ref);
+}
+
+void test_image_decoder_async_prefetch(void)
+{
+    TEST_ASSERT_FALSE(is_cached(IMG_SRC));
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_prefetch(IMG_SRC));
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_prefetch(IMG_SRC));
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(1, lv_image_decoder_async_get_pending_count());
+
+    wait_decoded();
+    TEST_ASSERT_TRUE(is_cached(IMG_SRC));
+
+    /*Already in the cache: drawn right away*/
+    lv_image_decoder_async_set_enabled(true);
+    lv_obj_t * img = lv_image_create(lv_screen_active());
+    lv_image_set_src(img, IMG_SRC);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_image_decoder_async_get_pending_count());
+
+    /*Symbols are not images*/
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_image_prefetch(LV_SYMBOL_OK));
+}
+
+void test_image_decoder_async_failed(void)
+{
+    const char * src = "A:src/test_assets/not_existing.png";
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_prefetch(src));
+
+    wait_decoded();
+    TEST_ASSERT_FALSE(is_cached(src));
+}
+
+#else
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_image_decoder_async_draw(void)
+{
+}
+
+void test_image_decoder_async_prefetch(void)
+{
+}
+
+void test_image_decoder_async_failed(void)
+{
+}
+
+#endif /*LV_USE_IMAGE_DECODER_ASYNC*/
+
+#endif
@@ -0,0 +1,198 @@
+#if LV_BUILD_TEST && LV_OBJ_LAYER_CACHE_SIZE
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+static uint32_t draw_cnt;
+
+void setUp(void)
+{
+    draw_cnt = 0;
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+}
+
+static void draw_event_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    draw_cnt++;
+}
+
+/*A card with a label, the label counts how many times it was drawn*/
+static lv_obj_t * create_card(lv_obj_t ** label_out)
+{
+    lv_obj_t * card = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(card, 200, 120);
+    lv_obj_center(card);
+    lv_obj_set_style_bg_color(card, lv_color_hex3(0x0af), 0);
+    lv_obj_set_style_shadow_width(card, 20, 0);
+    lv_obj_set_layer_retained(card, true);
+
+    lv_obj_t * label = lv_label_create(card);
+    lv_label_set_text(label, "Retained layer");
+    lv_obj_center(label);
+    lv_obj_add_event_cb(label, draw_event_cb, LV_EVENT_DRAW_MAIN, NULL);
+
+    if(label_out) *label_out = label;
+    return card;
+}
+
+/*Render the screen with and without retaining the layer and compare the results*/
+static bool draw_equals_not_retained(lv_obj_t * obj)
+{
+    lv_draw_buf_t * buf = lv_display_get_buf_active(NULL);
+
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+    uint8_t * retained = lv_malloc(buf->data_size);
+    lv_memcpy(retained, buf->data, buf->data_size);
+
+    lv_obj_set_layer_retained(obj, false);
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+    bool equals = lv_memcmp(retained, buf->data, buf->data_size) == 0;
+    lv_obj_set_layer_retained(obj, true);
+
+    lv_free(retained);
+    return equals;
+}
+
+static size_t get_cache_size(void)
+{
+    return lv_cache_get_size(LV_GLOBAL_DEFAULT()->obj_layer_cache, NULL);
+}
+
+void test_layer_retained_transform(void)
+{
+    lv_obj_t * card = create_card(NULL);
+    lv_obj_set_style_transform_pivot_x(card, lv_pct(50), 0);
+    lv_obj_set_style_transform_pivot_y(card, lv_pct(50), 0);
+    lv_obj_set_style_transform_rotation(card, 150, 0);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, draw_cnt);
+    TEST_ASSERT_NOT_EQUAL(0, get_cache_size());
+
+    /*Only the retained layer is blended again*/
+    int32_t i;
+    for(i = 1; i <= 10; i++) {
+        lv_obj_set_style_transform_rotation(card, 150 + i * 100, 0);
+        lv_obj_set_style_transform_scale(card, 256 + i * 10, 0);
+        lv_refr_now(NULL);
+    }
+    TEST_ASSERT_EQUAL_UINT32(1, draw_cnt);
+
+    TEST_ASSERT_TRUE(draw_equals_not_retained(card));
+}
+
+void test_layer_retained_opa_layered(void)
+{
+    lv_obj_t * card = create_card(NULL);
+    lv_obj_set_style_opa_layered(card, LV_OPA_10, 0);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, draw_cnt);
+
+    int32_t i;
+    for(i = 2; i < 10; i++) {
+        lv_obj_set_style_opa_layered(card, i * 25, 0);
+        lv_refr_now(NULL);
+    }
+    TEST_ASSERT_EQUAL_UINT32(1, draw_cnt);
+
+    TEST_ASSERT_TRUE(draw_equals_not_retained(card));
+}
+
+void test_layer_retained_redraw_on_content_change(void)
+{
+    lv_obj_t * label;
+    lv_obj_t * card = create_card(&label);
+    lv_obj_set_style_transform_rotation(card, 300, 0);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, draw_cnt);
+
+    /*A child has changed*/
+    lv_label_set_text(label, "New text");
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(2, draw_cnt);
+
+    /*A style of the object which affects the content*/
+    lv_obj_set_style_bg_color(card, lv_color_hex3(0xf80), 0);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(3, draw_cnt);
+
+    /*Moved*/
+    lv_obj_set_x(card, 10);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(4, draw_cnt);
+
+    /*The opacity of the parent is applied on the content*/
+    lv_obj_set_style_opa(lv_screen_active(), LV_OPA_50, 0);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(5, draw_cnt);
+    TEST_ASSERT_TRUE(draw_equals_not_retained(card));
+    lv_obj_set_style_opa(lv_screen_active(), LV_OPA_COVER, 0);
+}
+
+void test_layer_retained_nested(void)
+{
+    lv_obj_t * label;
+    lv_obj_t * card = create_card(&label);
+    lv_obj_set_style_transform_rotation(card, 100, 0);
+
+    /*An other transformed object with retained layer on the card*/
+    lv_obj_t * inner = lv_obj_create(card);
+    lv_obj_set_size(inner, 50, 50);
+    lv_obj_set_style_transform_rotation(inner, 450, 0);
+    lv_obj_set_layer_retained(inner, true);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(1, draw_cnt);
+
+    /*The outer layer contains the inner one so it's redrawn*/
+    lv_obj_set_style_transform_rotation(inner, 300, 0);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(2, draw_cnt);
+
+    lv_obj_set_style_transform_rotation(card, 200, 0);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(2, draw_cnt);
+
+    TEST_ASSERT_TRUE(draw_equals_not_retained(card));
+}
+
+void test_layer_retained_too_large(void)
+{
+    /*The layer doesn't fit into the cache, so it's drawn in the normal way*/
+    lv_obj_t * card = create_card(NULL);
+    lv_obj_set_size(card, 700, 400);
+    lv_obj_set_style_transform_rotation(card, 100, 0);
+    lv_refr_now(NULL);
+    lv_obj_set_style_transform_rotation(card, 200, 0);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(2, draw_cnt);
+    TEST_ASSERT_EQUAL(0, get_cache_size());
+}
+
+void test_layer_retained_no_leak(void)
+{
+    size_t mem_before = lv_test_get_free_mem();
+
+    uint32_t i;
+    for(i = 0; i < 10; i++) {
+        lv_obj_t * card = create_card(NULL);
+        lv_obj_set_style_transform_rotation(card, i * 100, 0);
+        lv_refr_now(NULL);
+        lv_obj_set_style_transform_rotation(card, i * 200, 0);
+        lv_refr_now(NULL);
+        if(i % 2) lv_obj_set_layer_retained(card, false);
+        lv_obj_delete(card);
+    }
+
+    TEST_ASSERT_EQUAL(0, get_cache_size());
+    TEST_ASSERT_MEM_LEAK_LESS_THAN(mem_before, 0);
+}
+
+#endif
@@ -0,0 +1,138 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define TILED_FILE "A:tiled_image.bin"
+
+LV_IMAGE_DECLARE(test_ARGB8888_NONE_align1);
+LV_IMAGE_DECLARE(test_RGB565A8_NONE_align1);
+LV_IMAGE_DECLARE(test_RGB565_NONE_align1);
+LV_IMAGE_DECLARE(test_ARGB8888_LZ4_tiled);
+LV_IMAGE_DECLARE(test_RGB565A8_RLE_tiled);
+LV_IMAGE_DECLARE(test_RGB565_NONE_tiled);
+
+void setUp(void)
+{
+    lv_image_tile_cache_resize(64 * 1024, true);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+    lv_image_cache_drop(NULL);
+    lv_image_tile_cache_resize(0, true);
+}
+
+static lv_obj_t * create_image(const void * src)
+{
+    lv_obj_t * img = lv_image_create(lv_screen_active());
+    lv_image_set_src(img, src);
+    lv_obj_center(img);
+    return img;
+}
+
+/*Draw the images and return true if they look the same*/
+static bool draw_equals(const void * src, const void * ref_src)
+{
+    lv_draw_buf_t * buf = lv_display_get_buf_active(NULL);
+
+    create_image(ref_src);
+    lv_refr_now(NULL);
+    uint8_t * ref = lv_malloc(buf->data_size);
+    lv_memcpy(ref, buf->data, buf->data_size);
+    lv_obj_clean(lv_screen_active());
+
+    create_image(src);
+    lv_refr_now(NULL);
+    bool equals = lv_memcmp(ref, buf->data, buf->data_size) == 0;
+    lv_obj_clean(lv_screen_active());
+
+    lv_free(ref);
+    return equals;
+}
+
+/*The tiles of the ARGB8888 test image are 16x16 pixels*/
+static uint32_t get_cached_tile_count(void)
+{
+    return lv_cache_get_size(LV_GLOBAL_DEFAULT()->img_tile_cache, NULL) / (16 * 16 * 4);
+}
+
+static void write_bin_file(const char * path, const lv_image_dsc_t * image)
+{
+    lv_fs_file_t f;
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, path, LV_FS_MODE_WR));
+
+    uint32_t bw;
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_write(&f, &image->header, sizeof(lv_image_header_t), &bw));
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_write(&f, image->data, image->data_size, &bw));
+    TEST_ASSERT_EQUAL_UINT32(image->data_size, bw);
+    lv_fs_close(&f);
+}
+
+void test_bin_decoder_tiled_variable(void)
+{
+    TEST_ASSERT_TRUE(draw_equals(&test_ARGB8888_LZ4_tiled, &test_ARGB8888_NONE_align1));
+    TEST_ASSERT_TRUE(draw_equals(&test_RGB565A8_RLE_tiled, &test_RGB565A8_NONE_align1));
+    TEST_ASSERT_TRUE(draw_equals(&test_RGB565_NONE_tiled, &test_RGB565_NONE_align1));
+
+    /*The same without the tile cache*/
+    lv_image_tile_cache_resize(0, true);
+    TEST_ASSERT_TRUE(draw_equals(&test_ARGB8888_LZ4_tiled, &test_ARGB8888_NONE_align1));
+    TEST_ASSERT_EQUAL_UINT32(0, get_cached_tile_count());
+}
+
+void test_bin_decoder_tiled_file(void)
+{
+    write_bin_file(TILED_FILE, &test_ARGB8888_LZ4_tiled);
+    TEST_ASSERT_TRUE(draw_equals(TILED_FILE, &test_ARGB8888_NONE_align1));
+
+    /*The tiles are cached by the file name so replace the file only after dropping them*/
+    lv_image_cache_drop(TILED_FILE);
+    TEST_ASSERT_EQUAL_UINT32(0, get_cached_tile_count());
+
+    write_bin_file(TILED_FILE, &test_RGB565A8_RLE_tiled);
+    TEST_ASSERT_TRUE(draw_equals(TILED_FILE, &test_RGB565A8_NONE_align1));
+}
+
+void test_bin_decoder_tiled_decode_visible_tiles_only(void)
+{
+    /*Show only a 20x20 area from the top left corner: 2x2 tiles of 16x16 pixels*/
+    lv_obj_t * cont = lv_obj_create(lv_screen_active());
+    lv_obj_remove_style_all(cont);
+    lv_obj_set_size(cont, 20, 20);
+    lv_obj_center(cont);
+
+    lv_obj_t * img = lv_image_create(cont);
+    lv_image_set_src(img, &test_ARGB8888_LZ4_tiled);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(4, get_cached_tile_count());
+
+    /*Scroll to a new tile column*/
+    lv_obj_set_x(img, -16);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(6, get_cached_tile_count());
+
+    lv_image_cache_drop(&test_ARGB8888_LZ4_tiled);
+    TEST_ASSERT_EQUAL_UINT32(0, get_cached_tile_count());
+}
+
+void test_bin_decoder_tiled_no_leak(void)
+{
+    size_t mem_before = lv_test_get_free_mem();
+    for(uint32_t i = 0; i < 20; i++) {
+        create_image(&test_ARGB8888_LZ4_tiled);
+        create_image(&test_RGB565A8_RLE_tiled);
+        lv_refr_now(NULL);
+        lv_obj_clean(lv_screen_active());
+
+        /*Evict the tiles sometimes*/
+        if(i % 5 == 0) lv_image_cache_drop(NULL);
+    }
+
+    lv_image_cache_drop(NULL);
+    TEST_ASSERT_MEM_LEAK_LESS_THAN(mem_before, 0);
+}
+
+#endif
@@ -5,6 +5,8 @@
 #include "unity/unity.h"
 #include "lv_test_helpers.h"
 
+#include <time.h>
+
 void setUp(void)
 {
     /* Function run before every test */
@@ -13,6 +15,7 @@ void setUp(void)
 void tearDown(void)
 {
     /* Function run after every test */
+    lv_anim_delete_all();
 }
 
 static void exec_cb(void * var, int32_t v)
@@ -168,4 +171,135 @@ void test_anim_pause_for_resume(void)
     lv_test_wait(20);
     TEST_ASSERT_EQUAL(19, var);
 }
+
+static void exec2_cb(void * var, int32_t v)
+{
+    int32_t * var_i32 = var;
+    var_i32[1] = v;
+}
+
+static lv_anim_t * start_anim(int32_t * var, lv_anim_exec_xcb_t cb, uint32_t duration)
+{
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, var);
+    lv_anim_set_values(&a, 0, 100);
+    lv_anim_set_exec_cb(&a, cb);
+    lv_anim_set_duration(&a, duration);
+    return lv_anim_start(&a);
+}
+
+void test_anim_get_and_delete_many(void)
+{
+    static int32_t vars[300][2];
+    lv_anim_t * anims[300][2];
+    uint32_t i;
+
+    for(i = 0; i < 300; i++) {
+        anims[i][0] = start_anim(vars[i], exec_cb, 100);
+        anims[i][1] = start_anim(vars[i], exec2_cb, 200);
+    }
+    TEST_ASSERT_EQUAL(600, lv_anim_count_running());
+
+    for(i = 0; i < 300; i++) {
+        TEST_ASSERT_EQUAL_PTR(anims[i][0], lv_anim_get(vars[i], exec_cb));
+        TEST_ASSERT_EQUAL_PTR(anims[i][1], lv_anim_get(vars[i], exec2_cb));
+        /*The newest one is returned*/
+        TEST_ASSERT_EQUAL_PTR(anims[i][1], lv_anim_get(vars[i], NULL));
+    }
+
+    /*Delete by exec_cb, by var and by both*/
+    for(i = 0; i < 100; i++) TEST_ASSERT_TRUE(lv_anim_delete(vars[i], exec_cb));
+    for(i = 100; i < 200; i++) TEST_ASSERT_TRUE(lv_anim_delete(vars[i], NULL));
+    TEST_ASSERT_TRUE(lv_anim_delete(NULL, exec2_cb));
+    TEST_ASSERT_EQUAL(100, lv_anim_count_running());
+
+    for(i = 0; i < 300; i++) {
+        TEST_ASSERT_NULL(lv_anim_get(vars[i], exec2_cb));
+        if(i < 200) TEST_ASSERT_NULL(lv_anim_get(vars[i], exec_cb));
+        else TEST_ASSERT_EQUAL_PTR(anims[i][0], lv_anim_get(vars[i], exec_cb));
+    }
+
+    /*The remaining ones still run*/
+    lv_test_wait(50);
+    TEST_ASSERT_INT_WITHIN(2, 50, vars[250][0]);
+    lv_test_wait(60);
+    TEST_ASSERT_EQUAL(100, vars[250][0]);
+    TEST_ASSERT_EQUAL(0, lv_anim_count_running());
+}
+
+void test_anim_start_replaces_running(void)
+{
+    int32_t var[2] = {0, 0};
+    start_anim(var, exec_cb, 100);
+    lv_anim_t * a2 = start_anim(var, exec_cb, 200);
+
+    /*Animations of the same var and exec_cb don't run together*/
+    TEST_ASSERT_EQUAL(1, lv_anim_count_running());
+    TEST_ASSERT_EQUAL_PTR(a2, lv_anim_get(var, exec_cb));
+
+    lv_test_wait(100);
+    TEST_ASSERT_INT_WITHIN(2, 50, var[0]);
+}
+
+static void restart_completed_cb(lv_anim_t * a)
+{
+    int32_t * var = a->var;
+    /*Start new animations while the animations are processed*/
+    if(var[1] == 0) {
+        var[1] = 1;
+        start_anim(var, exec2_cb, 50);
+    }
+    lv_anim_delete(var, exec_cb);
+}
+
+void test_anim_start_and_delete_in_callbacks(void)
+{
+    static int32_t vars[20][2];
+    uint32_t i;
+    for(i = 0; i < 20; i++) {
+        vars[i][0] = 0;
+        vars[i][1] = 0;
+        lv_anim_t a;
+        lv_anim_init(&a);
+        lv_anim_set_var(&a, vars[i]);
+        lv_anim_set_values(&a, 10, 100);
+        lv_anim_set_exec_cb(&a, exec_cb);
+        lv_anim_set_duration(&a, 30 + i);
+        lv_anim_set_completed_cb(&a, restart_completed_cb);
+        lv_anim_start(&a);
+    }
+
+    lv_test_wait(60);
+    TEST_ASSERT_EQUAL(20, lv_anim_count_running());
+    lv_test_wait(60);
+    TEST_ASSERT_EQUAL(0, lv_anim_count_running());
+    for(i = 0; i < 20; i++) {
+        TEST_ASSERT_EQUAL(100, vars[i][0]);
+        TEST_ASSERT_EQUAL(100, vars[i][1]);
+    }
+}
+
+void test_anim_benchmark(void)
+{
+    static int32_t vars[4000][2];
+    uint32_t i;
+    uint32_t k;
+
+    clock_t t = clock();
+    for(k = 0; k < 5; k++) {
+        for(i = 0; i < 4000; i++) start_anim(vars[i], (i & 1) ? exec_cb : exec2_cb, 1000);
+        for(i = 0; i < 4000; i++) TEST_ASSERT_NOT_NULL(lv_anim_get(vars[i], (i & 1) ? exec_cb : exec2_cb));
+        for(i = 0; i < 4000; i++) lv_anim_delete(vars[i], NULL);
+    }
+    t = clock() - t;
+    TEST_PRINTF("start, get and delete 4000 animations 5 times: %d ms", (int)(t * 1000 / CLOCKS_PER_SEC));
+
+    for(i = 0; i < 4000; i++) start_anim(vars[i], exec_cb, 1000);
+    t = clock();
+    for(k = 0; k < 20; k++) lv_test_wait(LV_DEF_REFR_PERIOD);
+    t = clock() - t;
+    TEST_PRINTF("20 steps of 4000 animations: %d ms", (int)(t * 1000 / CLOCKS_PER_SEC));
+}
+
 #endif
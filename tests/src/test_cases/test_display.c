@@ -1,5 +1,6 @@
 #if LV_BUILD_TEST
 #include "../lvgl.h"
+#include "../../lvgl_private.h"
 #include "unity/unity.h"
 
 void setUp(void)
@@ -126,5 +127,71 @@ void test_get_invalidated_drawbuf_size_i1_partial()
     exec_invalidated_drawbuf_size_test(&test_set);
 }
 
+static void dummy_flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map)
+{
+    LV_UNUSED(area);
+    LV_UNUSED(px_map);
+    lv_display_flush_ready(disp);
+}
+
+static lv_display_t * create_refr_test_display(void)
+{
+    static LV_ATTRIBUTE_MEM_ALIGN uint8_t buf[800 * 48 * 4 + LV_DRAW_BUF_ALIGN];
+
+    lv_display_t * disp = lv_display_create(800, 480);
+    lv_display_set_color_format(disp, LV_COLOR_FORMAT_XRGB8888);
+    lv_display_set_buffers(disp, lv_draw_buf_align(buf, LV_COLOR_FORMAT_XRGB8888), NULL, 800 * 48 * 4,
+                           LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(disp, dummy_flush_cb);
+    lv_refr_now(disp);
+
+    return disp;
+}
+
+void test_refr_overlapping_areas_are_joined(void)
+{
+    lv_display_t * disp = create_refr_test_display();
+
+    lv_area_t a1 = {0, 0, 99, 99};
+    lv_area_t a2 = {50, 0, 149, 99};
+    lv_inv_area(disp, &a1);
+    lv_inv_area(disp, &a2);
+    lv_refr_now(disp);
+
+    TEST_ASSERT_EQUAL_UINT32(2 * 100 * 100, lv_display_get_invalidated_px_count(disp));
+    TEST_ASSERT_EQUAL_UINT32(150 * 100, lv_display_get_refreshed_px_count(disp));
+
+    lv_display_delete(disp);
+}
+
+void test_refr_many_areas_dont_redraw_the_screen(void)
+{
+    lv_display_t * disp = create_refr_test_display();
+
+    /*Invalidate much more areas than LV_INV_BUF_SIZE*/
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < 10; y++) {
+        for(x = 0; x < 10; x++) {
+            lv_area_t a;
+            a.x1 = x * 70;
+            a.y1 = y * 45;
+            a.x2 = a.x1 + 9;
+            a.y2 = a.y1 + 9;
+            lv_inv_area(disp, &a);
+        }
+    }
+    lv_refr_now(disp);
+
+    uint32_t inv_px = lv_display_get_invalidated_px_count(disp);
+    uint32_t refr_px = lv_display_get_refreshed_px_count(disp);
+    TEST_ASSERT_EQUAL_UINT32(100 * 10 * 10, inv_px);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(inv_px, refr_px);
+
+    /*Falling back to a full screen refresh would redraw everything*/
+    TEST_ASSERT_LESS_THAN_UINT32(800 * 480 / 4, refr_px);
+
+    lv_display_delete(disp);
+}
 
 #endif
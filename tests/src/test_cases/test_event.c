@@ -5,6 +5,8 @@
 #include "unity/unity.h"
 #include "lv_test_indev.h"
 
+#include <time.h>
+
 static void event_object_deletion_cb(const lv_obj_class_t * cls, lv_event_t * e)
 {
     LV_UNUSED(cls);
@@ -143,4 +145,90 @@ void test_event_delete_obj_in_recursive_event_call(void)
     lv_test_mouse_click_at(30, 30);
 }
 
+static uint32_t counter_cb_cnt;
+static void counter_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    counter_cb_cnt++;
+}
+
+void test_event_dispatch_index(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_add_event_cb(obj, counter_cb, LV_EVENT_CLICKED, NULL);
+
+    counter_cb_cnt = 0;
+    lv_obj_send_event(obj, LV_EVENT_VALUE_CHANGED, NULL);
+    lv_obj_send_event(obj, LV_EVENT_READY, NULL);
+    TEST_ASSERT_EQUAL(0, counter_cb_cnt);
+    lv_obj_send_event(obj, LV_EVENT_CLICKED, NULL);
+    TEST_ASSERT_EQUAL(1, counter_cb_cnt);
+
+    /*A code which shares the bit of CLICKED but has no handler*/
+    counter_cb_cnt = 0;
+    lv_obj_send_event(obj, (lv_event_code_t)(LV_EVENT_CLICKED + 64), NULL);
+    TEST_ASSERT_EQUAL(0, counter_cb_cnt);
+
+    /*Removing the handler removes it from the index too*/
+    lv_obj_remove_event_cb(obj, counter_cb);
+    TEST_ASSERT_FALSE(obj->spec_attr->event_list.code_mask & ((uint64_t)1 << LV_EVENT_CLICKED));
+    lv_obj_send_event(obj, LV_EVENT_CLICKED, NULL);
+    TEST_ASSERT_EQUAL(0, counter_cb_cnt);
+
+    /*Preprocess handlers and registered codes*/
+    uint32_t my_event = lv_event_register_id();
+    lv_obj_add_event_cb(obj, counter_cb, (lv_event_code_t)my_event | LV_EVENT_PREPROCESS, NULL);
+    lv_obj_send_event(obj, (lv_event_code_t)my_event, NULL);
+    TEST_ASSERT_EQUAL(1, counter_cb_cnt);
+
+    /*LV_EVENT_ALL gets everything*/
+    counter_cb_cnt = 0;
+    lv_obj_add_event_cb(obj, counter_cb, LV_EVENT_ALL, NULL);
+    lv_obj_send_event(obj, LV_EVENT_READY, NULL);
+    lv_obj_send_event(obj, LV_EVENT_REFRESH, NULL);
+    TEST_ASSERT_EQUAL(2, counter_cb_cnt);
+
+    lv_obj_remove_event_cb(obj, counter_cb);
+    lv_obj_remove_event_cb(obj, counter_cb);
+    TEST_ASSERT_FALSE(obj->spec_attr->event_list.has_all_filter);
+    TEST_ASSERT_EQUAL_UINT64(0, obj->spec_attr->event_list.code_mask);
+    lv_obj_send_event(obj, LV_EVENT_READY, NULL);
+    TEST_ASSERT_EQUAL(2, counter_cb_cnt);
+}
+
+void test_event_dispatch_index_benchmark(void)
+{
+    lv_obj_clean(lv_screen_active());
+
+    uint32_t i;
+    uint32_t obj_cnt = 300;
+    for(i = 0; i < obj_cnt; i++) {
+        lv_obj_t * btn = lv_button_create(lv_screen_active());
+        lv_obj_set_pos(btn, (int32_t)(i % 20) * 40, (int32_t)(i / 20) * 30);
+        lv_obj_set_size(btn, 36, 26);
+        lv_obj_add_event_cb(btn, event_post_1_cb, LV_EVENT_CLICKED, NULL);
+    }
+
+    /*A similar button which receives every event. Used to count the events sent to a button on redraw*/
+    lv_obj_t * probe = lv_button_create(lv_screen_active());
+    lv_obj_set_size(probe, 36, 26);
+    lv_obj_add_event_cb(probe, counter_cb, LV_EVENT_ALL, NULL);
+    lv_refr_now(NULL);
+
+    post_cnt_1 = 0;
+    counter_cb_cnt = 0;
+    clock_t t = clock();
+    for(i = 0; i < 10; i++) {
+        lv_obj_invalidate(lv_screen_active());
+        lv_refr_now(NULL);
+    }
+    t = clock() - t;
+
+    /*Without the index each of these events would have checked the CLICKED handler of each button*/
+    TEST_ASSERT_EQUAL(0, post_cnt_1);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, counter_cb_cnt);
+    TEST_PRINTF("10 redraws of %d buttons: %d ms, %d handler lookups skipped", (int)obj_cnt,
+                (int)(t * 1000 / CLOCKS_PER_SEC), (int)(counter_cb_cnt * obj_cnt));
+}
+
 #endif
@@ -0,0 +1,190 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+#include <time.h>
+
+#if LV_FONT_FMT_TXT_CACHE_CNT && LV_FONT_MONTSERRAT_28_COMPRESSED
+
+static const lv_font_t * font = &lv_font_montserrat_28_compressed;
+
+void setUp(void)
+{
+    lv_font_fmt_txt_cache_drop_all();
+    lv_font_fmt_txt_cache_reset_stats();
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+static lv_draw_buf_t * get_bitmap(uint32_t letter, lv_font_glyph_dsc_t * g)
+{
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(font, g, letter, '\0'));
+    lv_draw_buf_t * draw_buf = lv_draw_buf_create(g->box_w, g->box_h, LV_COLOR_FORMAT_A8, LV_STRIDE_AUTO);
+    lv_draw_buf_clear(draw_buf, NULL);
+    TEST_ASSERT_EQUAL_PTR(draw_buf, lv_font_get_glyph_bitmap(g, draw_buf));
+    return draw_buf;
+}
+
+void test_font_fmt_txt_cache_bitmap(void)
+{
+    const char * digits = "0123456789";
+    uint32_t i;
+    for(i = 0; digits[i]; i++) {
+        lv_font_glyph_dsc_t g;
+        lv_draw_buf_t * decoded = get_bitmap(digits[i], &g);
+        lv_draw_buf_t * cached = get_bitmap(digits[i], &g);
+
+        uint32_t size = decoded->header.stride * decoded->header.h;
+        TEST_ASSERT_EQUAL_UINT8_ARRAY(decoded->data, cached->data, size);
+
+        lv_draw_buf_destroy(decoded);
+        lv_draw_buf_destroy(cached);
+    }
+
+    lv_font_fmt_txt_cache_stats_t stats;
+    lv_font_fmt_txt_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(10, stats.bitmap_miss);
+    TEST_ASSERT_EQUAL_UINT32(10, stats.bitmap_hit);
+
+    /*The dropped glyphs are decoded again*/
+    lv_font_fmt_txt_cache_drop_all();
+    lv_font_glyph_dsc_t g;
+    lv_draw_buf_destroy(get_bitmap('5', &g));
+    lv_font_fmt_txt_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(11, stats.bitmap_miss);
+}
+
+void test_font_fmt_txt_cache_lru(void)
+{
+    /*Use more glyphs than the size of the cache, the oldest ones are evicted*/
+    uint32_t i;
+    for(i = 0; i < LV_FONT_FMT_TXT_CACHE_CNT + 1; i++) {
+        lv_font_glyph_dsc_t g;
+        lv_draw_buf_destroy(get_bitmap('A' + i, &g));
+    }
+
+    lv_font_fmt_txt_cache_stats_t stats;
+    lv_font_fmt_txt_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(LV_FONT_FMT_TXT_CACHE_CNT + 1, stats.bitmap_miss);
+
+    lv_font_glyph_dsc_t g;
+    lv_draw_buf_destroy(get_bitmap('A' + LV_FONT_FMT_TXT_CACHE_CNT, &g));
+    lv_font_fmt_txt_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.bitmap_hit);
+
+    lv_draw_buf_destroy(get_bitmap('A', &g));
+    lv_font_fmt_txt_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(LV_FONT_FMT_TXT_CACHE_CNT + 2, stats.bitmap_miss);
+}
+
+void test_font_fmt_txt_cache_gid(void)
+{
+    /*The symbols are stored in a sparse cmap*/
+    lv_font_glyph_dsc_t g1;
+    lv_font_glyph_dsc_t g2;
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(font, &g1, 0xF00C, '\0'));   /*LV_SYMBOL_OK*/
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(font, &g2, 0xF00C, '\0'));
+    TEST_ASSERT_EQUAL_UINT32(g1.gid.index, g2.gid.index);
+
+    /*Missing letters in the range of a sparse cmap are cached too*/
+    TEST_ASSERT_FALSE(lv_font_get_glyph_dsc(font, &g1, 0xF00E, '\0'));
+    TEST_ASSERT_FALSE(lv_font_get_glyph_dsc(font, &g1, 0xF00E, '\0'));
+
+    lv_font_fmt_txt_cache_stats_t stats;
+    lv_font_fmt_txt_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.gid_miss);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.gid_hit);
+}
+
+void test_font_fmt_txt_cache_render(void)
+{
+    lv_obj_t * label = lv_label_create(lv_screen_active());
+    lv_obj_set_style_text_font(label, font, 0);
+    lv_label_set_text(label, "1234");
+    lv_refr_now(NULL);
+
+    lv_font_fmt_txt_cache_stats_t stats;
+    lv_font_fmt_txt_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(4, stats.bitmap_miss);
+
+    /*Only the new digit is decoded*/
+    lv_label_set_text(label, "1235");
+    lv_refr_now(NULL);
+    lv_font_fmt_txt_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(5, stats.bitmap_miss);
+    TEST_ASSERT_EQUAL_UINT32(3, stats.bitmap_hit);
+}
+
+void test_font_fmt_txt_cache_benchmark(void)
+{
+    const uint32_t cnt = 2000;
+    lv_font_glyph_dsc_t g;
+    TEST_ASSERT_TRUE(lv_font_get_glyph_dsc(font, &g, '8', '\0'));
+    lv_draw_buf_t * draw_buf = lv_draw_buf_create(g.box_w, g.box_h, LV_COLOR_FORMAT_A8, LV_STRIDE_AUTO);
+
+    uint32_t i;
+    clock_t start = clock();
+    for(i = 0; i < cnt; i++) {
+        lv_font_fmt_txt_cache_drop_all();
+        lv_font_get_glyph_bitmap(&g, draw_buf);
+    }
+    uint32_t uncached_ns = (uint32_t)((uint64_t)(clock() - start) * 1000000000 / CLOCKS_PER_SEC / cnt);
+
+    start = clock();
+    for(i = 0; i < cnt; i++) {
+        lv_font_get_glyph_bitmap(&g, draw_buf);
+    }
+    uint32_t cached_ns = (uint32_t)((uint64_t)(clock() - start) * 1000000000 / CLOCKS_PER_SEC / cnt);
+
+    lv_draw_buf_destroy(draw_buf);
+
+    char buf[128];
+    lv_snprintf(buf, sizeof(buf), "28px compressed glyph: decoded %" LV_PRIu32 " ns, cached %" LV_PRIu32 " ns",
+                uncached_ns, cached_ns);
+    TEST_PRINTF("%s", buf);
+}
+
+#else /*LV_FONT_FMT_TXT_CACHE_CNT && LV_FONT_MONTSERRAT_28_COMPRESSED*/
+
+void setUp(void)
+{
+
+}
+
+void tearDown(void)
+{
+
+}
+
+void test_font_fmt_txt_cache_bitmap(void)
+{
+
+}
+
+void test_font_fmt_txt_cache_lru(void)
+{
+
+}
+
+void test_font_fmt_txt_cache_gid(void)
+{
+
+}
+
+void test_font_fmt_txt_cache_render(void)
+{
+
+}
+
+void test_font_fmt_txt_cache_benchmark(void)
+{
+
+}
+
+#endif
+
+#endif
@@ -0,0 +1,198 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+#include "../lv_test_indev.h"
+
+#include "unity/unity.h"
+
+#include <time.h>
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+}
+
+/*The plain tree walk without any index*/
+static lv_obj_t * ref_search(lv_obj_t * obj, lv_point_t * point)
+{
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) return NULL;
+
+    lv_point_t p_trans = *point;
+    lv_obj_transform_point(obj, &p_trans, LV_OBJ_POINT_TRANSFORM_FLAG_INVERSE);
+
+    bool hit_test_ok = lv_obj_hit_test(obj, &p_trans);
+
+    lv_area_t obj_coords = obj->coords;
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE)) {
+        int32_t ext_draw_size = lv_obj_get_ext_draw_size(obj);
+        lv_area_increase(&obj_coords, ext_draw_size, ext_draw_size);
+    }
+    if(lv_area_is_point_on(&obj_coords, &p_trans, 0)) {
+        int32_t i;
+        for(i = (int32_t)lv_obj_get_child_count(obj) - 1; i >= 0; i--) {
+            lv_obj_t * found_p = ref_search(lv_obj_get_child(obj, i), &p_trans);
+            if(found_p) return found_p;
+        }
+    }
+
+    return hit_test_ok ? obj : NULL;
+}
+
+static void check_all_points(lv_obj_t * root)
+{
+    lv_point_t p;
+    for(p.y = -10; p.y < 490; p.y += 17) {
+        for(p.x = -10; p.x < 810; p.x += 17) {
+            lv_point_t p2 = p;
+            lv_obj_t * expected = ref_search(root, &p);
+            lv_obj_t * found = lv_indev_search_obj(root, &p2);
+            if(expected != found) {
+                TEST_PRINTF("mismatch at %d;%d", (int)p.x, (int)p.y);
+            }
+            TEST_ASSERT_EQUAL_PTR(expected, found);
+        }
+    }
+}
+
+static lv_obj_t * create_items(lv_obj_t * parent, uint32_t cnt)
+{
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        lv_obj_t * obj = lv_obj_create(parent);
+        lv_obj_remove_style_all(obj);
+        lv_obj_add_flag(obj, LV_OBJ_FLAG_CLICKABLE);
+        lv_obj_set_pos(obj, (int32_t)(i % 20) * 45, (int32_t)(i / 20) * 37);
+        /*Make some of them overlap*/
+        lv_obj_set_size(obj, 40 + (int32_t)(i % 7) * 5, 30 + (int32_t)(i % 5) * 4);
+    }
+
+    return lv_obj_get_child(parent, 0);
+}
+
+void test_hit_index_same_as_tree_walk(void)
+{
+    lv_obj_t * scr = lv_screen_active();
+    lv_obj_t * cont = lv_obj_create(scr);
+    lv_obj_set_size(cont, 780, 460);
+    lv_obj_center(cont);
+    create_items(cont, 200);
+
+    /*Some special children*/
+    lv_obj_t * big = lv_obj_get_child(cont, 3);
+    lv_obj_set_size(big, 500, 300);
+
+    lv_obj_add_flag(lv_obj_get_child(cont, 10), LV_OBJ_FLAG_HIDDEN);
+    lv_obj_remove_flag(lv_obj_get_child(cont, 11), LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_set_ext_click_area(lv_obj_get_child(cont, 12), 30);
+    lv_obj_set_style_transform_rotation(lv_obj_get_child(cont, 13), 450, 0);
+
+    lv_obj_t * floating = lv_obj_get_child(cont, 14);
+    lv_obj_add_flag(floating, LV_OBJ_FLAG_FLOATING);
+
+    lv_obj_t * overflow = lv_obj_get_child(cont, 15);
+    lv_obj_add_flag(overflow, LV_OBJ_FLAG_OVERFLOW_VISIBLE);
+    lv_obj_t * grandchild = lv_obj_create(overflow);
+    lv_obj_set_pos(grandchild, 30, 30);
+    lv_obj_set_size(grandchild, 60, 60);
+
+    lv_obj_t * with_children = lv_obj_get_child(cont, 16);
+    lv_obj_remove_flag(with_children, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_set_size(with_children, 120, 120);
+    create_items(with_children, 40);
+
+    lv_obj_update_layout(scr);
+    check_all_points(scr);
+
+    /*Scroll and move the parent*/
+    lv_obj_scroll_to(cont, 100, 150, LV_ANIM_OFF);
+    lv_obj_set_pos(cont, 0, 0);
+    lv_obj_update_layout(scr);
+    check_all_points(scr);
+
+    /*Change the children*/
+    lv_obj_set_pos(lv_obj_get_child(cont, 50), 300, 200);
+    lv_obj_set_size(lv_obj_get_child(cont, 60), 200, 200);
+    lv_obj_move_to_index(lv_obj_get_child(cont, 0), -1);
+    lv_obj_swap(lv_obj_get_child(cont, 20), lv_obj_get_child(cont, 150));
+    lv_obj_delete(lv_obj_get_child(cont, 30));
+    lv_obj_set_parent(lv_obj_get_child(cont, 31), with_children);
+    lv_obj_set_ext_click_area(lv_obj_get_child(cont, 40), 20);
+    lv_obj_remove_flag(floating, LV_OBJ_FLAG_FLOATING);
+    lv_obj_add_flag(lv_obj_get_child(cont, 70), LV_OBJ_FLAG_OVERFLOW_VISIBLE);
+    lv_obj_set_style_transform_scale(lv_obj_get_child(cont, 80), 512, 0);
+    lv_obj_t * new_obj = lv_obj_create(cont);
+    lv_obj_set_pos(new_obj, 200, 100);
+    lv_obj_update_layout(scr);
+    check_all_points(scr);
+
+    /*Layouts move the children directly*/
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_ROW_WRAP);
+    lv_obj_update_layout(scr);
+    lv_obj_scroll_to_y(cont, 300, LV_ANIM_OFF);
+    lv_obj_update_layout(scr);
+    check_all_points(scr);
+}
+
+static void clicked_cb(lv_event_t * e)
+{
+    lv_obj_t ** clicked = lv_event_get_user_data(e);
+    *clicked = lv_event_get_target(e);
+}
+
+void test_hit_index_click(void)
+{
+    lv_obj_t * cont = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(cont, 800, 480);
+    create_items(cont, 200);
+    lv_obj_update_layout(cont);
+
+    lv_obj_t * clicked = NULL;
+    lv_obj_t * target = lv_obj_get_child(cont, 45);
+    lv_obj_add_event_cb(target, clicked_cb, LV_EVENT_CLICKED, &clicked);
+
+    lv_area_t a;
+    lv_obj_get_coords(target, &a);
+    lv_test_mouse_click_at(a.x1 + 2, a.y1 + 2);
+    TEST_ASSERT_EQUAL_PTR(target, clicked);
+
+    /*Move it and click at the new position*/
+    clicked = NULL;
+    lv_obj_set_pos(target, 600, 400);
+    lv_obj_update_layout(cont);
+    lv_obj_get_coords(target, &a);
+    lv_test_mouse_click_at(a.x1 + 2, a.y1 + 2);
+    TEST_ASSERT_EQUAL_PTR(target, clicked);
+}
+
+void test_hit_index_benchmark(void)
+{
+    lv_obj_t * scr = lv_screen_active();
+    uint32_t i;
+    for(i = 0; i < 1500; i++) {
+        lv_obj_t * obj = lv_obj_create(scr);
+        lv_obj_remove_style_all(obj);
+        lv_obj_add_flag(obj, LV_OBJ_FLAG_CLICKABLE);
+        lv_obj_set_pos(obj, (int32_t)(i % 50) * 16, (int32_t)(i / 50) * 16);
+        lv_obj_set_size(obj, 14, 14);
+    }
+    lv_obj_update_layout(scr);
+
+    uint32_t hit_cnt = 0;
+    clock_t t = clock();
+    for(i = 0; i < 100; i++) {
+        lv_point_t p = {(int32_t)((i * 37) % 800), (int32_t)((i * 91) % 480)};
+        if(lv_indev_search_obj(scr, &p) != scr) hit_cnt++;
+    }
+    t = clock() - t;
+
+    TEST_ASSERT_GREATER_THAN_UINT32(0, hit_cnt);
+    TEST_PRINTF("100 searches among 1500 objects: %d ms", (int)(t * 1000 / CLOCKS_PER_SEC));
+}
+
+#endif
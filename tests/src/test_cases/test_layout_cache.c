@@ -0,0 +1,314 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#include <time.h>
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+}
+
+/*Compare the result of the (possibly incremental) layout update with a full layout update*/
+#define check_same_as_full_layout(cont) check_same_as_full_layout_core(cont, __LINE__)
+
+static void check_same_as_full_layout_core(lv_obj_t * cont, int line)
+{
+    lv_obj_update_layout(cont);
+
+    uint32_t child_cnt = lv_obj_get_child_count(cont);
+    lv_area_t * coords = lv_malloc(child_cnt * sizeof(lv_area_t));
+    uint32_t i;
+    for(i = 0; i < child_cnt; i++) {
+        coords[i] = lv_obj_get_child(cont, i)->coords;
+    }
+
+    lv_layout_cache_invalidate(cont);
+    lv_obj_mark_layout_as_dirty(cont);
+    lv_obj_update_layout(cont);
+
+    for(i = 0; i < child_cnt; i++) {
+        lv_obj_t * child = lv_obj_get_child(cont, i);
+        if(!lv_area_is_equal(&coords[i], &child->coords)) {
+            TEST_PRINTF("line %d, child %d: %d;%d %dx%d instead of %d;%d %dx%d", line, (int)i,
+                        (int)coords[i].x1, (int)coords[i].y1,
+                        (int)lv_area_get_width(&coords[i]), (int)lv_area_get_height(&coords[i]),
+                        (int)child->coords.x1, (int)child->coords.y1,
+                        (int)lv_obj_get_width(child), (int)lv_obj_get_height(child));
+        }
+        TEST_ASSERT_TRUE(lv_area_is_equal(&coords[i], &child->coords));
+    }
+
+    lv_free(coords);
+}
+
+static lv_obj_t * create_cont(uint32_t item_cnt)
+{
+    lv_obj_t * cont = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(cont, 600, 400);
+    uint32_t i;
+    for(i = 0; i < item_cnt; i++) {
+        lv_obj_t * obj = lv_obj_create(cont);
+        lv_obj_remove_style_all(obj);
+        lv_obj_set_size(obj, 40 + (int32_t)(i % 4) * 10, 20 + (int32_t)(i % 3) * 5);
+    }
+
+    return cont;
+}
+
+static void change_children(lv_obj_t * cont)
+{
+    lv_obj_set_height(lv_obj_get_child(cont, 5), 60);
+    check_same_as_full_layout(cont);
+
+    lv_obj_set_width(lv_obj_get_child(cont, 12), 150);
+    check_same_as_full_layout(cont);
+
+    /*Several children in different tracks*/
+    lv_obj_set_size(lv_obj_get_child(cont, 3), 20, 20);
+    lv_obj_set_size(lv_obj_get_child(cont, 25), 120, 30);
+    check_same_as_full_layout(cont);
+
+    /*Change it back*/
+    lv_obj_set_height(lv_obj_get_child(cont, 5), 20);
+    check_same_as_full_layout(cont);
+
+    lv_obj_add_flag(lv_obj_get_child(cont, 8), LV_OBJ_FLAG_HIDDEN);
+    check_same_as_full_layout(cont);
+
+    lv_obj_add_flag(lv_obj_get_child(cont, 14), LV_OBJ_FLAG_IGNORE_LAYOUT);
+    check_same_as_full_layout(cont);
+
+    lv_obj_add_flag(lv_obj_get_child(cont, 16), LV_OBJ_FLAG_FLEX_IN_NEW_TRACK);
+    lv_obj_mark_layout_as_dirty(cont);
+    check_same_as_full_layout(cont);
+
+    lv_obj_set_style_margin_top(lv_obj_get_child(cont, 10), 7, 0);
+    lv_obj_set_style_margin_left(lv_obj_get_child(cont, 11), 9, 0);
+    check_same_as_full_layout(cont);
+
+    lv_obj_set_style_translate_x(lv_obj_get_child(cont, 20), lv_pct(50), 0);
+    check_same_as_full_layout(cont);
+
+    lv_obj_set_size(lv_obj_get_child(cont, 20), 30, 30);
+    check_same_as_full_layout(cont);
+
+    /*Change the order and the number of children*/
+    lv_obj_move_to_index(lv_obj_get_child(cont, 2), 18);
+    check_same_as_full_layout(cont);
+
+    lv_obj_swap(lv_obj_get_child(cont, 4), lv_obj_get_child(cont, 22));
+    check_same_as_full_layout(cont);
+
+    lv_obj_delete(lv_obj_get_child(cont, 6));
+    check_same_as_full_layout(cont);
+
+    lv_obj_delete(lv_obj_get_child(cont, -1));
+    check_same_as_full_layout(cont);
+
+    lv_obj_t * obj = lv_obj_create(cont);
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_size(obj, 70, 35);
+    check_same_as_full_layout(cont);
+
+    /*Change the container*/
+    lv_obj_set_width(cont, 450);
+    check_same_as_full_layout(cont);
+
+    lv_obj_set_style_pad_row(cont, 13, 0);
+    check_same_as_full_layout(cont);
+
+    lv_obj_scroll_to_y(cont, 40, LV_ANIM_OFF);
+    lv_obj_set_height(lv_obj_get_child(cont, 0), 45);
+    check_same_as_full_layout(cont);
+}
+
+void test_layout_cache_flex_row_wrap(void)
+{
+    lv_obj_t * cont = create_cont(30);
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_ROW_WRAP);
+    check_same_as_full_layout(cont);
+    change_children(cont);
+}
+
+void test_layout_cache_flex_column(void)
+{
+    lv_obj_t * cont = create_cont(30);
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_COLUMN);
+    lv_obj_set_flex_align(cont, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_START);
+    check_same_as_full_layout(cont);
+    change_children(cont);
+}
+
+void test_layout_cache_flex_column_wrap_rtl(void)
+{
+    lv_obj_t * cont = create_cont(30);
+    lv_obj_set_style_base_dir(cont, LV_BASE_DIR_RTL, 0);
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_COLUMN_WRAP);
+    check_same_as_full_layout(cont);
+    change_children(cont);
+}
+
+void test_layout_cache_flex_aligned(void)
+{
+    lv_obj_t * cont = create_cont(30);
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_ROW_WRAP_REVERSE);
+    lv_obj_set_flex_align(cont, LV_FLEX_ALIGN_SPACE_EVENLY, LV_FLEX_ALIGN_END, LV_FLEX_ALIGN_CENTER);
+    check_same_as_full_layout(cont);
+    change_children(cont);
+}
+
+void test_layout_cache_flex_grow(void)
+{
+    lv_obj_t * cont = create_cont(30);
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_ROW_WRAP);
+    lv_obj_set_flex_grow(lv_obj_get_child(cont, 1), 1);
+    lv_obj_set_flex_grow(lv_obj_get_child(cont, 9), 2);
+    lv_obj_set_style_max_width(lv_obj_get_child(cont, 9), 100, 0);
+    check_same_as_full_layout(cont);
+    change_children(cont);
+
+    lv_obj_set_flex_grow(lv_obj_get_child(cont, 9), 0);
+    check_same_as_full_layout(cont);
+}
+
+void test_layout_cache_flex_content_size(void)
+{
+    lv_obj_t * cont = create_cont(30);
+    lv_obj_set_size(cont, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_COLUMN);
+    check_same_as_full_layout(cont);
+    change_children(cont);
+}
+
+static lv_obj_t * create_grid(uint32_t row_cnt)
+{
+    static int32_t col_dsc[] = {LV_GRID_CONTENT, 100, LV_GRID_FR(1), LV_GRID_TEMPLATE_LAST};
+    static int32_t row_dsc[41];
+    uint32_t i;
+    for(i = 0; i < row_cnt; i++) {
+        row_dsc[i] = i % 4 == 3 ? 30 : LV_GRID_CONTENT;
+    }
+    row_dsc[row_cnt] = LV_GRID_TEMPLATE_LAST;
+
+    lv_obj_t * cont = create_cont(row_cnt * 3);
+    lv_obj_set_grid_dsc_array(cont, col_dsc, row_dsc);
+    for(i = 0; i < row_cnt * 3; i++) {
+        lv_grid_align_t align = (lv_grid_align_t)(i % 4);   /*START, CENTER, END, STRETCH*/
+        lv_obj_set_grid_cell(lv_obj_get_child(cont, i), align, i % 3, 1, align, i / 3, 1);
+    }
+
+    return cont;
+}
+
+void test_layout_cache_grid(void)
+{
+    lv_obj_t * cont = create_grid(10);
+    check_same_as_full_layout(cont);
+    change_children(cont);
+
+    /*Move a child to another cell*/
+    lv_obj_set_grid_cell(lv_obj_get_child(cont, 7), LV_GRID_ALIGN_START, 1, 2, LV_GRID_ALIGN_END, 0, 2);
+    check_same_as_full_layout(cont);
+
+    lv_obj_set_grid_align(cont, LV_GRID_ALIGN_CENTER, LV_GRID_ALIGN_SPACE_BETWEEN);
+    check_same_as_full_layout(cont);
+
+    lv_obj_set_height(lv_obj_get_child(cont, 0), 80);
+    check_same_as_full_layout(cont);
+}
+
+void test_layout_cache_grid_content_size(void)
+{
+    lv_obj_t * cont = create_grid(10);
+    lv_obj_set_size(cont, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
+    check_same_as_full_layout(cont);
+    change_children(cont);
+}
+
+/*Set the text of one label in a list of rows and update the layout*/
+static uint32_t bench_label_change(lv_obj_t * cont, uint32_t iter_cnt)
+{
+    lv_obj_update_layout(cont);
+
+    uint32_t child_cnt = lv_obj_get_child_count(cont);
+    clock_t t = clock();
+    uint32_t i;
+    for(i = 0; i < iter_cnt; i++) {
+        lv_obj_t * row = lv_obj_get_child(cont, (int32_t)((i * 37) % child_cnt));
+        lv_label_set_text(lv_obj_get_child(row, 0), i % 2 ? "A\nlonger\ntext" : "Short");
+        lv_obj_update_layout(cont);
+    }
+    t = clock() - t;
+
+    return (uint32_t)(t * 1000 / CLOCKS_PER_SEC);
+}
+
+static lv_obj_t * create_list(uint32_t row_cnt)
+{
+    lv_obj_t * cont = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(cont, 400, 480);
+    uint32_t i;
+    for(i = 0; i < row_cnt; i++) {
+        lv_obj_t * row = lv_obj_create(cont);
+        lv_obj_remove_style_all(row);
+        lv_obj_set_size(row, LV_PCT(100), LV_SIZE_CONTENT);
+        lv_obj_t * label = lv_label_create(row);
+        lv_label_set_text(label, "Short");
+    }
+
+    return cont;
+}
+
+void test_layout_cache_flex_benchmark(void)
+{
+    lv_obj_t * cont = create_list(500);
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_COLUMN);
+
+    uint32_t ms = bench_label_change(cont, 20);
+    TEST_PRINTF("20 label changes in a 500 row flex list: %d ms", (int)ms);
+    check_same_as_full_layout(cont);
+
+    /*With wrapping only the affected track is placed*/
+    lv_obj_set_width(cont, 800);
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_ROW_WRAP);
+    uint32_t i;
+    for(i = 0; i < 500; i++) {
+        lv_obj_set_width(lv_obj_get_child(cont, i), 70);
+    }
+
+    ms = bench_label_change(cont, 20);
+    TEST_PRINTF("20 label changes in a 500 item wrapped flex container: %d ms", (int)ms);
+    check_same_as_full_layout(cont);
+}
+
+void test_layout_cache_grid_benchmark(void)
+{
+    static int32_t col_dsc[] = {LV_GRID_CONTENT, LV_GRID_CONTENT, LV_GRID_TEMPLATE_LAST};
+    static int32_t row_dsc[251];
+    uint32_t i;
+    for(i = 0; i < 250; i++) row_dsc[i] = LV_GRID_CONTENT;
+    row_dsc[250] = LV_GRID_TEMPLATE_LAST;
+
+    lv_obj_t * cont = create_list(500);
+    lv_obj_set_grid_dsc_array(cont, col_dsc, row_dsc);
+    for(i = 0; i < 500; i++) {
+        lv_obj_t * row = lv_obj_get_child(cont, i);
+        lv_obj_set_width(row, LV_SIZE_CONTENT);
+        lv_obj_set_grid_cell(row, LV_GRID_ALIGN_START, i % 2, 1, LV_GRID_ALIGN_CENTER, i / 2, 1);
+    }
+
+    uint32_t ms = bench_label_change(cont, 20);
+    TEST_PRINTF("20 label changes in a 250x2 grid with content sized tracks: %d ms", (int)ms);
+    check_same_as_full_layout(cont);
+}
+
+#endif
@@ -0,0 +1,244 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_LINUX_FBDEV && LV_LINUX_FBDEV_PAGE_FLIP && !LV_LINUX_FBDEV_BSD
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <linux/fb.h>
+
+#define FB_W            64
+#define FB_H            48
+#define FB_LINE_LENGTH  (FB_W * 4 + 32)     /*Padded lines*/
+#define MARKER          0x12345678
+
+/*A framebuffer device emulated on a regular file*/
+static struct {
+    char path[32];
+    bool can_pan;
+    uint32_t yres_virtual;
+    uint32_t yoffset;
+    uint32_t pan_cnt;
+    uint8_t * mem;
+    size_t mem_size;
+} fake_fb;
+
+/*The driver's ioctl calls end up here as the executable's `ioctl` overrides libc's*/
+int ioctl(int fd, unsigned long request, ...)
+{
+    va_list args;
+    va_start(args, request);
+    void * arg = va_arg(args, void *);
+    va_end(args);
+
+    switch(request) {
+        case FBIOBLANK:
+            return 0;
+        case FBIOGET_FSCREENINFO: {
+                struct fb_fix_screeninfo * finfo = arg;
+                memset(finfo, 0, sizeof(*finfo));
+                finfo->line_length = FB_LINE_LENGTH;
+                finfo->smem_len = FB_LINE_LENGTH * fake_fb.yres_virtual;
+                finfo->ypanstep = fake_fb.can_pan ? 1 : 0;
+                return 0;
+            }
+        case FBIOGET_VSCREENINFO: {
+                struct fb_var_screeninfo * vinfo = arg;
+                memset(vinfo, 0, sizeof(*vinfo));
+                vinfo->xres = FB_W;
+                vinfo->yres = FB_H;
+                vinfo->xres_virtual = FB_W;
+                vinfo->yres_virtual = fake_fb.yres_virtual;
+                vinfo->yoffset = fake_fb.yoffset;
+                vinfo->bits_per_pixel = 32;
+                return 0;
+            }
+        case FBIOPUT_VSCREENINFO: {
+                struct fb_var_screeninfo * vinfo = arg;
+                if(!fake_fb.can_pan) {
+                    errno = EINVAL;
+                    return -1;
+                }
+                fake_fb.yres_virtual = vinfo->yres_virtual;
+                return ftruncate(fd, FB_LINE_LENGTH * fake_fb.yres_virtual);
+            }
+        case FBIOPAN_DISPLAY: {
+                struct fb_var_screeninfo * vinfo = arg;
+                if(!fake_fb.can_pan || vinfo->yoffset + FB_H > fake_fb.yres_virtual) {
+                    errno = EINVAL;
+                    return -1;
+                }
+                fake_fb.yoffset = vinfo->yoffset;
+                fake_fb.pan_cnt++;
+                return 0;
+            }
+        default:
+            return (int)syscall(SYS_ioctl, fd, request, arg);
+    }
+}
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+}
+
+static lv_display_t * fake_fb_create(bool can_pan)
+{
+    fake_fb.can_pan = can_pan;
+    fake_fb.yres_virtual = FB_H;
+    fake_fb.yoffset = 0;
+    fake_fb.pan_cnt = 0;
+
+    lv_strcpy(fake_fb.path, "/tmp/lv_test_fb_XXXXXX");
+    int fd = mkstemp(fake_fb.path);
+    TEST_ASSERT_GREATER_OR_EQUAL(0, fd);
+    TEST_ASSERT_EQUAL(0, ftruncate(fd, FB_LINE_LENGTH * FB_H));
+    close(fd);
+
+    lv_display_t * disp = lv_linux_fbdev_create();
+    lv_tick_set_cb(NULL);   /*Keep the tick of the tests*/
+    lv_linux_fbdev_set_file(disp, fake_fb.path);
+    TEST_ASSERT_EQUAL(FB_W, lv_display_get_horizontal_resolution(disp));
+
+    /*Map the file too to see what the driver wrote*/
+    fd = open(fake_fb.path, O_RDWR);
+    struct stat st;
+    fstat(fd, &st);
+    fake_fb.mem_size = st.st_size;
+    fake_fb.mem = mmap(NULL, fake_fb.mem_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    TEST_ASSERT_NOT_EQUAL(MAP_FAILED, fake_fb.mem);
+
+    lv_obj_t * scr = lv_display_get_screen_active(disp);
+    lv_obj_set_style_bg_color(scr, lv_color_hex(0xff0000), 0);
+    lv_obj_t * obj = lv_obj_create(scr);
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_style_bg_opa(obj, LV_OPA_COVER, 0);
+    lv_obj_set_style_bg_color(obj, lv_color_hex(0x0000ff), 0);
+    lv_obj_set_pos(obj, 5, 5);
+    lv_obj_set_size(obj, 10, 10);
+
+    return disp;
+}
+
+static void fake_fb_delete(lv_display_t * disp)
+{
+    lv_display_delete(disp);
+    munmap(fake_fb.mem, fake_fb.mem_size);
+    unlink(fake_fb.path);
+}
+
+static uint32_t * page_pixel(uint32_t page, int32_t x, int32_t y)
+{
+    return (uint32_t *)(fake_fb.mem + (page * FB_H + y) * FB_LINE_LENGTH + x * 4);
+}
+
+static uint32_t * render_pixel(lv_display_t * disp, int32_t x, int32_t y)
+{
+    lv_draw_buf_t * buf = lv_display_get_buf_active(disp);
+    return (uint32_t *)(buf->data + y * buf->header.stride + x * 4);
+}
+
+static bool page_is_up_to_date(lv_display_t * disp, uint32_t page)
+{
+    int32_t y;
+    for(y = 0; y < FB_H; y++) {
+        if(memcmp(page_pixel(page, 0, y), render_pixel(disp, 0, y), FB_W * 4)) return false;
+    }
+
+    return true;
+}
+
+/*Change the small object and check that only the outdated areas were copied to a page*/
+static void check_damage_only(lv_display_t * disp, uint32_t page)
+{
+    *page_pixel(page, 60, 40) = MARKER;
+
+    lv_obj_t * obj = lv_obj_get_child(lv_display_get_screen_active(disp), 0);
+    lv_obj_set_x(obj, 8);
+    lv_refr_now(disp);
+
+    TEST_ASSERT_EQUAL_HEX32(MARKER, *page_pixel(page, 60, 40));
+    *page_pixel(page, 60, 40) = *render_pixel(disp, 60, 40);
+    TEST_ASSERT_TRUE(page_is_up_to_date(disp, page));
+}
+
+void test_linux_fbdev_page_flip(void)
+{
+    lv_display_t * disp = fake_fb_create(true);
+    TEST_ASSERT_EQUAL(FB_LINE_LENGTH * FB_H * 2, fake_fb.mem_size);
+
+    /*The first frame goes to the hidden page*/
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL(1, fake_fb.pan_cnt);
+    TEST_ASSERT_EQUAL(FB_H, fake_fb.yoffset);
+    TEST_ASSERT_TRUE(page_is_up_to_date(disp, 1));
+
+    /*Page 0 was never written so it gets the whole image*/
+    lv_obj_t * obj = lv_obj_get_child(lv_display_get_screen_active(disp), 0);
+    lv_obj_set_style_bg_color(obj, lv_color_hex(0x00ff00), 0);
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL(2, fake_fb.pan_cnt);
+    TEST_ASSERT_EQUAL(0, fake_fb.yoffset);
+    TEST_ASSERT_TRUE(page_is_up_to_date(disp, 0));
+
+    /*Page 1 misses only the object's area*/
+    check_damage_only(disp, 1);
+    TEST_ASSERT_EQUAL(3, fake_fb.pan_cnt);
+    TEST_ASSERT_EQUAL(FB_H, fake_fb.yoffset);
+
+    fake_fb_delete(disp);
+}
+
+void test_linux_fbdev_no_pan(void)
+{
+    lv_display_t * disp = fake_fb_create(false);
+    TEST_ASSERT_EQUAL(FB_LINE_LENGTH * FB_H, fake_fb.mem_size);
+
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL(0, fake_fb.pan_cnt);
+    TEST_ASSERT_TRUE(page_is_up_to_date(disp, 0));
+
+    check_damage_only(disp, 0);
+    TEST_ASSERT_EQUAL(0, fake_fb.pan_cnt);
+
+    fake_fb_delete(disp);
+}
+
+#else
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_linux_fbdev_page_flip(void)
+{
+}
+
+void test_linux_fbdev_no_pan(void)
+{
+}
+
+#endif /*LV_USE_LINUX_FBDEV && LV_LINUX_FBDEV_PAGE_FLIP*/
+
+#endif
@@ -4,6 +4,8 @@
 
 #include "unity/unity.h"
 
+#include <time.h>
+
 void setUp(void)
 {
     /* Function run before every test */
@@ -12,6 +14,7 @@ void setUp(void)
 void tearDown(void)
 {
     /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
 }
 
 /* #3324 */
@@ -24,4 +27,198 @@ void test_mem_buf_realloc(void)
 #endif
 }
 
+#if defined(LVGL_CI_USING_DEF_HEAP) && LV_USE_MEM_SLAB
+
+/*Used directly in the benchmark to not measure the trace logs of lv_malloc() and lv_free()*/
+void * lv_malloc_core(size_t size);
+void lv_free_core(void * p);
+
+static uint32_t get_slab_used(uint32_t class_idx)
+{
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    return mon.slab[class_idx].used_cnt;
+}
+
+void test_mem_slab_alloc_free(void)
+{
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    TEST_ASSERT_EQUAL_UINT32(16, mon.slab[0].obj_size);
+    TEST_ASSERT_EQUAL_UINT32(256, mon.slab[LV_MEM_SLAB_CLASS_CNT - 1].obj_size);
+
+    lv_mem_monitor_t mon_start;
+    lv_mem_monitor(&mon_start);
+    uint32_t used_32 = get_slab_used(1);
+    uint32_t used_256 = get_slab_used(LV_MEM_SLAB_CLASS_CNT - 1);
+
+    /*Enough to fill more pages*/
+    uint8_t * bufs[200];
+    uint32_t i;
+    for(i = 0; i < 200; i++) {
+        bufs[i] = lv_malloc(30);
+        TEST_ASSERT_NOT_NULL(bufs[i]);
+        TEST_ASSERT_EQUAL_UINT32(0, (lv_uintptr_t)bufs[i] % sizeof(void *));
+        lv_memset(bufs[i], i, 30);
+    }
+    TEST_ASSERT_EQUAL_UINT32(used_32 + 200, get_slab_used(1));
+
+    lv_mem_monitor(&mon);
+    TEST_ASSERT_GREATER_THAN_UINT32(1, mon.slab[1].page_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(mon.slab[1].used_cnt, mon.slab[1].total_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(mon.slab[1].used_cnt, mon.slab[1].max_used_cnt);
+
+    /*Free every second and allocate again. The freed slots should be reused*/
+    for(i = 0; i < 200; i += 2) lv_free(bufs[i]);
+    uint32_t page_cnt = mon.slab[1].page_cnt;
+    for(i = 0; i < 200; i += 2) bufs[i] = lv_malloc(20);
+    lv_mem_monitor(&mon);
+    TEST_ASSERT_EQUAL_UINT32(page_cnt, mon.slab[1].page_cnt);
+
+    for(i = 1; i < 200; i += 2) {
+        uint32_t j;
+        for(j = 0; j < 30; j++) TEST_ASSERT_EQUAL_UINT8(i & 0xff, bufs[i][j]);
+    }
+
+    /*Larger than the largest class: served by TLSF*/
+    void * big = lv_malloc(1000);
+    TEST_ASSERT_EQUAL_UINT32(used_256, get_slab_used(LV_MEM_SLAB_CLASS_CNT - 1));
+    lv_free(big);
+
+    for(i = 0; i < 200; i++) lv_free(bufs[i]);
+    TEST_ASSERT_EQUAL_UINT32(used_32, get_slab_used(1));
+
+    /*Empty pages are returned to the heap*/
+    lv_mem_monitor(&mon);
+    TEST_ASSERT_LESS_THAN_UINT32(page_cnt, mon.slab[1].page_cnt);
+    TEST_ASSERT_EQUAL_UINT32(mon.slab[1].page_cnt, mon_start.slab[1].page_cnt);
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_mem_test());
+}
+
+void test_mem_slab_realloc(void)
+{
+    uint32_t used_16 = get_slab_used(0);
+    uint32_t used_64 = get_slab_used(3);
+
+    uint8_t * p = lv_malloc(10);
+    lv_memset(p, 0x5a, 10);
+
+    /*Still fits into the slot*/
+    uint8_t * p2 = lv_realloc(p, 16);
+    TEST_ASSERT_EQUAL_PTR(p, p2);
+
+    /*Moves to an other class*/
+    p2 = lv_realloc(p, 60);
+    TEST_ASSERT_EQUAL_UINT32(used_16, get_slab_used(0));
+    TEST_ASSERT_EQUAL_UINT32(used_64 + 1, get_slab_used(3));
+    uint32_t i;
+    for(i = 0; i < 10; i++) TEST_ASSERT_EQUAL_UINT8(0x5a, p2[i]);
+
+    /*Moves to TLSF*/
+    uint8_t * p3 = lv_realloc(p2, 4000);
+    TEST_ASSERT_NOT_NULL(p3);
+    TEST_ASSERT_EQUAL_UINT32(used_64, get_slab_used(3));
+    for(i = 0; i < 10; i++) TEST_ASSERT_EQUAL_UINT8(0x5a, p3[i]);
+
+    lv_free(p3);
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_mem_test());
+}
+
+void test_mem_slab_benchmark(void)
+{
+    /*Typical mix of widgets, event descriptors, linked list nodes and draw tasks*/
+    static const size_t sizes[] = {24, 40, 56, 72, 112, 136, 200, 248};
+    void * bufs[512];
+    uint32_t i;
+    uint32_t round;
+
+    clock_t t = clock();
+    for(round = 0; round < 2000; round++) {
+        for(i = 0; i < 512; i++) bufs[i] = lv_malloc_core(sizes[(i + round) & 0x7]);
+        for(i = 0; i < 512; i += 2) lv_free_core(bufs[i]);
+        for(i = 1; i < 512; i += 2) lv_free_core(bufs[i]);
+    }
+    t = clock() - t;
+    TEST_PRINTF("1M small alloc/free pairs with slabs: %d ms", (int)(t * 1000 / CLOCKS_PER_SEC));
+
+    /*The same pattern with sizes which are served by TLSF*/
+    t = clock();
+    for(round = 0; round < 2000; round++) {
+        for(i = 0; i < 512; i++) bufs[i] = lv_malloc_core(sizes[(i + round) & 0x7] + 256);
+        for(i = 0; i < 512; i += 2) lv_free_core(bufs[i]);
+        for(i = 1; i < 512; i += 2) lv_free_core(bufs[i]);
+    }
+    t = clock() - t;
+    TEST_PRINTF("1M alloc/free pairs with TLSF: %d ms", (int)(t * 1000 / CLOCKS_PER_SEC));
+
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_mem_test());
+}
+
+#else
+
+void test_mem_slab_alloc_free(void)
+{
+}
+
+void test_mem_slab_realloc(void)
+{
+}
+
+void test_mem_slab_benchmark(void)
+{
+}
+
+#endif
+
+#if LV_DRAW_TASK_ARENA_SIZE
+
+void test_mem_draw_task_arena(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(obj, 200, 100);
+    lv_obj_t * label = lv_label_create(obj);
+    lv_label_set_text(label, "Hello");
+
+    lv_refr_now(NULL);
+
+    /*The tasks of the frame are allocated from the arena and it's reset after drawing*/
+    lv_draw_global_info_t * info = &LV_GLOBAL_DEFAULT()->draw_info;
+    TEST_ASSERT_NOT_NULL(info->task_arena);
+    TEST_ASSERT_EQUAL_UINT32(0, info->task_arena_live);
+    TEST_ASSERT_EQUAL_UINT32(0, info->task_arena_used);
+
+    /*Many tasks: the arena overflows to the heap*/
+    lv_layer_t layer;
+    lv_draw_buf_t * buf = lv_draw_buf_create(100, 100, LV_COLOR_FORMAT_ARGB8888, LV_STRIDE_AUTO);
+    lv_canvas_t * canvas = (lv_canvas_t *)lv_canvas_create(lv_screen_active());
+    lv_canvas_set_draw_buf((lv_obj_t *)canvas, buf);
+    lv_canvas_init_layer((lv_obj_t *)canvas, &layer);
+
+    lv_draw_rect_dsc_t dsc;
+    lv_draw_rect_dsc_init(&dsc);
+    uint32_t i;
+    uint32_t task_cnt = LV_DRAW_TASK_ARENA_SIZE / sizeof(lv_draw_task_t) + 10;
+    for(i = 0; i < task_cnt; i++) {
+        lv_area_t a = {(int32_t)(i % 90), 0, (int32_t)(i % 90) + 9, 9};
+        lv_draw_rect(&layer, &dsc, &a);
+    }
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(LV_DRAW_TASK_ARENA_SIZE, info->task_arena_used);
+    TEST_ASSERT_LESS_THAN_UINT32(task_cnt, info->task_arena_live);
+
+    lv_canvas_finish_layer((lv_obj_t *)canvas, &layer);
+    TEST_ASSERT_EQUAL_UINT32(0, info->task_arena_live);
+    TEST_ASSERT_EQUAL_UINT32(0, info->task_arena_used);
+
+    lv_obj_delete((lv_obj_t *)canvas);
+    lv_draw_buf_destroy(buf);
+}
+
+#else
+
+void test_mem_draw_task_arena(void)
+{
+}
+
+#endif
+
 #endif
@@ -4,6 +4,7 @@
 
 #include "unity/unity.h"
 #include <string.h>
+#include <time.h>
 
 #define OUTPUT_LINE_MAX 8
 #define OUTPUT_BUF_MAX 128
@@ -98,4 +99,191 @@ void test_profiler_disable(void)
     TEST_ASSERT_EQUAL_CHAR(output_buf[4][0], '\0');
 }
 
+
+static uint32_t flush_cnt = 0;
+static uint8_t bin_buf[1024];
+static uint32_t bin_size = 0;
+
+static void count_flush_cb(const char * buf)
+{
+    LV_UNUSED(buf);
+    flush_cnt++;
+}
+
+static void bin_flush_cb(const void * buf, uint32_t size)
+{
+    TEST_ASSERT_LESS_OR_EQUAL(sizeof(bin_buf), bin_size + size);
+    lv_memcpy(&bin_buf[bin_size], buf, size);
+    bin_size += size;
+}
+
+void test_profiler_binary(void)
+{
+    lv_profiler_builtin_config_t config;
+    lv_profiler_builtin_config_init(&config);
+    config.buf_size = 1024;
+    config.tick_per_sec = 1000;
+    config.tick_get_cb = get_tick_cb;
+    config.flush_bin_cb = bin_flush_cb;
+
+    bin_size = 0;
+    lv_profiler_builtin_init(&config);
+
+    /* header: magic, version, tick_per_sec */
+    TEST_ASSERT_EQUAL_UINT32(9, bin_size);
+    TEST_ASSERT_EQUAL_MEMORY("LVPF", bin_buf, 4);
+    TEST_ASSERT_EQUAL_UINT8(1, bin_buf[4]);
+    TEST_ASSERT_EQUAL_UINT8(1000 & 0xff, bin_buf[5]);
+    TEST_ASSERT_EQUAL_UINT8(1000 >> 8, bin_buf[6]);
+
+    profiler_tick = 0;
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        LV_PROFILER_BEGIN_TAG("tag");
+        LV_PROFILER_END_TAG("tag");
+    }
+    lv_profiler_builtin_flush();
+
+    /* thread: 'T', index, ID */
+    const uint8_t * p = &bin_buf[9];
+    TEST_ASSERT_EQUAL_UINT8('T', p[0]);
+    TEST_ASSERT_EQUAL_UINT8(0, p[1]);
+    TEST_ASSERT_EQUAL_UINT8(1, p[2]);
+    p += 6;
+
+    /* the name is written only once: 'S', ID, length, name */
+    TEST_ASSERT_EQUAL_UINT8('S', p[0]);
+    TEST_ASSERT_EQUAL_UINT8(0, p[1]);
+    TEST_ASSERT_EQUAL_UINT8(3, p[2]);
+    TEST_ASSERT_EQUAL_MEMORY("tag", &p[3], 3);
+    p += 6;
+
+    /* events: tag, thread index, CPU, string ID, tick delta */
+    for(i = 0; i < 6; i++) {
+        TEST_ASSERT_EQUAL_UINT8(i % 2 ? 'E' : 'B', p[0]);
+        TEST_ASSERT_EQUAL_UINT8(0, p[1]);
+        TEST_ASSERT_EQUAL_UINT8(0, p[3]);
+        TEST_ASSERT_EQUAL_UINT8(i == 0 ? 0 : 1, p[4]);
+        p += 5;
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(bin_size, p - bin_buf);
+}
+
+#if LV_USE_OS == LV_OS_PTHREAD
+
+#define THREAD_CNT 4
+#define THREAD_EVENT_CNT 200
+
+static __thread int thread_id;
+
+static int get_tid_cb(void)
+{
+    return thread_id;
+}
+
+static void thread_cb(void * user_data)
+{
+    thread_id = (int)(lv_uintptr_t)user_data;
+
+    uint32_t i;
+    for(i = 0; i < THREAD_EVENT_CNT; i++) {
+        LV_PROFILER_BEGIN_TAG("thread");
+        LV_PROFILER_END_TAG("thread");
+    }
+}
+
+void test_profiler_threads(void)
+{
+    lv_profiler_builtin_config_t config;
+    lv_profiler_builtin_config_init(&config);
+    config.buf_size = 32 * 1024;
+    config.tick_get_cb = get_tick_cb;
+    config.tid_get_cb = get_tid_cb;
+    config.flush_cb = count_flush_cb;
+    lv_profiler_builtin_init(&config);
+
+    flush_cnt = 0;
+    thread_id = 100;
+    LV_PROFILER_BEGIN;
+
+    /* every thread writes to its own buffer */
+    lv_thread_t threads[THREAD_CNT];
+    uint32_t i;
+    for(i = 0; i < THREAD_CNT; i++) {
+        lv_thread_init(&threads[i], "test", LV_THREAD_PRIO_MID, thread_cb, 16 * 1024, (void *)(lv_uintptr_t)(i + 1));
+    }
+    for(i = 0; i < THREAD_CNT; i++) {
+        lv_thread_delete(&threads[i]);
+    }
+
+    LV_PROFILER_END;
+    lv_profiler_builtin_flush();
+
+    TEST_ASSERT_EQUAL_UINT32(THREAD_CNT * THREAD_EVENT_CNT * 2 + 2, flush_cnt);
+}
+
+#else
+
+void test_profiler_threads(void)
+{
+}
+
+#endif /*LV_USE_OS == LV_OS_PTHREAD*/
+
+static uint32_t measure_overhead(bool enable)
+{
+    const uint32_t event_cnt = 1000;
+    const uint32_t rounds = 100;
+
+    lv_profiler_builtin_set_enable(enable);
+
+    clock_t sum = 0;
+    uint32_t r;
+    for(r = 0; r < rounds; r++) {
+        clock_t start = clock();
+        uint32_t i;
+        for(i = 0; i < event_cnt / 2; i++) {
+            LV_PROFILER_BEGIN;
+            LV_PROFILER_END;
+        }
+        sum += clock() - start;
+
+        /* flushing is not part of the overhead of the events */
+        lv_profiler_builtin_flush();
+    }
+
+    return (uint32_t)((uint64_t)sum * 1000000000 / CLOCKS_PER_SEC / (rounds * event_cnt));
+}
+
+void test_profiler_overhead(void)
+{
+    lv_profiler_builtin_config_t config;
+    lv_profiler_builtin_config_init(&config);
+    config.buf_size = 64 * 1024;
+    config.tick_get_cb = get_tick_cb;
+    config.flush_cb = count_flush_cb;
+
+    /* with the default tid_get_cb the threads can't be told apart, so writing is locked */
+    lv_profiler_builtin_init(&config);
+    uint32_t disabled_ns = measure_overhead(false);
+    uint32_t shared_ns = measure_overhead(true);
+
+#if LV_USE_OS == LV_OS_PTHREAD
+    config.tid_get_cb = get_tid_cb;
+    lv_profiler_builtin_init(&config);
+#endif
+    uint32_t per_thread_ns = measure_overhead(true);
+
+    char buf[160];
+    lv_snprintf(buf, sizeof(buf),
+                "profiler overhead per event: %" LV_PRIu32 " ns with per-thread buffers, %" LV_PRIu32
+                " ns with a shared buffer (%" LV_PRIu32 " ns when disabled)",
+                per_thread_ns, shared_ns, disabled_ns);
+    TEST_PRINTF("%s", buf);
+
+    /* very loose limit to catch formatting or flushing on the hot path even in slow debug builds */
+    TEST_ASSERT_LESS_THAN_UINT32(2000, per_thread_ns);
+}
+
 #endif
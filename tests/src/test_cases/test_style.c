@@ -4,6 +4,7 @@
 
 #include "unity/unity.h"
 #include <unistd.h>
+#include <time.h>
 
 static void obj_set_height_helper(void * obj, int32_t height)
 {
@@ -141,4 +142,180 @@ void test_style_has_prop(void)
     lv_style_reset(&style);
 }
 
+void test_style_value_change_is_reported(void)
+{
+    static lv_style_t style;
+    lv_style_init(&style);
+    lv_style_set_bg_color(&style, lv_color_hex(0xff0000));
+
+    lv_obj_t * parent = lv_obj_create(NULL);
+    lv_obj_t * obj = lv_obj_create(parent);
+    lv_obj_add_style(obj, &style, LV_PART_MAIN);
+    lv_obj_add_style(obj, &style, LV_PART_SCROLLBAR | LV_STATE_PRESSED);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0xff0000), lv_obj_get_style_bg_color(obj, LV_PART_MAIN));
+
+    /*Changing the style*/
+    lv_style_set_bg_color(&style, lv_color_hex(0x00ff00));
+    lv_obj_report_style_change(&style);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x00ff00), lv_obj_get_style_bg_color(obj, LV_PART_MAIN));
+
+    /*Adding a new property to the style*/
+    TEST_ASSERT_EQUAL(0, lv_obj_get_style_border_width(obj, LV_PART_SCROLLBAR));
+    lv_style_set_border_width(&style, 5);
+    lv_obj_report_style_change(&style);
+    TEST_ASSERT_EQUAL(0, lv_obj_get_style_border_width(obj, LV_PART_SCROLLBAR));
+    lv_obj_add_state(obj, LV_STATE_PRESSED);
+    TEST_ASSERT_EQUAL(5, lv_obj_get_style_border_width(obj, LV_PART_SCROLLBAR));
+    lv_obj_remove_state(obj, LV_STATE_PRESSED);
+    TEST_ASSERT_EQUAL(0, lv_obj_get_style_border_width(obj, LV_PART_SCROLLBAR));
+
+    /*Local styles override it*/
+    lv_obj_set_style_bg_color(obj, lv_color_hex(0x0000ff), 0);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x0000ff), lv_obj_get_style_bg_color(obj, LV_PART_MAIN));
+    lv_obj_remove_local_style_prop(obj, LV_STYLE_BG_COLOR, 0);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x00ff00), lv_obj_get_style_bg_color(obj, LV_PART_MAIN));
+
+    lv_obj_remove_style_all(obj);
+    TEST_ASSERT_EQUAL_COLOR(lv_style_prop_get_default(LV_STYLE_BG_COLOR).color,
+                            lv_obj_get_style_bg_color(obj, LV_PART_MAIN));
+
+    /*Inherited properties follow the parent*/
+    lv_obj_set_style_text_color(parent, lv_color_hex(0x112233), 0);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x112233), lv_obj_get_style_text_color(obj, LV_PART_MAIN));
+    lv_obj_set_style_text_color(parent, lv_color_hex(0x445566), 0);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x445566), lv_obj_get_style_text_color(obj, LV_PART_MAIN));
+
+    lv_obj_delete(parent);
+    lv_style_reset(&style);
+}
+
+void test_style_get_prop_benchmark(void)
+{
+    /*Read the properties typically used when drawing a button*/
+    static const lv_style_prop_t props[] = {
+        LV_STYLE_BG_COLOR, LV_STYLE_BG_OPA, LV_STYLE_BG_GRAD_DIR, LV_STYLE_BG_IMAGE_SRC,
+        LV_STYLE_RADIUS, LV_STYLE_BORDER_WIDTH, LV_STYLE_BORDER_COLOR, LV_STYLE_BORDER_OPA,
+        LV_STYLE_OUTLINE_WIDTH, LV_STYLE_SHADOW_WIDTH, LV_STYLE_SHADOW_COLOR, LV_STYLE_SHADOW_OFFSET_Y,
+        LV_STYLE_PAD_TOP, LV_STYLE_PAD_LEFT, LV_STYLE_OPA, LV_STYLE_TEXT_COLOR,
+        LV_STYLE_TEXT_FONT, LV_STYLE_TRANSFORM_ROTATION, LV_STYLE_BLEND_MODE, LV_STYLE_COLOR_FILTER_DSC,
+    };
+
+    lv_obj_t * scr = lv_obj_create(NULL);
+    lv_obj_t * btns[20];
+    uint32_t i;
+    for(i = 0; i < 20; i++) {
+        btns[i] = lv_button_create(scr);
+        if(i % 2) lv_obj_add_state(btns[i], LV_STATE_PRESSED);
+        lv_obj_set_style_bg_color(btns[i], lv_color_hex(0x123456), LV_STATE_FOCUSED);
+    }
+
+    const uint32_t round_cnt = 1000;
+    uint32_t round;
+    uint32_t sum = 0;
+    clock_t start = clock();
+    for(round = 0; round < round_cnt; round++) {
+        for(i = 0; i < 20; i++) {
+            uint32_t p;
+            for(p = 0; p < sizeof(props) / sizeof(props[0]); p++) {
+                sum += lv_obj_get_style_prop(btns[i], LV_PART_MAIN, props[p]).num;
+            }
+        }
+    }
+    clock_t end = clock();
+    TEST_ASSERT_NOT_EQUAL(0, sum);
+
+    uint32_t lookup_cnt = round_cnt * 20 * (sizeof(props) / sizeof(props[0]));
+    uint32_t ns = (uint32_t)((uint64_t)(end - start) * 1000000000 / CLOCKS_PER_SEC / lookup_cnt);
+    char buf[128];
+    lv_snprintf(buf, sizeof(buf), "%" LV_PRIu32 " style lookups, %" LV_PRIu32 " ns/lookup (value cache: %s)",
+                lookup_cnt, ns, (LV_OBJ_STYLE_CACHE && LV_OBJ_STYLE_VALUE_CACHE_CNT) ? "on" : "off");
+    TEST_PRINTF("%s", buf);
+
+    lv_obj_delete(scr);
+}
+
+void test_style_many_props(void)
+{
+    lv_style_t style;
+    lv_style_init(&style);
+
+    /*Set the properties in a mixed order and overwrite some of them*/
+    uint32_t i;
+    for(i = 0; i < 60; i++) {
+        lv_style_prop_t prop = (lv_style_prop_t)(1 + (i * 37) % 60);
+        lv_style_value_t v = {.num = prop};
+        lv_style_set_prop(&style, prop, v);
+    }
+    for(i = 1; i <= 60; i += 3) {
+        lv_style_value_t v = {.num = 1000 + i};
+        lv_style_set_prop(&style, (lv_style_prop_t)i, v);
+    }
+    TEST_ASSERT_EQUAL(60, style.prop_cnt);
+
+    for(i = 1; i <= 60; i += 5) {
+        TEST_ASSERT_TRUE(lv_style_remove_prop(&style, (lv_style_prop_t)i));
+    }
+    TEST_ASSERT_FALSE(lv_style_remove_prop(&style, 1));
+    TEST_ASSERT_EQUAL(48, style.prop_cnt);
+
+    for(i = 1; i <= 61; i++) {
+        lv_style_value_t v = {.num = -1};
+        lv_style_res_t res = lv_style_get_prop(&style, (lv_style_prop_t)i, &v);
+        if(i == 61 || (i - 1) % 5 == 0) {
+            TEST_ASSERT_EQUAL(LV_STYLE_RES_NOT_FOUND, res);
+            TEST_ASSERT_EQUAL(-1, v.num);
+        }
+        else {
+            TEST_ASSERT_EQUAL(LV_STYLE_RES_FOUND, res);
+            TEST_ASSERT_EQUAL((i - 1) % 3 == 0 ? 1000 + i : i, v.num);
+        }
+    }
+
+    lv_style_reset(&style);
+}
+
+void test_style_get_prop_many_props_benchmark(void)
+{
+    /*A theme-like style with built-in and custom properties*/
+    lv_style_t style;
+    lv_style_init(&style);
+
+    lv_style_prop_t props[48];
+    uint32_t i;
+    for(i = 0; i < 32; i++) {
+        props[i] = (lv_style_prop_t)(1 + i * 3);
+    }
+    for(; i < 48; i++) {
+        props[i] = lv_style_register_prop(0);
+    }
+    for(i = 0; i < 48; i++) {
+        lv_style_value_t v = {.num = i + 1};
+        lv_style_set_prop(&style, props[i], v);
+    }
+
+    const uint32_t round_cnt = 20000;
+    uint32_t round;
+    int32_t sum = 0;
+    clock_t start = clock();
+    for(round = 0; round < round_cnt; round++) {
+        for(i = 0; i < 48; i++) {
+            lv_style_value_t v;
+            /*Look for a set and an unset property*/
+            if(lv_style_get_prop(&style, props[i], &v) == LV_STYLE_RES_FOUND) sum += v.num;
+            if(lv_style_get_prop(&style, props[i] + 1, &v) == LV_STYLE_RES_FOUND) sum += v.num;
+        }
+    }
+    clock_t end = clock();
+    TEST_ASSERT_NOT_EQUAL(0, sum);
+
+    uint32_t lookup_cnt = round_cnt * 48 * 2;
+    uint32_t ns = (uint32_t)((uint64_t)(end - start) * 1000000000 / CLOCKS_PER_SEC / lookup_cnt);
+    char buf[128];
+    lv_snprintf(buf, sizeof(buf), "%" LV_PRIu32 " lookups in a 48 property style, %" LV_PRIu32
+                " ns/lookup (sorted props: %s)", lookup_cnt, ns, LV_STYLE_SORTED_PROPS ? "on" : "off");
+    TEST_PRINTF("%s", buf);
+
+    lv_style_reset(&style);
+}
+
 #endif
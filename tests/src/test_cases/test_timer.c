@@ -0,0 +1,224 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#include <time.h>
+
+static uint32_t call_cnt[8];
+static uint32_t order[16];
+static uint32_t order_cnt;
+
+void setUp(void)
+{
+    /* Function run before every test */
+    lv_memzero(call_cnt, sizeof(call_cnt));
+    order_cnt = 0;
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+}
+
+static void timer_cb(lv_timer_t * t)
+{
+    uint32_t id = (uint32_t)(lv_uintptr_t)lv_timer_get_user_data(t);
+    call_cnt[id]++;
+    if(order_cnt < 16) order[order_cnt++] = id;
+}
+
+static void run(uint32_t ms)
+{
+    lv_tick_inc(ms);
+    lv_timer_handler();
+}
+
+void test_timer_period(void)
+{
+    lv_timer_t * t = lv_timer_create(timer_cb, 100, (void *)0);
+
+    run(50);
+    TEST_ASSERT_EQUAL(0, call_cnt[0]);
+    run(50);
+    TEST_ASSERT_EQUAL(1, call_cnt[0]);
+    run(99);
+    TEST_ASSERT_EQUAL(1, call_cnt[0]);
+    run(1);
+    TEST_ASSERT_EQUAL(2, call_cnt[0]);
+
+    /*Shorter period takes effect immediately*/
+    lv_timer_set_period(t, 10);
+    run(10);
+    TEST_ASSERT_EQUAL(3, call_cnt[0]);
+
+    lv_timer_delete(t);
+    run(100);
+    TEST_ASSERT_EQUAL(3, call_cnt[0]);
+}
+
+void test_timer_pause_resume_ready_reset(void)
+{
+    lv_timer_t * t = lv_timer_create(timer_cb, 100, (void *)0);
+
+    lv_timer_pause(t);
+    run(200);
+    TEST_ASSERT_EQUAL(0, call_cnt[0]);
+    TEST_ASSERT_TRUE(lv_timer_get_paused(t));
+
+    /*It's overdue so runs immediately*/
+    lv_timer_resume(t);
+    run(0);
+    TEST_ASSERT_EQUAL(1, call_cnt[0]);
+
+    lv_timer_ready(t);
+    run(0);
+    TEST_ASSERT_EQUAL(2, call_cnt[0]);
+
+    run(60);
+    lv_timer_reset(t);
+    run(60);
+    TEST_ASSERT_EQUAL(2, call_cnt[0]);
+    run(40);
+    TEST_ASSERT_EQUAL(3, call_cnt[0]);
+
+    lv_timer_delete(t);
+}
+
+void test_timer_repeat_count(void)
+{
+    lv_timer_t * t1 = lv_timer_create(timer_cb, 10, (void *)0);
+    lv_timer_set_repeat_count(t1, 2);
+
+    lv_timer_t * t2 = lv_timer_create(timer_cb, 10, (void *)1);
+    lv_timer_set_repeat_count(t2, 1);
+    lv_timer_set_auto_delete(t2, false);
+
+    uint32_t i;
+    for(i = 0; i < 5; i++) run(10);
+
+    TEST_ASSERT_EQUAL(2, call_cnt[0]);
+    TEST_ASSERT_EQUAL(1, call_cnt[1]);
+
+    /*t1 is deleted, t2 is paused*/
+    TEST_ASSERT_TRUE(lv_timer_get_paused(t2));
+    lv_timer_t * t = NULL;
+    bool found1 = false;
+    while((t = lv_timer_get_next(t)) != NULL) {
+        if(t == t1) found1 = true;
+    }
+    TEST_ASSERT_FALSE(found1);
+
+    lv_timer_set_repeat_count(t2, 1);
+    lv_timer_resume(t2);
+    run(10);
+    TEST_ASSERT_EQUAL(2, call_cnt[1]);
+
+    lv_timer_delete(t2);
+}
+
+void test_timer_order_of_due_timers(void)
+{
+    /*The timers which are due at the same time run from the newest*/
+    lv_timer_t * t0 = lv_timer_create(timer_cb, 30, (void *)0);
+    lv_timer_t * t1 = lv_timer_create(timer_cb, 20, (void *)1);
+    lv_timer_t * t2 = lv_timer_create(timer_cb, 10, (void *)2);
+
+    run(30);
+    TEST_ASSERT_EQUAL(3, order_cnt);
+    TEST_ASSERT_EQUAL(2, order[0]);
+    TEST_ASSERT_EQUAL(1, order[1]);
+    TEST_ASSERT_EQUAL(0, order[2]);
+
+    lv_timer_delete(t0);
+    lv_timer_delete(t1);
+    lv_timer_delete(t2);
+}
+
+static lv_timer_t * victim;
+
+static void delete_other_cb(lv_timer_t * t)
+{
+    timer_cb(t);
+    if(victim) {
+        lv_timer_delete(victim);
+        victim = NULL;
+    }
+}
+
+static void create_cb(lv_timer_t * t)
+{
+    timer_cb(t);
+    lv_timer_t * t_new = lv_timer_create(timer_cb, 0, (void *)3);
+    lv_timer_set_repeat_count(t_new, 1);
+}
+
+void test_timer_create_and_delete_in_callback(void)
+{
+    /*`victim` would run after the deleting timer*/
+    victim = lv_timer_create(timer_cb, 10, (void *)0);
+    lv_timer_t * t1 = lv_timer_create(delete_other_cb, 10, (void *)1);
+
+    run(10);
+    TEST_ASSERT_EQUAL(0, call_cnt[0]);
+    TEST_ASSERT_EQUAL(1, call_cnt[1]);
+
+    /*A timer created in a callback runs in the same call if it's ready*/
+    lv_timer_t * t2 = lv_timer_create(create_cb, 10, (void *)2);
+    lv_timer_set_repeat_count(t2, 1);
+    run(10);
+    TEST_ASSERT_EQUAL(1, call_cnt[2]);
+    TEST_ASSERT_EQUAL(1, call_cnt[3]);
+
+    lv_timer_delete(t1);
+}
+
+void test_timer_time_until_next(void)
+{
+    lv_timer_t * t1 = lv_timer_create(timer_cb, 1000, (void *)0);
+    lv_timer_t * t2 = lv_timer_create(timer_cb, 1500, (void *)1);
+
+    /*The other timers (display, indev, etc) are paused*/
+    lv_timer_t * t = NULL;
+    while((t = lv_timer_get_next(t)) != NULL) {
+        if(t != t1 && t != t2) lv_timer_pause(t);
+    }
+
+    lv_tick_inc(200);
+    TEST_ASSERT_EQUAL(800, lv_timer_handler());
+    lv_timer_pause(t1);
+    TEST_ASSERT_EQUAL(1300, lv_timer_handler());
+    lv_timer_pause(t2);
+    TEST_ASSERT_EQUAL(LV_NO_TIMER_READY, lv_timer_handler());
+
+    t = NULL;
+    while((t = lv_timer_get_next(t)) != NULL) {
+        if(t != t1 && t != t2) lv_timer_resume(t);
+    }
+
+    lv_timer_delete(t1);
+    lv_timer_delete(t2);
+}
+
+void test_timer_benchmark(void)
+{
+    /*Many timers but only a few of them are due*/
+    lv_timer_t * timers[500];
+    uint32_t i;
+    for(i = 0; i < 500; i++) {
+        timers[i] = lv_timer_create(timer_cb, 1000 + i * 100, (void *)4);
+    }
+
+    clock_t t = clock();
+    for(i = 0; i < 20000; i++) run(1);
+    t = clock() - t;
+    TEST_PRINTF("20000 lv_timer_handler() calls with 500 timers: %d ms", (int)(t * 1000 / CLOCKS_PER_SEC));
+
+    /*Each has run at least once*/
+    TEST_ASSERT_GREATER_OR_EQUAL(500, call_cnt[4]);
+
+    for(i = 0; i < 500; i++) lv_timer_delete(timers[i]);
+}
+
+#endif
@@ -3,6 +3,7 @@
 #include "../../lvgl_private.h"
 
 #include "unity/unity.h"
+#include <time.h>
 
 static lv_obj_t * active_screen = NULL;
 static lv_obj_t * chart = NULL;
@@ -193,4 +194,289 @@ void test_draw_task_hooking(void)
     TEST_ASSERT_EQUAL_SCREENSHOT("widgets/chart_bar_draw_hook.png");
 }
 
+static uint32_t line_task_cnt;
+static uint32_t vector_task_cnt;
+
+static void count_series_tasks_cb(lv_event_t * e)
+{
+    lv_draw_task_t * draw_task = lv_event_get_param(e);
+    lv_draw_dsc_base_t * base_dsc = draw_task->draw_dsc;
+    if(base_dsc->part != LV_PART_ITEMS) return;
+
+    if(draw_task->type == LV_DRAW_TASK_TYPE_LINE) line_task_cnt++;
+    else if(draw_task->type == LV_DRAW_TASK_TYPE_VECTOR) vector_task_cnt++;
+}
+
+static void fill_waveform(lv_chart_series_t * ser, uint32_t period, int32_t ofs)
+{
+    int32_t * y = lv_chart_get_y_array(chart, ser);
+    uint32_t point_cnt = lv_chart_get_point_count(chart);
+    uint32_t i;
+    for(i = 0; i < point_cnt; i++) {
+        /*A sine with a spike in every period*/
+        int32_t v = lv_trigo_sin((int16_t)((i * 360 / period) % 360)) / 1200 + ofs;
+        if(i % period == period / 4) v += 30;
+        y[i] = v;
+    }
+    lv_chart_refresh(chart);
+}
+
+static lv_chart_series_t * create_decimated_chart(uint32_t point_cnt)
+{
+    lv_obj_set_size(chart, 400, 200);
+    lv_obj_set_style_pad_all(chart, 0, 0);
+    lv_obj_set_style_border_width(chart, 0, 0);
+    lv_obj_center(chart);
+    lv_chart_set_point_count(chart, point_cnt);
+    lv_chart_set_decimation(chart, LV_CHART_DECIMATION_MINMAX);
+    lv_obj_add_flag(chart, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS);
+    lv_obj_add_event_cb(chart, count_series_tasks_cb, LV_EVENT_DRAW_TASK_ADDED, NULL);
+
+    return lv_chart_add_series(chart, red_color, LV_CHART_AXIS_PRIMARY_Y);
+}
+
+void test_chart_decimation(void)
+{
+    lv_chart_series_t * ser1 = create_decimated_chart(10000);
+    lv_chart_series_t * ser2 = lv_chart_add_series(chart, lv_palette_main(LV_PALETTE_BLUE), LV_CHART_AXIS_PRIMARY_Y);
+    fill_waveform(ser1, 2500, 30);
+    fill_waveform(ser2, 5000, 70);
+
+    line_task_cnt = 0;
+    vector_task_cnt = 0;
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/chart_decimation.png");
+
+    /*Only the pixel columns are drawn, not the points*/
+#if LV_USE_VECTOR_GRAPHIC
+    TEST_ASSERT_EQUAL_UINT32(2, vector_task_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, line_task_cnt);
+#else
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(2 * 2 * 401, line_task_cnt);
+#endif
+
+    /*With fewer points than pixels the points are drawn as usual*/
+    lv_chart_set_point_count(chart, 100);
+    TEST_ASSERT_EQUAL(LV_CHART_DECIMATION_MINMAX, lv_chart_get_decimation(chart));
+    line_task_cnt = 0;
+    vector_task_cnt = 0;
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(0, vector_task_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2 * 99, line_task_cnt);
+}
+
+static uint32_t get_invalidated_width(void)
+{
+    lv_display_t * disp = lv_display_get_default();
+    uint32_t w = 0;
+    uint32_t i;
+    for(i = 0; i < disp->inv_p; i++) {
+        if(disp->inv_area_joined[i]) continue;
+        w += lv_area_get_width(&disp->inv_areas[i]);
+    }
+    return w;
+}
+
+void test_chart_decimation_shift_invalidates_only_the_edges(void)
+{
+    /*25 points in a column*/
+    lv_chart_series_t * ser = create_decimated_chart(10000);
+    fill_waveform(ser, 1000, 50);
+    lv_refr_now(NULL);
+
+    /*The last column is complete so the first value starts a new one and everything is scrolled*/
+    lv_chart_set_next_value(chart, ser, 100);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(400, get_invalidated_width());
+    lv_refr_now(NULL);
+
+    uint32_t i;
+    for(i = 1; i < 25; i++) {
+        lv_chart_set_next_value(chart, ser, 50 + i);
+        TEST_ASSERT_LESS_THAN_UINT32(100, get_invalidated_width());
+        lv_refr_now(NULL);
+    }
+
+    /*The 26th value starts a new column again*/
+    lv_chart_set_next_value(chart, ser, 100);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(400, get_invalidated_width());
+    lv_refr_now(NULL);
+
+    /*Without decimation every new value scrolls the whole chart*/
+    lv_chart_set_decimation(chart, LV_CHART_DECIMATION_NONE);
+    lv_refr_now(NULL);
+    lv_chart_set_next_value(chart, ser, 50);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(400, get_invalidated_width());
+}
+
+void test_chart_decimation_benchmark(void)
+{
+    lv_chart_series_t * ser = create_decimated_chart(1000);
+    const uint32_t point_cnts[] = {1000, 10000, 100000};
+    const uint32_t refr_cnt = 5;
+
+    uint32_t i;
+    for(i = 0; i < sizeof(point_cnts) / sizeof(point_cnts[0]); i++) {
+        lv_chart_set_point_count(chart, point_cnts[i]);
+        fill_waveform(ser, point_cnts[i] / 4, 50);
+
+        uint32_t us[2];
+        uint32_t task_cnt[2];
+        uint32_t d;
+        for(d = 0; d < 2; d++) {
+            lv_chart_set_decimation(chart, d == 0 ? LV_CHART_DECIMATION_NONE : LV_CHART_DECIMATION_MINMAX);
+            lv_refr_now(NULL);
+
+            line_task_cnt = 0;
+            vector_task_cnt = 0;
+            clock_t start = clock();
+            uint32_t r;
+            for(r = 0; r < refr_cnt; r++) {
+                lv_obj_invalidate(chart);
+                lv_refr_now(NULL);
+            }
+            us[d] = (uint32_t)((uint64_t)(clock() - start) * 1000000 / CLOCKS_PER_SEC / refr_cnt);
+            task_cnt[d] = (line_task_cnt + vector_task_cnt) / refr_cnt;
+        }
+
+        char buf[160];
+        lv_snprintf(buf, sizeof(buf), "%" LV_PRIu32 " points: %" LV_PRIu32 " us (%" LV_PRIu32 " tasks), "
+                    "decimated %" LV_PRIu32 " us (%" LV_PRIu32 " tasks)",
+                    point_cnts[i], us[0], task_cnt[0], us[1], task_cnt[1]);
+        TEST_PRINTF("%s", buf);
+    }
+}
+
+static void check_streaming_cache(lv_chart_series_t * ser, uint32_t append_cnt)
+{
+    lv_chart_set_streaming(chart, true);
+    TEST_ASSERT_TRUE(lv_chart_get_streaming(chart));
+    lv_refr_now(NULL);
+
+    uint32_t i;
+    for(i = 0; i < append_cnt; i++) {
+        lv_chart_set_next_value(chart, ser, (i * 7) % 100);
+        lv_refr_now(NULL);
+    }
+    TEST_ASSERT_NOT_NULL(ser->cache);
+    TEST_ASSERT_TRUE(ser->cache_valid);
+
+    /*A chart with the same values rendered in one go*/
+    lv_obj_t * ref_chart = lv_chart_create(active_screen);
+    lv_obj_set_size(ref_chart, lv_obj_get_width(chart), lv_obj_get_height(chart));
+    lv_obj_set_style_pad_all(ref_chart, 0, 0);
+    lv_obj_set_style_border_width(ref_chart, 0, 0);
+    lv_obj_add_flag(ref_chart, LV_OBJ_FLAG_HIDDEN);
+    lv_chart_set_point_count(ref_chart, lv_chart_get_point_count(chart));
+    lv_chart_set_decimation(ref_chart, lv_chart_get_decimation(chart));
+    lv_chart_set_streaming(ref_chart, true);
+    lv_chart_series_t * ref_ser = lv_chart_add_series(ref_chart, red_color, LV_CHART_AXIS_PRIMARY_Y);
+    lv_memcpy(ref_ser->y_points, ser->y_points, lv_chart_get_point_count(chart) * sizeof(int32_t));
+    ref_ser->start_point = ser->start_point;
+    ref_ser->shift_cnt = ser->shift_cnt;
+    lv_obj_update_layout(ref_chart);
+
+    /*The last value is added to both, the scrolled and the fully rendered cache should be the same.
+     *The anti-aliasing of the line endings depends slightly on the clip area so allow a few different pixels.*/
+    lv_chart_set_next_value(chart, ser, 42);
+    lv_chart_set_next_value(ref_chart, ref_ser, 42);
+    TEST_ASSERT_TRUE(ref_ser->cache_valid);
+
+    uint32_t diff_cnt = 0;
+    uint32_t x;
+    uint32_t y;
+    for(y = 0; y < ser->cache->header.h; y++) {
+        lv_color32_t * px = (lv_color32_t *)(ser->cache->data + y * ser->cache->header.stride);
+        lv_color32_t * ref_px = (lv_color32_t *)(ref_ser->cache->data + y * ref_ser->cache->header.stride);
+        for(x = 0; x < ser->cache->header.w; x++) {
+            if(px[x].alpha == 0 && ref_px[x].alpha == 0) continue;
+            if(!lv_color32_eq(px[x], ref_px[x])) diff_cnt++;
+        }
+    }
+    TEST_ASSERT_LESS_THAN_UINT32(20, diff_cnt);
+
+    lv_obj_delete(ref_chart);
+}
+
+void test_chart_streaming_scrolls_the_cache(void)
+{
+    /*Points are 4 px apart*/
+    lv_chart_series_t * ser = create_decimated_chart(101);
+    fill_waveform(ser, 25, 50);
+    check_streaming_cache(ser, 60);
+
+    /*A decimated column is 1 px wide*/
+    lv_chart_set_point_count(chart, 4000);
+    fill_waveform(ser, 1000, 50);
+    check_streaming_cache(ser, 60);
+}
+
+void test_chart_streaming(void)
+{
+    lv_chart_series_t * ser1 = create_decimated_chart(101);
+    lv_chart_series_t * ser2 = lv_chart_add_series(chart, lv_palette_main(LV_PALETTE_BLUE), LV_CHART_AXIS_PRIMARY_Y);
+    fill_waveform(ser1, 25, 30);
+    fill_waveform(ser2, 50, 70);
+    lv_chart_set_streaming(chart, true);
+    lv_refr_now(NULL);
+
+    uint32_t i;
+    for(i = 0; i < 30; i++) {
+        lv_chart_set_next_value(chart, ser1, 30 + (i % 5) * 5);
+        lv_chart_set_next_value(chart, ser2, 70 - (i % 5) * 5);
+        lv_refr_now(NULL);
+    }
+
+    /*Only the edges are rendered again and the chart draws only the cached images*/
+    line_task_cnt = 0;
+    lv_chart_set_next_value(chart, ser1, 50);
+    TEST_ASSERT_LESS_THAN_UINT32(20, line_task_cnt);
+
+    line_task_cnt = 0;
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/chart_streaming.png");
+    TEST_ASSERT_EQUAL_UINT32(0, line_task_cnt);
+
+    /*Changing a point renders the series directly until the next value is added*/
+    lv_chart_set_value_by_id(chart, ser1, 10, 90);
+    TEST_ASSERT_FALSE(ser1->cache_valid);
+    lv_chart_set_next_value(chart, ser1, 50);
+    TEST_ASSERT_TRUE(ser1->cache_valid);
+
+    lv_chart_set_streaming(chart, false);
+    TEST_ASSERT_NULL(ser1->cache);
+    TEST_ASSERT_NULL(ser2->cache);
+}
+
+void test_chart_streaming_benchmark(void)
+{
+    lv_chart_series_t * ser = create_decimated_chart(101);
+    const uint32_t point_cnts[] = {101, 4000};
+    const uint32_t append_cnt = 20;
+
+    uint32_t i;
+    for(i = 0; i < sizeof(point_cnts) / sizeof(point_cnts[0]); i++) {
+        lv_chart_set_point_count(chart, point_cnts[i]);
+        fill_waveform(ser, point_cnts[i] / 4, 50);
+
+        uint32_t us[2];
+        uint32_t s;
+        for(s = 0; s < 2; s++) {
+            lv_chart_set_streaming(chart, s == 1);
+            lv_chart_set_next_value(chart, ser, 50);
+            lv_refr_now(NULL);
+
+            clock_t start = clock();
+            uint32_t a;
+            for(a = 0; a < append_cnt; a++) {
+                lv_chart_set_next_value(chart, ser, (a * 7) % 100);
+                lv_refr_now(NULL);
+            }
+            us[s] = (uint32_t)((uint64_t)(clock() - start) * 1000000 / CLOCKS_PER_SEC / append_cnt);
+        }
+
+        char buf[128];
+        lv_snprintf(buf, sizeof(buf), "%" LV_PRIu32 " points: %" LV_PRIu32 " us per value, streaming %" LV_PRIu32 " us",
+                    point_cnts[i], us[0], us[1]);
+        TEST_PRINTF("%s", buf);
+    }
+}
+
 #endif
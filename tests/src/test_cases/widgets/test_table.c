@@ -3,6 +3,7 @@
 #include "../../lvgl_private.h"
 
 #include "unity/unity.h"
+#include <time.h>
 
 static lv_obj_t * scr = NULL;
 static lv_obj_t * table = NULL;
@@ -313,4 +314,176 @@ void test_table_cell_select_should_not_allow_set_on_table_with_no_rows(void)
     TEST_ASSERT_EQUAL_UINT32(LV_TABLE_CELL_NONE, selected_column);
 }
 
+void test_table_virtualized_should_measure_only_visible_rows(void)
+{
+    lv_obj_set_size(table, LV_SIZE_CONTENT, 200);
+    lv_table_set_virtualized(table, true);
+
+    uint32_t i;
+    for(i = 0; i < 1000; i++) {
+        lv_table_set_cell_value_fmt(table, i, 0, "%" LV_PRIu32, i);
+    }
+    lv_obj_update_layout(table);
+
+    lv_table_t * table_ptr = (lv_table_t *)table;
+    int32_t row_h = table_ptr->row_h[0];
+
+    lv_table_set_column_count(table, 3);
+    lv_table_set_cell_value(table, 0, 2, "a\nb\nc");
+    lv_table_set_cell_value(table, 950, 2, "a\nb\nc");
+
+    /*Only the visible row is measured when its value is set*/
+    TEST_ASSERT_GREATER_THAN(row_h, table_ptr->row_h[0]);
+    TEST_ASSERT_EQUAL_INT32(row_h, table_ptr->row_h[950]);
+
+    /*After changing the style only the visible rows are measured again*/
+    lv_obj_set_style_pad_top(table, 2, LV_PART_ITEMS);
+    lv_obj_set_style_pad_bottom(table, 2, LV_PART_ITEMS);
+    lv_obj_update_layout(table);
+    int32_t single_h = table_ptr->row_h[1];
+    TEST_ASSERT_LESS_THAN(row_h, single_h);
+    TEST_ASSERT_GREATER_THAN(single_h, table_ptr->row_h[0]);
+    TEST_ASSERT_EQUAL_INT32(row_h, table_ptr->row_h[950]);
+
+    /*The far rows are measured when they are scrolled in*/
+    int32_t h_sum = 0;
+    for(i = 0; i < 949; i++) h_sum += table_ptr->row_h[i];
+    lv_obj_scroll_to_y(table, h_sum, LV_ANIM_OFF);
+    TEST_ASSERT_EQUAL_INT32(single_h, table_ptr->row_h[949]);
+    TEST_ASSERT_EQUAL_INT32(table_ptr->row_h[0], table_ptr->row_h[950]);
+
+    h_sum = 0;
+    for(i = 0; i < 1000; i++) h_sum += table_ptr->row_h[i];
+    TEST_ASSERT_EQUAL_INT32(h_sum - 1, lv_obj_get_self_height(table));
+
+    /*The values are kept*/
+    TEST_ASSERT_EQUAL_STRING("950", lv_table_get_cell_value(table, 950, 0));
+    TEST_ASSERT_EQUAL_STRING("a\nb\nc", lv_table_get_cell_value(table, 950, 2));
+}
+
+void test_table_virtualized_should_select_the_last_row(void)
+{
+    lv_obj_set_size(table, 300, 200);
+    lv_table_set_virtualized(table, true);
+
+    uint32_t i;
+    for(i = 0; i < 500; i++) {
+        lv_table_set_cell_value_fmt(table, i, 0, "Row %" LV_PRIu32, i);
+    }
+    lv_obj_update_layout(table);
+
+    lv_table_set_selected_cell(table, 499, 0);
+    lv_test_wait(1000);
+
+    /*The last row is scrolled in*/
+    lv_table_t * table_ptr = (lv_table_t *)table;
+    TEST_ASSERT_EQUAL_UINT32(499, table_ptr->row_act);
+    TEST_ASSERT_LESS_THAN_INT32(table_ptr->row_h[499] / 2, lv_obj_get_scroll_bottom(table));
+}
+
+void test_table_virtualized_should_reuse_the_cell_memory(void)
+{
+    lv_table_set_virtualized(table, true);
+    lv_table_set_column_count(table, 4);
+
+    lv_table_t * table_ptr = (lv_table_t *)table;
+    uint32_t i;
+    for(i = 0; i < 100; i++) {
+        lv_table_set_cell_value_fmt(table, i, i % 4, "Cell %" LV_PRIu32, i);
+    }
+    lv_table_add_cell_ctrl(table, 5, 1, LV_TABLE_CELL_CTRL_MERGE_RIGHT);
+
+    /*Shorter texts are stored in place*/
+    uint32_t used = table_ptr->arena_used;
+    lv_table_set_cell_value(table, 5, 1, "x");
+    TEST_ASSERT_EQUAL_UINT32(used, table_ptr->arena_used);
+
+    /*Longer texts are allocated again and the old cells are compacted after a while*/
+    for(i = 0; i < 1000; i++) {
+        lv_table_set_cell_value_fmt(table, i % 100, i % 4, "A longer text in cell %" LV_PRIu32, i);
+    }
+    TEST_ASSERT_LESS_THAN_UINT32(4 * 4096, table_ptr->arena_used);
+    TEST_ASSERT_TRUE(lv_table_has_cell_ctrl(table, 5, 1, LV_TABLE_CELL_CTRL_MERGE_RIGHT));
+    TEST_ASSERT_EQUAL_STRING("A longer text in cell 905", lv_table_get_cell_value(table, 5, 1));
+
+    /*The cells are moved back to the heap*/
+    lv_table_set_virtualized(table, false);
+    TEST_ASSERT_NULL(table_ptr->arena);
+    TEST_ASSERT_EQUAL_STRING("A longer text in cell 999", lv_table_get_cell_value(table, 99, 3));
+    TEST_ASSERT_TRUE(lv_table_has_cell_ctrl(table, 5, 1, LV_TABLE_CELL_CTRL_MERGE_RIGHT));
+
+    lv_table_set_row_count(table, 10);
+    TEST_ASSERT_EQUAL_STRING("", lv_table_get_cell_value(table, 9, 0));
+}
+
+void test_table_virtualized(void)
+{
+    lv_obj_set_size(table, 400, 300);
+    lv_obj_center(table);
+    lv_table_set_virtualized(table, true);
+    lv_table_set_column_width(table, 0, 100);
+    lv_table_set_column_width(table, 1, 200);
+
+    uint32_t i;
+    for(i = 0; i < 1000; i++) {
+        lv_table_set_cell_value_fmt(table, i, 0, "%" LV_PRIu32, i);
+        if(i % 3 == 0) lv_table_set_cell_value_fmt(table, i, 1, "Row %" LV_PRIu32 "\nsecond line", i);
+        else lv_table_set_cell_value_fmt(table, i, 1, "Row %" LV_PRIu32, i);
+    }
+    lv_table_set_virtualized(table, false);
+    lv_table_set_virtualized(table, true);
+
+    lv_obj_update_layout(table);
+    lv_obj_scroll_to_y(table, 10000, LV_ANIM_OFF);
+
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/table_virtualized.png");
+}
+
+void test_table_virtualized_benchmark(void)
+{
+    const uint32_t row_cnt = 5000;
+    const uint32_t col_cnt = 8;
+    lv_obj_set_size(table, 600, 400);
+
+    uint32_t us[2][3];
+    uint32_t v;
+    for(v = 0; v < 2; v++) {
+        lv_obj_clean(scr);
+        table = lv_table_create(scr);
+        lv_obj_set_size(table, 600, 400);
+        lv_table_set_virtualized(table, v == 1);
+        lv_table_set_column_count(table, col_cnt);
+        lv_table_set_row_count(table, row_cnt);
+
+        clock_t start = clock();
+        uint32_t r, c;
+        for(r = 0; r < row_cnt; r++) {
+            for(c = 0; c < col_cnt; c++) {
+                lv_table_set_cell_value_fmt(table, r, c, "%" LV_PRIu32 ".%" LV_PRIu32, r, c);
+            }
+        }
+        lv_refr_now(NULL);
+        us[v][0] = (uint32_t)((uint64_t)(clock() - start) * 1000 / CLOCKS_PER_SEC);
+
+        start = clock();
+        lv_obj_set_style_pad_top(table, 4, LV_PART_ITEMS);
+        lv_refr_now(NULL);
+        us[v][1] = (uint32_t)((uint64_t)(clock() - start) * 1000000 / CLOCKS_PER_SEC);
+
+        start = clock();
+        for(r = 0; r < 20; r++) {
+            lv_obj_scroll_by(table, 0, -1000, LV_ANIM_OFF);
+            lv_refr_now(NULL);
+        }
+        us[v][2] = (uint32_t)((uint64_t)(clock() - start) * 1000000 / CLOCKS_PER_SEC / 20);
+    }
+
+    char buf[192];
+    lv_snprintf(buf, sizeof(buf),
+                "%" LV_PRIu32 "x%" LV_PRIu32 " table: fill %" LV_PRIu32 " ms, restyle %" LV_PRIu32 " us, scroll %" LV_PRIu32
+                " us; virtualized: fill %" LV_PRIu32 " ms, restyle %" LV_PRIu32 " us, scroll %" LV_PRIu32 " us",
+                row_cnt, col_cnt, us[0][0], us[0][1], us[0][2], us[1][0], us[1][1], us[1][2]);
+    TEST_PRINTF("%s", buf);
+}
+
 #endif
@@ -0,0 +1,300 @@
+
+#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
+#include "lvgl.h"
+#elif defined(LV_BUILD_TEST)
+#include "../lvgl.h"
+#else
+#include "lvgl/lvgl.h"
+#endif
+
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+#define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef LV_ATTRIBUTE_TEST_ARGB8888_LZ4_TILED
+#define LV_ATTRIBUTE_TEST_ARGB8888_LZ4_TILED
+#endif
+
+static const
+LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_TEST_ARGB8888_LZ4_TILED
+uint8_t test_ARGB8888_LZ4_tiled_map[] = {
+
+    0x10,0x00,0x10,0x00,0x40,0x00,0x00,0x00,0xa8,0x00,0x00,0x00,0xb2,0x04,0x00,0x00,
+    0xf3,0x00,0x00,0x00,0xa2,0x0c,0x00,0x00,0xbd,0x01,0x00,0x00,0xc2,0x0e,0x00,0x00,
+    0xa9,0x02,0x00,0x00,0xc2,0x0c,0x00,0x00,0x75,0x03,0x00,0x00,0x32,0x05,0x00,0x00,
+    0xc8,0x03,0x00,0x00,0x22,0x12,0x00,0x00,0xea,0x04,0x00,0x00,0xc2,0x0e,0x00,0x00,
+    0xd6,0x05,0x00,0x00,0x42,0x0a,0x00,0x00,0x7a,0x06,0x00,0x00,0x42,0x05,0x00,0x00,
+    0xce,0x06,0x00,0x00,0x92,0x06,0x00,0x00,0x37,0x07,0x00,0x00,0x32,0x18,0x00,0x00,
+    0xba,0x08,0x00,0x00,0x42,0x17,0x00,0x00,0x2e,0x0a,0x00,0x00,0xa2,0x16,0x00,0x00,
+    0x98,0x0b,0x00,0x00,0x52,0x10,0x00,0x00,0x9d,0x0c,0x00,0x00,0xb2,0x04,0x00,0x00,
+    0xe8,0x0c,0x00,0x00,0x22,0x0f,0x00,0x00,0xda,0x0d,0x00,0x00,0x92,0x0d,0x00,0x00,
+    0xb3,0x0e,0x00,0x00,0x52,0x0a,0x00,0x00,0x58,0x0f,0x00,0x00,0x82,0x0c,0x00,0x00,
+    0x20,0x10,0x00,0x00,0x02,0x06,0x00,0x00,0x2f,0x00,0xff,0x02,0x00,0x30,0x0f,0x01,
+    0x00,0x29,0x00,0x80,0x00,0x0f,0x3f,0x00,0x28,0x01,0xbe,0x00,0x06,0x40,0x00,0x00,
+    0x0c,0x00,0x0f,0x04,0x00,0x06,0x0f,0x01,0x00,0x01,0x0f,0x40,0x00,0xff,0xba,0x0f,
+    0xdf,0x01,0x00,0x09,0x02,0x00,0x01,0x2e,0x02,0x0c,0x20,0x02,0x00,0x02,0x00,0x03,
+    0x40,0x02,0x09,0x2d,0x00,0x0f,0x02,0x00,0x00,0x0f,0x40,0x00,0xbc,0x50,0xff,0x00,
+    0x00,0x00,0xff,0x2f,0x00,0xff,0x02,0x00,0x2c,0x0f,0x01,0x00,0x6c,0x17,0xff,0x01,
+    0x00,0x0f,0x8a,0x00,0x21,0x07,0x3f,0x00,0x0f,0xcc,0x00,0x0a,0xf3,0x01,0xff,0x00,
+    0x00,0x3f,0xff,0x00,0x00,0x96,0xff,0x00,0x00,0xd6,0xff,0x00,0x00,0xf9,0x04,0x00,
+    0x1f,0xd6,0x40,0x00,0x0d,0x90,0xff,0x00,0x00,0x1a,0xff,0x00,0x00,0x93,0xff,0x6b,
+    0x00,0x0f,0x04,0x00,0x01,0x07,0x02,0x00,0x0c,0xc0,0x00,0x03,0x3c,0x00,0x1f,0xa7,
+    0x3c,0x00,0x06,0x00,0x50,0x00,0x07,0x02,0x00,0x0f,0x40,0x00,0x00,0x0f,0x78,0x00,
+    0x07,0x00,0x3c,0x00,0x00,0x04,0x00,0x07,0x02,0x00,0x08,0x40,0x00,0x03,0xf0,0x00,
+    0x00,0x15,0x00,0x0f,0x04,0x00,0x0b,0x07,0x02,0x00,0x0b,0x40,0x00,0x00,0x2c,0x01,
+    0x00,0x15,0x00,0x0f,0x04,0x00,0x0b,0x07,0x02,0x00,0x0b,0x40,0x00,0x00,0x68,0x01,
+    0x00,0x15,0x00,0x0f,0x04,0x00,0x0a,0x02,0xab,0x00,0x05,0x08,0x00,0x05,0x02,0x00,
+    0x03,0xa0,0x01,0x0f,0x3c,0x00,0x0a,0x00,0x58,0x01,0x07,0x3c,0x00,0x09,0x00,0x02,
+    0x0f,0x40,0x00,0x30,0x0f,0xc0,0x00,0x2d,0x0f,0x40,0x01,0x12,0x0f,0xc0,0x00,0x08,
+    0x00,0xb0,0x02,0x0f,0x00,0x01,0x09,0x50,0xff,0xff,0x00,0x00,0xff,0x2f,0x00,0xff,
+    0x02,0x00,0x2c,0x0f,0x01,0x00,0xac,0x8f,0xff,0x00,0x00,0x96,0xff,0x00,0x00,0x3f,
+    0xc6,0x00,0x25,0x43,0xff,0x00,0x00,0xff,0x04,0x00,0x5f,0x93,0xff,0x00,0x00,0x1a,
+    0x48,0x00,0x05,0x83,0xff,0x00,0x00,0x6a,0xff,0x00,0x00,0xdf,0x04,0x00,0x14,0x6a,
+    0x28,0x00,0x03,0x3c,0x00,0x04,0x44,0x00,0x1f,0xa7,0x44,0x00,0x05,0x03,0x38,0x00,
+    0x04,0x28,0x00,0x1f,0xdf,0x40,0x00,0x04,0x00,0x20,0x00,0x14,0x93,0x1c,0x00,0x08,
+    0x02,0x00,0x0f,0x40,0x00,0x18,0x00,0x44,0x00,0x0d,0x10,0x01,0x0f,0xc0,0x00,0x14,
+    0x00,0x3c,0x00,0x00,0x04,0x00,0x18,0x96,0x7c,0x00,0x0f,0x02,0x00,0x09,0x0b,0x00,
+    0x01,0x00,0x3c,0x00,0x00,0x04,0x00,0x1f,0xd6,0x34,0x00,0x09,0x08,0x02,0x00,0x0f,
+    0x40,0x00,0x04,0x1b,0xf9,0x24,0x00,0x93,0x40,0xff,0x00,0x00,0xac,0xff,0x00,0x00,
+    0xf2,0x04,0x00,0x00,0x0c,0x00,0x10,0x40,0x24,0x00,0x0f,0x40,0x00,0x0d,0x03,0x3c,
+    0x00,0x1f,0xd3,0x28,0x00,0x00,0x00,0x14,0x00,0x00,0x58,0x00,0x00,0xb0,0x00,0x0c,
+    0x04,0x00,0x05,0xc0,0x00,0x03,0x78,0x00,0x0c,0x20,0x00,0x04,0x10,0x00,0x00,0x88,
+    0x00,0x04,0x0c,0x00,0x08,0x08,0x00,0x05,0x40,0x01,0x03,0xb0,0x00,0x08,0x1c,0x00,
+    0x08,0x0c,0x00,0x00,0xd0,0x00,0x08,0x10,0x00,0x04,0x0c,0x00,0x05,0xc0,0x01,0x0f,
+    0x40,0x00,0x08,0x50,0xff,0xff,0x00,0x00,0xf2,0x2f,0x00,0xff,0x02,0x00,0x2c,0x0f,
+    0x01,0x00,0x7a,0x2f,0xff,0xff,0x04,0x00,0x1f,0x08,0x02,0x00,0x00,0x40,0x00,0x0f,
+    0x02,0x00,0x29,0x04,0x40,0x00,0x00,0x08,0x00,0x0f,0x04,0x00,0x15,0x08,0x02,0x00,
+    0x00,0x34,0x00,0x00,0x02,0x00,0x04,0x08,0x00,0x0f,0x02,0x00,0x1d,0x04,0x38,0x00,
+    0x08,0x08,0x00,0x00,0x0c,0x00,0x0f,0x04,0x00,0x09,0x08,0x02,0x00,0x00,0x28,0x00,
+    0x00,0x02,0x00,0x0c,0x08,0x00,0x0f,0x02,0x00,0x05,0x04,0x28,0x00,0x04,0x02,0x00,
+    0x04,0x10,0x00,0x0f,0x08,0x00,0x01,0x00,0x14,0x00,0x08,0x04,0x00,0x00,0x02,0x00,
+    0x00,0x10,0x00,0x08,0x02,0x00,0x04,0x10,0x00,0x0f,0x08,0x00,0x05,0x04,0x02,0x00,
+    0x0c,0x20,0x00,0x04,0x02,0x00,0x0c,0x18,0x00,0x0f,0x10,0x00,0x15,0x04,0x02,0x00,
+    0x0f,0x30,0x00,0x0d,0x04,0x02,0x00,0x0c,0x28,0x00,0x04,0x02,0x00,0x0c,0x18,0x00,
+    0x08,0x10,0x00,0x00,0x0c,0x00,0x08,0x04,0x00,0x00,0x02,0x00,0x00,0x10,0x00,0x08,
+    0x02,0x00,0x04,0x10,0x00,0x0c,0x08,0x00,0x0f,0x02,0x00,0x05,0x04,0x28,0x00,0x04,
+    0x02,0x00,0x04,0x10,0x00,0x08,0x08,0x00,0x00,0x0c,0x00,0x0f,0x04,0x00,0x02,0x50,
+    0xff,0x00,0x00,0xff,0xff,0x2f,0x00,0xff,0x02,0x00,0x08,0x0f,0x01,0x00,0x29,0x00,
+    0x58,0x00,0x0f,0x3f,0x00,0x28,0x01,0x96,0x00,0x0f,0x40,0x00,0x12,0x2a,0xff,0xff,
+    0x04,0x00,0x03,0x02,0x00,0x0f,0x80,0x00,0x22,0x00,0x4c,0x00,0x03,0x02,0x00,0x0f,
+    0x40,0x00,0x16,0x00,0x34,0x00,0x00,0x04,0x00,0x00,0x02,0x00,0x04,0x08,0x00,0x0f,
+    0xc0,0x00,0x19,0x00,0x02,0x00,0x04,0x38,0x00,0x04,0x08,0x00,0x0f,0x40,0x00,0xff,
+    0xff,0x54,0x50,0x00,0x00,0x00,0x00,0x00,0x53,0x00,0xff,0x00,0xff,0x00,0x01,0x00,
+    0x1f,0xff,0x01,0x00,0x0c,0x21,0x00,0x00,0x2c,0x00,0x00,0x30,0x00,0x06,0x04,0x00,
+    0x00,0x02,0x00,0x0f,0x40,0x00,0x74,0x0f,0x02,0x00,0x22,0x07,0xc0,0x00,0x0f,0x02,
+    0x00,0x22,0x0f,0x40,0x00,0x4f,0xf9,0x02,0x12,0x00,0x00,0x00,0x28,0x00,0x00,0x00,
+    0x33,0x00,0x00,0x00,0x26,0x00,0x00,0x00,0x08,0xa8,0x00,0x0f,0x80,0x00,0x03,0x9f,
+    0x35,0x00,0x00,0x00,0x95,0x00,0x00,0x00,0xdd,0xb4,0x01,0x00,0xd8,0xfa,0x00,0x00,
+    0x00,0xc4,0x00,0x00,0x00,0x5c,0x00,0x00,0x00,0x01,0x00,0x02,0x03,0x02,0x00,0x1f,
+    0xb2,0x34,0x00,0x00,0x00,0xe4,0x01,0x0f,0x04,0x00,0x01,0x1f,0xbb,0x40,0x00,0x00,
+    0x1f,0xe9,0x40,0x00,0x00,0x13,0xfe,0x78,0x00,0x0e,0x44,0x00,0x00,0x02,0x00,0x03,
+    0x79,0x00,0x03,0x02,0x00,0x17,0xe5,0x40,0x00,0x00,0x0c,0x00,0xdd,0x49,0x00,0x00,
+    0x00,0x09,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x3c,0xd4,0x00,0x00,0x02,0x00,0x03,
+    0x39,0x00,0x03,0x02,0x00,0x17,0xe1,0x40,0x00,0x13,0xa3,0x14,0x00,0x08,0x02,0x00,
+    0x17,0x44,0x20,0x00,0x00,0x3e,0x00,0x0c,0x40,0x00,0x53,0xbe,0x00,0x00,0x00,0xdc,
+    0x04,0x00,0x18,0x6b,0x39,0x00,0x03,0x02,0x00,0x00,0x8c,0x00,0x00,0x34,0x00,0x02,
+    0x04,0x00,0x00,0x02,0x00,0x03,0x19,0x00,0x0f,0x02,0x00,0x0c,0x53,0x0e,0x00,0x00,
+    0x00,0x14,0x04,0x00,0x00,0x34,0x00,0x02,0x04,0x00,0x00,0x02,0x00,0x0e,0x39,0x00,
+    0x53,0x01,0x00,0x00,0x00,0x52,0xc0,0x00,0x1f,0xe2,0x3c,0x01,0x06,0x00,0x44,0x00,
+    0x00,0x02,0x00,0x0a,0x40,0x00,0x59,0x1d,0x00,0x00,0x00,0xca,0xe4,0x00,0x00,0x28,
+    0x00,0x0e,0x04,0x00,0x50,0xff,0x00,0x00,0x00,0xff,0x47,0x00,0x00,0x00,0xff,0x04,
+    0x00,0x09,0x02,0x00,0x8f,0xff,0x00,0x00,0x93,0xff,0x00,0x00,0xff,0x04,0x00,0x09,
+    0x07,0x3c,0x00,0x00,0x48,0x00,0x09,0x02,0x00,0x8f,0xff,0x00,0x00,0x1a,0xff,0x00,
+    0x00,0xa7,0x40,0x00,0x25,0x00,0x02,0x00,0x03,0x44,0x00,0x0f,0x88,0x00,0x06,0x00,
+    0x24,0x00,0x0f,0x02,0x00,0x11,0xf3,0x01,0xff,0x00,0x00,0x3f,0xff,0x00,0x00,0x96,
+    0xff,0x00,0x00,0xd6,0xff,0x00,0x00,0xf9,0x04,0x00,0x1f,0xd6,0x3c,0x00,0x11,0x0f,
+    0x02,0x00,0x60,0x00,0x4c,0x01,0x0f,0x04,0x00,0x15,0x0f,0x02,0x00,0x2d,0x1f,0x0b,
+    0x41,0x00,0x2c,0x1f,0xa9,0x40,0x00,0x2c,0x00,0xe8,0x00,0x1f,0x2b,0x44,0x00,0x28,
+    0x00,0x40,0x00,0x1f,0x6f,0x40,0x00,0x10,0xf3,0x06,0x14,0x00,0x00,0x00,0x76,0x00,
+    0x00,0x00,0xbb,0x00,0x00,0x00,0xdd,0x00,0x00,0x00,0xe6,0x00,0x00,0x00,0xd3,0xc0,
+    0x02,0x1f,0x89,0x40,0x00,0x0c,0x53,0x53,0x00,0x00,0x00,0xf8,0x2c,0x00,0x00,0x70,
+    0x00,0x0c,0x04,0x00,0x1f,0x90,0x40,0x00,0x0c,0x17,0x6c,0x3c,0x00,0xd3,0xe0,0x00,
+    0x00,0x00,0x8b,0x00,0x00,0x00,0x83,0x00,0x00,0x00,0xda,0x18,0x00,0x0f,0x40,0x00,
+    0x0d,0x13,0x68,0x28,0x00,0x00,0x78,0x00,0x17,0x40,0x6c,0x00,0x13,0x13,0x18,0x00,
+    0x0f,0x40,0x00,0x0d,0x53,0x41,0x00,0x00,0x00,0xa4,0x04,0x00,0x13,0x12,0x40,0x00,
+    0x50,0x00,0x00,0x00,0x00,0x00,0x4b,0xff,0x00,0x00,0xff,0x04,0x00,0x27,0x93,0x00,
+    0x01,0x00,0x4b,0xff,0x00,0x00,0xac,0x20,0x00,0x08,0x30,0x00,0x0c,0x1c,0x00,0x57,
+    0xa7,0xff,0x00,0x00,0x1a,0x3f,0x00,0x9f,0x00,0xff,0x00,0x00,0x40,0xff,0x00,0x00,
+    0xd3,0x44,0x00,0x00,0x00,0x14,0x00,0x00,0x1c,0x00,0x04,0x50,0x00,0x1c,0x93,0x3c,
+    0x00,0x04,0x02,0x00,0x03,0x44,0x00,0x00,0x6c,0x00,0x13,0xf2,0x04,0x00,0x00,0x0c,
+    0x00,0x10,0x40,0x20,0x00,0x80,0xff,0x00,0x00,0x96,0xff,0x00,0x00,0x3f,0x0c,0x00,
+    0x0f,0x02,0x00,0xa4,0x12,0xff,0x27,0x01,0x00,0x2b,0x01,0x0f,0x04,0x00,0x22,0x0f,
+    0x02,0x00,0xed,0x5f,0x9e,0x00,0x00,0x00,0x37,0x05,0x01,0x28,0x00,0x80,0x01,0x5f,
+    0xfe,0x00,0x00,0x00,0x7b,0x44,0x00,0x24,0x00,0x40,0x00,0x04,0x04,0x00,0x0f,0x88,
+    0x00,0x21,0x17,0xf1,0xf8,0x01,0x1f,0x8c,0x84,0x00,0x20,0x17,0xc5,0x40,0x00,0x1f,
+    0xa8,0x40,0x00,0x18,0x50,0x00,0x00,0x00,0x00,0x00,0x19,0x00,0x01,0x00,0x22,0xff,
+    0xff,0x0f,0x00,0x04,0x08,0x00,0x0f,0x02,0x00,0x1d,0x04,0x38,0x00,0x00,0x08,0x00,
+    0x0f,0x04,0x00,0x15,0x08,0x02,0x00,0x00,0x34,0x00,0x0f,0x02,0x00,0x29,0x00,0x40,
+    0x00,0x0f,0x04,0x00,0x1d,0x0f,0x02,0x00,0x6e,0x00,0x74,0x01,0x0f,0x04,0x00,0x29,
+    0x0f,0x02,0x00,0xff,0xd2,0x00,0x20,0x02,0x00,0x02,0x00,0x04,0x08,0x00,0x00,0x02,
+    0x00,0x08,0x0c,0x00,0x0f,0x02,0x00,0x21,0x50,0x00,0x00,0x00,0x00,0x00,0x11,0x00,
+    0x01,0x00,0x21,0xff,0xff,0x07,0x00,0x05,0x08,0x00,0x00,0x0b,0x00,0x13,0x00,0x14,
+    0x00,0x0f,0x02,0x00,0x0d,0x00,0x34,0x00,0x00,0x04,0x00,0x00,0x02,0x00,0x04,0x08,
+    0x00,0x0f,0x40,0x00,0x19,0x08,0x02,0x00,0x0f,0x40,0x00,0x21,0x00,0x34,0x00,0x08,
+    0x04,0x00,0x03,0x02,0x00,0x0f,0xc0,0x00,0x16,0x0f,0x02,0x00,0x04,0x0f,0x40,0x00,
+    0x57,0x00,0x68,0x01,0x08,0x04,0x00,0x02,0x02,0x00,0x0f,0x80,0x00,0x57,0x0f,0x02,
+    0x00,0x03,0x0f,0x80,0x00,0xff,0x60,0x00,0x04,0x02,0x06,0x02,0x00,0x0f,0x80,0x01,
+    0x4f,0x50,0x00,0x00,0x00,0x00,0x00,0x56,0x00,0xff,0x00,0xff,0x00,0x01,0x00,0x71,
+    0x0d,0x00,0x00,0x00,0xdd,0x00,0x00,0x14,0x00,0x00,0x18,0x00,0x04,0x04,0x00,0x93,
+    0xe7,0x00,0x00,0x00,0xc1,0x00,0x00,0x00,0xb8,0x04,0x00,0x04,0x18,0x00,0x00,0x3e,
+    0x00,0x00,0x0c,0x00,0x04,0x02,0x00,0x1f,0x79,0x3c,0x00,0x00,0x00,0x14,0x00,0x14,
+    0x03,0x21,0x00,0x03,0x02,0x00,0x00,0x34,0x00,0x02,0x04,0x00,0x00,0x02,0x00,0x03,
+    0x15,0x00,0x4b,0x00,0x00,0x00,0xbb,0x40,0x00,0x11,0xd4,0x16,0x00,0x0e,0x02,0x00,
+    0x00,0x34,0x00,0x02,0x04,0x00,0x00,0x02,0x00,0x06,0x20,0x00,0x1b,0xd1,0x40,0x00,
+    0x16,0xc8,0x1b,0x00,0x05,0x02,0x00,0x19,0x2a,0x24,0x00,0x00,0x02,0x00,0x05,0x1b,
+    0x00,0x29,0x00,0xb5,0x1c,0x00,0x02,0x64,0x00,0xf9,0x02,0x70,0x00,0x00,0x00,0x18,
+    0x00,0x00,0x00,0x1f,0x00,0x00,0x00,0x6c,0x00,0x00,0x00,0xec,0x24,0x00,0x00,0x02,
+    0x00,0x06,0x40,0x00,0x19,0x64,0x1c,0x00,0x02,0x40,0x00,0x0f,0x08,0x00,0x0b,0x00,
+    0x02,0x00,0x06,0x40,0x00,0x5f,0x04,0x00,0x00,0x00,0xc2,0x44,0x00,0x0c,0x55,0xb3,
+    0x00,0x00,0x00,0xc5,0x24,0x00,0x00,0x02,0x00,0x06,0x40,0x00,0x00,0x02,0x00,0x95,
+    0x0a,0x00,0x00,0x00,0x92,0x00,0x00,0x00,0xf6,0x24,0x00,0x02,0x84,0x00,0xd5,0xf3,
+    0x00,0x00,0x00,0x83,0x00,0x00,0x00,0x05,0x00,0x00,0x00,0x72,0x1c,0x00,0x00,0x02,
+    0x00,0x00,0x36,0x00,0x0e,0x02,0x00,0x00,0x48,0x00,0xde,0x3b,0x00,0x00,0x00,0x4e,
+    0x00,0x00,0x00,0x3c,0x00,0x00,0x00,0x0b,0x23,0x00,0x01,0x46,0x00,0x0f,0x40,0x00,
+    0x05,0x0f,0x02,0x00,0x13,0x07,0x40,0x00,0xf0,0x22,0xf7,0xff,0x00,0xff,0xe5,0xff,
+    0x00,0xff,0xd4,0xff,0x00,0xff,0xc3,0xff,0x00,0xff,0xb2,0xff,0x00,0xff,0xa0,0xff,
+    0x00,0xff,0x90,0xff,0x00,0xff,0x7f,0xff,0x00,0xff,0x6e,0xff,0x00,0xff,0x5c,0xff,
+    0x00,0xff,0x4b,0xff,0x00,0xff,0x3a,0xff,0x00,0xff,0x29,0x3c,0x00,0x00,0x02,0x00,
+    0x03,0x6a,0x00,0x0f,0x40,0x00,0x05,0x1f,0x8f,0x40,0x00,0x14,0x1f,0xf6,0x80,0x00,
+    0x00,0x17,0xa1,0x40,0x00,0x1f,0x6d,0x80,0x00,0x20,0x00,0x40,0x00,0x00,0xc0,0x00,
+    0x1f,0x7e,0xc0,0x00,0x10,0x0c,0x80,0x00,0x1b,0xb1,0x00,0x01,0x0f,0x80,0x00,0x31,
+    0x16,0x5d,0x40,0x01,0x50,0xff,0x28,0xff,0x00,0xff,0x9f,0x00,0x00,0x00,0xff,0x00,
+    0x00,0x00,0x90,0x00,0x01,0x00,0x13,0xd3,0x12,0x00,0x00,0x00,0x55,0x00,0x00,0x00,
+    0x7a,0x00,0x00,0x00,0x8c,0x38,0x00,0x0f,0x40,0x00,0x11,0x93,0x01,0x00,0x00,0x00,
+    0x81,0x00,0x00,0x00,0xf7,0x70,0x00,0x00,0x34,0x00,0x08,0x04,0x00,0x0f,0x80,0x00,
+    0x0d,0x1b,0x82,0x38,0x00,0x93,0xbc,0x00,0x00,0x00,0x8d,0x00,0x00,0x00,0x88,0x18,
+    0x00,0x0f,0x40,0x00,0x09,0x53,0x03,0x00,0x00,0x00,0xf3,0x28,0x00,0x00,0x74,0x00,
+    0x1b,0x8e,0xeb,0x00,0x00,0x14,0x00,0x1b,0x94,0x14,0x00,0x08,0x02,0x00,0x17,0x19,
+    0x3c,0x00,0x00,0x2c,0x00,0x17,0x56,0x1d,0x00,0x00,0x5c,0x00,0x00,0x14,0x00,0x97,
+    0xfb,0x00,0x00,0x00,0xdc,0x00,0x00,0x00,0x4c,0x1c,0x00,0x04,0x02,0x00,0x1b,0x07,
+    0xf8,0x00,0xdb,0xd4,0x00,0x00,0x00,0x58,0x00,0x00,0x00,0x5f,0x00,0x00,0x00,0xc5,
+    0x5c,0x00,0x14,0x64,0x35,0x00,0x0b,0x02,0x00,0x1b,0x95,0x28,0x00,0x00,0x74,0x00,
+    0x0f,0x04,0x00,0x01,0x0f,0x40,0x00,0x05,0x00,0x84,0x00,0x57,0x97,0x00,0x00,0x00,
+    0xfa,0x48,0x00,0x5b,0xeb,0x00,0x00,0x00,0x5c,0x68,0x00,0x0f,0x02,0x00,0x0d,0xdf,
+    0x0e,0x00,0x00,0x00,0x37,0x00,0x00,0x00,0x31,0x00,0x00,0x00,0x06,0x2d,0x00,0x0d,
+    0x0f,0x02,0x00,0x11,0xff,0x31,0x17,0xff,0x00,0xff,0x02,0xff,0x00,0xff,0x00,0xff,
+    0x0f,0xff,0x00,0xff,0x20,0xff,0x00,0xff,0x31,0xff,0x00,0xff,0x43,0xff,0x00,0xff,
+    0x54,0xff,0x00,0xff,0x64,0xff,0x00,0xff,0x76,0xff,0x00,0xff,0x87,0xff,0x00,0xff,
+    0x98,0xff,0x00,0xff,0xa9,0xff,0x00,0xff,0xbb,0xff,0x00,0xff,0xcc,0xff,0x00,0xff,
+    0xdd,0xff,0x00,0xff,0xee,0xff,0x40,0x00,0x03,0x1f,0x42,0x40,0x00,0x08,0x5f,0xba,
+    0xff,0x00,0xff,0xcb,0x40,0x00,0x14,0x1f,0x65,0x80,0x00,0x00,0x00,0x40,0x00,0x06,
+    0x80,0x00,0x1d,0x13,0xc0,0x00,0x17,0x32,0xc0,0x00,0x0f,0x40,0x00,0x09,0x11,0xdc,
+    0xc0,0x00,0x1d,0x14,0x40,0x00,0x00,0x00,0x01,0x04,0xc0,0x00,0x0f,0x40,0x00,0x05,
+    0x06,0xc0,0x00,0x0e,0x80,0x00,0x00,0x40,0x00,0x04,0x40,0x01,0x0c,0x40,0x00,0x13,
+    0xaa,0xc0,0x00,0xa0,0xcb,0xff,0x00,0xff,0xdd,0xff,0x00,0xff,0xee,0xff,0x83,0x00,
+    0x00,0x00,0xe4,0x00,0x00,0x00,0xff,0x04,0x00,0x2f,0xac,0x00,0x01,0x00,0x0f,0xd3,
+    0x14,0x00,0x00,0x00,0x5e,0x00,0x00,0x00,0x7e,0x00,0x00,0x00,0x6c,0x38,0x00,0x0f,
+    0x40,0x00,0x15,0xf7,0x06,0x12,0x00,0x00,0x00,0xf7,0x00,0x00,0x00,0xfe,0x00,0x00,
+    0x00,0xe1,0x00,0x00,0x00,0xfc,0x00,0x00,0x00,0xe2,0x44,0x00,0x0f,0x80,0x00,0x0d,
+    0x13,0x13,0x2c,0x00,0x00,0x7c,0x00,0x00,0x02,0x00,0x53,0x5d,0x00,0x00,0x00,0xc0,
+    0x14,0x00,0x00,0x84,0x00,0x0f,0x40,0x00,0x0d,0xff,0x06,0x02,0x00,0x00,0x00,0x22,
+    0x00,0x00,0x00,0x49,0x00,0x00,0x00,0x61,0x00,0x00,0x00,0x84,0x00,0x00,0x00,0xd4,
+    0x40,0x00,0x18,0x53,0x10,0x00,0x00,0x00,0xcc,0x30,0x00,0x53,0xde,0x00,0x00,0x00,
+    0xd9,0x0c,0x00,0x00,0x7c,0x00,0x00,0x04,0x00,0x50,0xc1,0x00,0x00,0x00,0x1f,0x99,
+    0x00,0x0f,0x02,0x00,0x04,0x04,0x30,0x01,0x13,0xa4,0x20,0x00,0x13,0x30,0x08,0x01,
+    0x00,0x3c,0x00,0x08,0x04,0x00,0x13,0x0c,0x20,0x00,0x0c,0x02,0x00,0x13,0x64,0x70,
+    0x00,0x13,0xd5,0x0c,0x00,0x53,0xbe,0x00,0x00,0x00,0x60,0x14,0x00,0x0f,0x40,0x00,
+    0x11,0x53,0x09,0x00,0x00,0x00,0xbc,0x30,0x00,0x5c,0xfb,0x00,0x00,0x00,0x83,0x61,
+    0x00,0x0f,0x02,0x00,0x14,0x00,0x04,0x02,0x1f,0x0f,0x2c,0x00,0x14,0x0f,0x02,0x00,
+    0x0b,0x3b,0xff,0xff,0xff,0x04,0x00,0xfb,0x1e,0xfb,0x00,0xff,0xff,0xf2,0x00,0xff,
+    0xff,0xe9,0x00,0xff,0xff,0xe1,0x00,0xff,0xff,0xd9,0x00,0xff,0xff,0xd0,0x00,0xff,
+    0xff,0xc7,0x00,0xff,0xff,0xbf,0x00,0xff,0xff,0xb6,0x00,0xff,0xff,0xae,0x00,0xff,
+    0xff,0xa5,0x00,0xff,0xff,0x9d,0x3c,0x00,0x00,0x4c,0x00,0x04,0x40,0x00,0x13,0xea,
+    0x40,0x00,0x13,0xd8,0x40,0x00,0x5f,0xc8,0x00,0xff,0xff,0xbe,0x40,0x00,0x18,0x04,
+    0x80,0x00,0x04,0x40,0x00,0x00,0x80,0x00,0x04,0x40,0x00,0x13,0xad,0x80,0x00,0x1f,
+    0x9c,0x80,0x00,0x00,0x5f,0xfa,0x00,0xff,0xff,0xf3,0x80,0x00,0x00,0x08,0x40,0x00,
+    0x0f,0xc0,0x00,0x21,0x00,0x40,0x00,0x0f,0x00,0x01,0x29,0x08,0x40,0x00,0x90,0xad,
+    0x00,0xff,0xff,0xa5,0x00,0xff,0xff,0x9d,0x5f,0x00,0x00,0x00,0x1e,0x00,0x01,0x00,
+    0x2b,0x5f,0xf9,0x00,0x00,0x00,0x42,0x43,0x00,0x28,0x5f,0xff,0x00,0x00,0x00,0xb4,
+    0x40,0x00,0x0c,0x00,0x24,0x00,0x00,0x02,0x00,0x04,0x08,0x00,0x00,0x02,0x00,0x04,
+    0x0c,0x00,0x00,0x08,0x00,0x10,0xcf,0x11,0x00,0x0f,0x02,0x00,0x24,0x00,0x40,0x00,
+    0x1f,0xd0,0x3c,0x00,0x24,0x00,0x02,0x00,0x0f,0x40,0x00,0x11,0x00,0x24,0x00,0x00,
+    0x02,0x00,0x04,0x08,0x00,0x00,0x02,0x00,0x04,0x0c,0x00,0x00,0x08,0x00,0x50,0xdf,
+    0x00,0x00,0x00,0x26,0x15,0x00,0x0f,0x02,0x00,0x20,0x00,0x80,0x01,0x00,0x44,0x00,
+    0x1f,0x9c,0x3c,0x00,0x08,0x00,0x20,0x00,0x00,0x02,0x00,0x04,0x08,0x00,0x00,0x02,
+    0x00,0x08,0x0c,0x00,0x0f,0x02,0x00,0x67,0xf3,0x30,0xff,0xff,0x94,0x00,0xff,0xff,
+    0x8c,0x00,0xff,0xff,0x83,0x00,0xff,0xff,0x7a,0x00,0xff,0xff,0x71,0x00,0xff,0xff,
+    0x69,0x00,0xff,0xff,0x60,0x00,0xff,0xff,0x58,0x00,0xff,0xff,0x4f,0x00,0xff,0xff,
+    0x47,0x00,0xff,0xff,0x3e,0x00,0xff,0xff,0x36,0x00,0xff,0xff,0x2d,0x00,0xff,0xff,
+    0x25,0x00,0xff,0xff,0x1c,0x00,0xff,0xff,0x13,0x40,0x00,0x17,0x8b,0x40,0x00,0x1b,
+    0x72,0x40,0x00,0x17,0x50,0x40,0x00,0x1f,0x35,0x40,0x00,0x20,0x0f,0x80,0x00,0x01,
+    0x1f,0x24,0x80,0x00,0x00,0x13,0x82,0xc0,0x00,0x0f,0x80,0x00,0x11,0x04,0x40,0x00,
+    0x17,0x14,0xc0,0x00,0x0f,0x40,0x00,0x05,0x08,0x80,0x00,0x0f,0xc0,0x00,0x11,0x04,
+    0x40,0x01,0x1f,0x61,0x40,0x01,0x0c,0x50,0x1c,0x00,0xff,0xff,0x13,0x1f,0x00,0x01,
+    0x00,0x05,0x3f,0xff,0x00,0xff,0x1b,0x00,0x05,0x0f,0x02,0x00,0x12,0x0f,0x40,0x00,
+    0x1f,0x0a,0x70,0x00,0x0f,0x40,0x00,0x1f,0x0a,0x02,0x00,0x0f,0x40,0x00,0x5f,0x0f,
+    0xc0,0x00,0x6d,0x0f,0x80,0x00,0x6d,0x0a,0x02,0x00,0x0f,0x80,0x01,0x15,0x7a,0xff,
+    0xff,0x0b,0x00,0xff,0xff,0x02,0x3d,0x00,0x0f,0x40,0x00,0xff,0x1b,0x1f,0x0a,0x40,
+    0x01,0x24,0x50,0x00,0x00,0x00,0x00,0x00,0x53,0x00,0xff,0x00,0xff,0x00,0x01,0x00,
+    0xf0,0x22,0xf7,0xff,0x00,0xff,0xe5,0xff,0x00,0xff,0xd4,0xff,0x00,0xff,0xc3,0xff,
+    0x00,0xff,0xb2,0xff,0x00,0xff,0xa1,0xff,0x00,0xff,0x90,0xff,0x00,0xff,0x7e,0xff,
+    0x00,0xff,0x6e,0xff,0x00,0xff,0x5c,0xff,0x00,0xff,0x4b,0xff,0x00,0xff,0x3a,0xff,
+    0x00,0xff,0x29,0x3c,0x00,0x00,0x02,0x00,0x03,0x40,0x00,0x57,0xf6,0xff,0x00,0xff,
+    0xe6,0x40,0x00,0x13,0xb1,0x40,0x00,0x5f,0x8f,0xff,0x00,0xff,0x7f,0x40,0x00,0x00,
+    0x10,0x25,0x3c,0x00,0x00,0x02,0x00,0x03,0x40,0x00,0x00,0x80,0x00,0x08,0x40,0x00,
+    0x04,0x80,0x00,0x00,0x40,0x00,0x00,0x80,0x00,0x1b,0x6d,0x80,0x00,0x10,0x24,0x3c,
+    0x00,0x00,0x02,0x00,0x07,0x40,0x00,0x0c,0xc0,0x00,0x1f,0xa0,0x40,0x00,0x18,0x00,
+    0xc0,0x00,0x0f,0x40,0x00,0x05,0x00,0xc0,0x00,0x08,0x80,0x00,0x1f,0x36,0x80,0x00,
+    0x00,0x00,0x40,0x00,0x00,0xc0,0x00,0x17,0xd5,0x40,0x01,0x00,0x80,0x00,0x00,0x40,
+    0x01,0x00,0x40,0x00,0x08,0x40,0x01,0x1f,0x35,0x40,0x00,0x08,0x04,0x80,0x01,0x08,
+    0x40,0x01,0x0c,0x00,0x01,0x0f,0x40,0x00,0x05,0x0c,0xc0,0x00,0x08,0xc0,0x01,0x04,
+    0xc0,0x00,0x13,0x47,0xc0,0x00,0x0c,0x80,0x01,0x0f,0x02,0x00,0x22,0x07,0x80,0x01,
+    0x0f,0x02,0x00,0x22,0x0f,0x40,0x00,0x31,0x0f,0x02,0x00,0x29,0x0f,0xb5,0x00,0x22,
+    0x0f,0x02,0x00,0xb2,0x50,0x00,0x00,0x00,0x00,0x00,0xff,0x31,0x14,0xff,0x00,0xff,
+    0x02,0xff,0x00,0xff,0x00,0xff,0x0f,0xff,0x00,0xff,0x20,0xff,0x00,0xff,0x31,0xff,
+    0x00,0xff,0x42,0xff,0x00,0xff,0x53,0xff,0x00,0xff,0x64,0xff,0x00,0xff,0x76,0xff,
+    0x00,0xff,0x87,0xff,0x00,0xff,0x98,0xff,0x00,0xff,0xa9,0xff,0x00,0xff,0xbb,0xff,
+    0x00,0xff,0xcc,0xff,0x00,0xff,0xdd,0xff,0x00,0xff,0xee,0xff,0x40,0x00,0x07,0x5f,
+    0x54,0xff,0x00,0xff,0x65,0x40,0x00,0x08,0x11,0xdc,0x40,0x00,0x19,0x13,0x80,0x00,
+    0x17,0x21,0x80,0x00,0x0f,0x40,0x00,0x05,0x13,0xba,0x80,0x00,0x02,0x40,0x00,0x0a,
+    0x80,0x00,0x00,0x40,0x00,0x53,0x32,0xff,0x00,0xff,0x43,0x40,0x00,0x00,0xc0,0x00,
+    0x1b,0x75,0xc0,0x00,0x04,0x40,0x00,0x0f,0xc0,0x00,0x0d,0x00,0x00,0x01,0x0f,0xc0,
+    0x00,0x01,0x0a,0x40,0x00,0x0a,0xc0,0x00,0x00,0x40,0x01,0x00,0x80,0x00,0x08,0x40,
+    0x01,0x0f,0x80,0x00,0x01,0x15,0xcb,0xc0,0x00,0x0f,0x40,0x00,0x07,0x0f,0x00,0x01,
+    0x09,0x00,0x40,0x00,0x02,0xc0,0x00,0x0f,0x40,0x00,0x0b,0x00,0x00,0x01,0x04,0xc0,
+    0x01,0x5d,0x99,0xff,0x00,0xff,0xaa,0xc0,0x00,0x1f,0x00,0x01,0x00,0xad,0x01,0xbc,
+    0x02,0x0f,0x02,0x00,0x28,0x0f,0x00,0x01,0xad,0x0f,0x02,0x00,0x27,0x50,0x00,0x00,
+    0x00,0x00,0x00,0x4b,0x00,0xff,0xff,0xff,0x04,0x00,0xfb,0x1e,0xfb,0x00,0xff,0xff,
+    0xf2,0x00,0xff,0xff,0xe9,0x00,0xff,0xff,0xe1,0x00,0xff,0xff,0xd9,0x00,0xff,0xff,
+    0xd0,0x00,0xff,0xff,0xc7,0x00,0xff,0xff,0xbf,0x00,0xff,0xff,0xb6,0x00,0xff,0xff,
+    0xad,0x00,0xff,0xff,0xa5,0x00,0xff,0xff,0x9d,0x3c,0x00,0x00,0x4c,0x00,0x0f,0x40,
+    0x00,0x05,0x5b,0xc8,0x00,0xff,0xff,0xbe,0x40,0x00,0x1f,0x9c,0x40,0x00,0x08,0x1f,
+    0xea,0x80,0x00,0x08,0x13,0xae,0x80,0x00,0x0f,0x40,0x00,0x01,0x13,0xfa,0xc0,0x00,
+    0x08,0x40,0x00,0x1b,0xcf,0xc0,0x00,0x0f,0x40,0x00,0x11,0x0f,0x00,0x01,0x09,0x04,
+    0x40,0x00,0x0f,0x00,0x01,0x11,0x1f,0xd8,0x40,0x01,0x1c,0x0c,0xc0,0x00,0x0f,0x40,
+    0x00,0x01,0x0f,0x80,0x00,0x11,0x08,0x00,0x01,0x0c,0xc0,0x01,0x04,0x40,0x00,0x2f,
+    0x9c,0x00,0x01,0x00,0xad,0x1f,0xff,0x02,0x00,0x2c,0x0f,0x00,0x01,0xad,0x0f,0x02,
+    0x00,0x27,0x50,0x00,0x00,0x00,0x00,0x00,0xf3,0x31,0x00,0xff,0xff,0x94,0x00,0xff,
+    0xff,0x8c,0x00,0xff,0xff,0x82,0x00,0xff,0xff,0x7a,0x00,0xff,0xff,0x72,0x00,0xff,
+    0xff,0x69,0x00,0xff,0xff,0x61,0x00,0xff,0xff,0x58,0x00,0xff,0xff,0x4f,0x00,0xff,
+    0xff,0x47,0x00,0xff,0xff,0x3e,0x00,0xff,0xff,0x36,0x00,0xff,0xff,0x2d,0x00,0xff,
+    0xff,0x25,0x00,0xff,0xff,0x1c,0x00,0xff,0xff,0x13,0x40,0x00,0x5f,0x8b,0x00,0xff,
+    0xff,0x83,0x40,0x00,0x18,0x13,0x24,0x40,0x00,0x13,0x14,0x40,0x00,0x00,0x80,0x00,
+    0x0f,0x40,0x00,0x19,0x0f,0x80,0x00,0x09,0x1f,0x71,0xc0,0x00,0x00,0x13,0x46,0xc0,
+    0x00,0x13,0x35,0xc0,0x00,0x04,0x80,0x00,0x08,0xc0,0x00,0x0c,0x00,0x01,0x17,0x60,
+    0x00,0x01,0x00,0x40,0x00,0x1f,0x3f,0x40,0x00,0x04,0x13,0x93,0x40,0x01,0x0c,0xc0,
+    0x00,0x04,0x40,0x00,0x13,0x50,0x40,0x00,0x08,0x40,0x01,0x0c,0x80,0x00,0x0f,0x00,
+    0x01,0x1d,0x0f,0x40,0x00,0x11,0x00,0x80,0x00,0x13,0x57,0x80,0x00,0x00,0xc0,0x01,
+    0x00,0xc0,0x00,0x04,0xc0,0x01,0x06,0x40,0x00,0x0f,0x01,0x00,0xad,0x1f,0xff,0x02,
+    0x00,0x2c,0x0f,0xff,0x00,0xac,0x0f,0x02,0x00,0x28,0x50,0x00,0x00,0x00,0x00,0x00,
+    0x9c,0x00,0xff,0xff,0x0b,0x00,0xff,0xff,0x02,0x00,0x01,0x00,0x3c,0xff,0x00,0xff,
+    0x13,0x00,0x0f,0x02,0x00,0x02,0x7d,0xff,0xff,0x0a,0x00,0xff,0xff,0x03,0x1c,0x00,
+    0x0f,0x40,0x00,0x17,0x0f,0x80,0x00,0x31,0x0f,0xc0,0x00,0x29,0x0f,0x80,0x00,0x2d,
+    0x0f,0x40,0x00,0x6d,0x00,0x80,0x01,0x0f,0x00,0x01,0x27,0x0f,0x02,0x00,0x05,0x0f,
+    0xc0,0x01,0x15,0x0f,0x02,0x00,0x05,0x0f,0x40,0x00,0x55,0x00,0x68,0x00,0x0f,0x02,
+    0x00,0x05,0x0f,0x9c,0x00,0x05,0x0f,0x02,0x00,0xf3,0x50,0x00,0x00,0x00,0x00,0x00,
+
+};
+
+const lv_image_dsc_t test_ARGB8888_LZ4_tiled = {
+  .header.magic = LV_IMAGE_HEADER_MAGIC,
+  .header.cf = LV_COLOR_FORMAT_ARGB8888,
+  .header.flags = 0 | LV_IMAGE_FLAGS_TILED,
+  .header.w = 71,
+  .header.h = 60,
+  .header.stride = 288,
+  .data_size = sizeof(test_ARGB8888_LZ4_tiled_map),
+  .data = test_ARGB8888_LZ4_tiled_map,
+};
+
@@ -0,0 +1,687 @@
+
+#if defined(LV_LVGL_H_INCLUDE_SIMPLE)
+#include "lvgl.h"
+#elif defined(LV_BUILD_TEST)
+#include "../lvgl.h"
+#else
+#include "lvgl/lvgl.h"
+#endif
+
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+#define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef LV_ATTRIBUTE_TEST_RGB565_NONE_TILED
+#define LV_ATTRIBUTE_TEST_RGB565_NONE_TILED
+#endif
+
+static const
+LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_TEST_RGB565_NONE_TILED
+uint8_t test_RGB565_NONE_tiled_map[] = {
+
+    0x10,0x00,0x10,0x00,0x20,0x00,0x00,0x00,0xa8,0x00,0x00,0x00,0x00,0x20,0x00,0x00,
+    0xa8,0x02,0x00,0x00,0x00,0x20,0x00,0x00,0xa8,0x04,0x00,0x00,0x00,0x20,0x00,0x00,
+    0xa8,0x06,0x00,0x00,0x00,0x20,0x00,0x00,0xa8,0x08,0x00,0x00,0x00,0x20,0x00,0x00,
+    0xa8,0x0a,0x00,0x00,0x00,0x20,0x00,0x00,0xa8,0x0c,0x00,0x00,0x00,0x20,0x00,0x00,
+    0xa8,0x0e,0x00,0x00,0x00,0x20,0x00,0x00,0xa8,0x10,0x00,0x00,0x00,0x20,0x00,0x00,
+    0xa8,0x12,0x00,0x00,0x00,0x20,0x00,0x00,0xa8,0x14,0x00,0x00,0x00,0x20,0x00,0x00,
+    0xa8,0x16,0x00,0x00,0x00,0x20,0x00,0x00,0xa8,0x18,0x00,0x00,0x00,0x20,0x00,0x00,
+    0xa8,0x1a,0x00,0x00,0x00,0x20,0x00,0x00,0xa8,0x1c,0x00,0x00,0x00,0x20,0x00,0x00,
+    0xa8,0x1e,0x00,0x00,0x00,0x20,0x00,0x00,0xa8,0x20,0x00,0x00,0x00,0x20,0x00,0x00,
+    0xa8,0x22,0x00,0x00,0x00,0x20,0x00,0x00,0xa8,0x24,0x00,0x00,0x00,0x20,0x00,0x00,
+    0xa8,0x26,0x00,0x00,0x00,0x20,0x00,0x00,0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,
+    0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,
+    0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe0,0x07,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe0,0x07,0xff,0xff,0xff,0xff,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe0,0x07,0xff,0xff,0xff,0xff,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe0,0x07,0xff,0xff,0xff,0xff,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe0,0x07,0xff,0xff,0xff,0xff,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe0,0x07,0xff,0xff,0xff,0xff,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe0,0x07,0xff,0xff,0xff,0xff,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe0,0x07,0xff,0xff,0xff,0xff,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe0,0x07,0xff,0xff,0xff,0xff,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe0,0x07,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x07,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x07,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x07,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x07,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,
+    0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,
+    0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbd,0x5f,0x6b,
+    0x5f,0x29,0x3f,0x00,0x3f,0x00,0x5f,0x29,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x3f,0xe7,0x5f,0x6b,0x1f,0x00,0x1f,0x00,
+    0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0x3f,0xe7,0xbf,0x52,0x1f,0x00,0x1f,0x00,0x1f,0x00,
+    0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x6b,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,
+    0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xbd,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,
+    0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0x5f,0x6b,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,
+    0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0x5f,0x29,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,
+    0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,
+    0xff,0xff,0xff,0xff,0x3f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,
+    0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,
+    0xff,0xff,0xff,0xff,0x3f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,
+    0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,
+    0xff,0xff,0xff,0xff,0x5f,0x29,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,
+    0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,
+    0xff,0xff,0xff,0xff,0x5f,0x6b,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,
+    0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xbd,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,
+    0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,
+    0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,
+    0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x6b,0xff,0xbd,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x1f,0x00,0x5f,0x6b,0x3f,0xe7,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbf,0x94,0xff,0x18,
+    0xff,0x18,0xbf,0x94,0xff,0xff,0xff,0xff,0x1f,0x00,0x1f,0x00,0x1f,0x00,0xbf,0x52,
+    0x3f,0xe7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x18,0x1f,0x00,
+    0x1f,0x00,0xff,0x18,0xff,0xff,0xff,0xff,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,
+    0x5f,0x6b,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x18,0x1f,0x00,
+    0x1f,0x00,0xff,0x18,0xff,0xff,0xff,0xff,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,
+    0x1f,0x00,0xff,0xbd,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbf,0x94,0xff,0x18,
+    0xff,0x18,0xbf,0x94,0xff,0xff,0xff,0xff,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,
+    0x1f,0x00,0x5f,0x6b,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,
+    0x1f,0x00,0x5f,0x29,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,
+    0x1f,0x00,0x3f,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbd,0x9f,0x52,0x7f,0x08,
+    0x7f,0x08,0x9f,0x52,0xff,0xbd,0xff,0xff,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,
+    0x1f,0x00,0x3f,0x00,0xff,0xff,0xff,0xff,0xff,0xbd,0x5f,0x29,0x1f,0x00,0x1f,0x00,
+    0x1f,0x00,0x1f,0x00,0x5f,0x29,0xff,0xbd,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,
+    0x1f,0x00,0x5f,0x29,0xff,0xff,0xff,0xff,0x9f,0x52,0x1f,0x00,0x1f,0x00,0x1f,0x00,
+    0x1f,0x00,0x1f,0x00,0x1f,0x00,0x9f,0x52,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,
+    0x1f,0x00,0x5f,0x6b,0xff,0xff,0xff,0xff,0x7f,0x08,0x1f,0x00,0x1f,0x00,0x1f,0x00,
+    0x1f,0x00,0x1f,0x00,0x1f,0x00,0x7f,0x08,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,
+    0x1f,0x00,0xff,0xbd,0xff,0xff,0xff,0xff,0x7f,0x08,0x1f,0x00,0x1f,0x00,0x1f,0x00,
+    0x1f,0x00,0x1f,0x00,0x1f,0x00,0x7f,0x08,0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,
+    0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,
+    0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xf8,
+    0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,
+    0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xf8,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xf8,
+    0xff,0xff,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,
+    0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xf8,
+    0xff,0xff,0x00,0xf8,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xf8,
+    0xff,0xff,0x00,0xf8,0xff,0xff,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,
+    0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xf8,
+    0xff,0xff,0x00,0xf8,0xff,0xff,0x00,0xf8,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xf8,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xf8,
+    0xff,0xff,0x00,0xf8,0xff,0xff,0x00,0xf8,0xff,0xff,0x00,0xf8,0x00,0xf8,0x00,0xf8,
+    0x00,0xf8,0x00,0xf8,0xff,0xff,0x00,0xf8,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xf8,
+    0xff,0xff,0x00,0xf8,0xff,0xff,0x00,0xf8,0xff,0xff,0x00,0xf8,0xff,0xff,0xff,0xff,
+    0xff,0xff,0x00,0xf8,0xff,0xff,0x00,0xf8,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xf8,
+    0xff,0xff,0x00,0xf8,0xff,0xff,0x00,0xf8,0xff,0xff,0x00,0xf8,0xff,0xff,0x00,0xf8,
+    0xff,0xff,0x00,0xf8,0xff,0xff,0x00,0xf8,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xf8,
+    0xff,0xff,0x00,0xf8,0xff,0xff,0x00,0xf8,0xff,0xff,0x00,0xf8,0xff,0xff,0xff,0xff,
+    0xff,0xff,0x00,0xf8,0xff,0xff,0x00,0xf8,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xf8,
+    0xff,0xff,0x00,0xf8,0xff,0xff,0x00,0xf8,0xff,0xff,0x00,0xf8,0x00,0xf8,0x00,0xf8,
+    0x00,0xf8,0x00,0xf8,0xff,0xff,0x00,0xf8,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xf8,
+    0xff,0xff,0x00,0xf8,0xff,0xff,0x00,0xf8,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xf8,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xf8,
+    0xff,0xff,0x00,0xf8,0xff,0xff,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,
+    0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,
+    0xe0,0x07,0xe0,0x07,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xf8,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf8,0x00,0xf8,0xff,0xff,0x00,0xf8,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x00,0xf8,0xff,0xff,0x00,0xf8,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x00,0xf8,0xff,0xff,0x00,0xf8,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x00,0xf8,0xff,0xff,0x00,0xf8,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x00,0xf8,0xff,0xff,0x00,0xf8,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x00,0xf8,0xff,0xff,0x00,0xf8,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x00,0xf8,0xff,0xff,0x00,0xf8,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x00,0xf8,0xff,0xff,0x00,0xf8,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x00,0xf8,0xff,0xff,0x00,0xf8,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x00,0xf8,0xff,0xff,0x00,0xf8,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x00,0xf8,0xff,0xff,0x00,0xf8,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x07,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x07,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x07,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x07,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe0,0x07,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe0,0x07,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe0,0x07,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7d,0xef,0xba,0xd6,0x59,0xce,0xdb,0xde,
+    0xbe,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xe0,0x07,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0x59,0xce,0x4d,0x6b,0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x20,0x00,0xc7,0x39,0x14,0xa5,0xff,0xff,0xe0,0x07,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x69,0x4a,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x42,0xe0,0x07,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xa2,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x07,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xc3,0x18,0x00,0x00,0x00,0x00,0xc3,0x18,0xb6,0xb5,0xbe,0xf7,0xdf,0xff,0x18,0xc6,
+    0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x07,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xe3,0x18,0x00,0x00,0x00,0x00,0xcb,0x5a,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xd7,0xbd,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x07,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x08,0x42,0x04,0x21,0x04,0x21,0x92,0x94,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xbe,0xf7,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x07,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x9e,0xf7,0x5d,0xef,
+    0x5d,0xef,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x07,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0x75,0xad,0xcb,0x5a,0xe3,0x18,0x20,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x07,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x1c,0xe7,0xa6,0x31,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0x5f,0x6b,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,
+    0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0x3f,0xe7,0xbf,0x52,0x1f,0x00,0x1f,0x00,0x1f,0x00,
+    0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x3f,0xe7,0x5f,0x6b,0x1f,0x00,0x1f,0x00,
+    0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbd,0x5f,0x6b,
+    0x5f,0x29,0x3f,0x00,0x3f,0x00,0x5f,0x29,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x9e,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xaa,0x52,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x9a,0xd6,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x71,0x8c,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x5d,0xef,0x51,0x8c,
+    0x08,0x42,0x04,0x21,0xc3,0x18,0x45,0x29,0x00,0x00,0xae,0x73,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x55,0xad,0x20,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6d,0x6b,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x92,0x94,0x00,0x00,0x00,0x00,
+    0xe3,0x18,0x8e,0x73,0xcf,0x7b,0x24,0x21,0x00,0x00,0x6d,0x6b,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xb2,0x94,0x00,0x00,0x00,0x00,
+    0xf7,0xbd,0xff,0xff,0xff,0xff,0x5d,0xef,0x00,0x00,0x6d,0x6b,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf7,0xbd,0xcb,0x5a,0xcb,0x5a,
+    0x7d,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0x1f,0x00,0x1f,0x00,0x1f,0x00,0x1f,0x00,
+    0x5f,0x6b,0xff,0xff,0xff,0xff,0xff,0xff,0x9f,0x52,0x1f,0x00,0x1f,0x00,0x1f,0x00,
+    0x1f,0x00,0x1f,0x00,0x1f,0x00,0x9f,0x52,0x1f,0x00,0x1f,0x00,0x1f,0x00,0xbf,0x52,
+    0x3f,0xe7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbd,0x5f,0x29,0x1f,0x00,0x1f,0x00,
+    0x1f,0x00,0x1f,0x00,0x5f,0x29,0xff,0xbd,0x1f,0x00,0x1f,0x00,0x5f,0x6b,0x3f,0xe7,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbd,0x9f,0x52,0x7f,0x08,
+    0x7f,0x08,0x9f,0x52,0xff,0xbd,0xff,0xff,0x5f,0x6b,0xff,0xbd,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x0c,0x63,0x38,0xc6,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x10,0x84,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0xc6,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x61,0x08,0x00,0x00,0x00,0x00,0x8e,0x73,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc7,0x39,0x00,0x00,0x00,0x00,0xaa,0x52,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xf8,
+    0xff,0xff,0x00,0xf8,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xf8,
+    0xff,0xff,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,
+    0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xf8,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xf8,
+    0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,
+    0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xf8,0xff,0xff,0x00,0xf8,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf8,0x00,0xf8,0xff,0xff,0x00,0xf8,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0xf8,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf8,0x00,0xf8,0x00,0xf8,0x00,0xf8,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x07,0xff,0xff,0xff,0xff,0x9e,0xf7,
+    0x04,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xa2,0x10,0xe7,0x39,0x28,0x42,
+    0x28,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x07,0xff,0xff,0xff,0xff,0x30,0x84,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x84,0xdf,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x07,0xff,0xff,0xff,0xff,0x08,0x42,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x45,0x29,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x07,0xff,0xff,0xff,0xff,0x65,0x29,
+    0x00,0x00,0x00,0x00,0x00,0x00,0xa6,0x31,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xba,0xd6,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x07,0xff,0xff,0xff,0xff,0x49,0x4a,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x71,0x8c,0x3c,0xe7,0xfb,0xde,0x92,0x94,
+    0x82,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x07,0xff,0xff,0xff,0xff,0xd3,0x9c,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x07,0xff,0xff,0xff,0xff,0xdf,0xff,
+    0xe7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x49,0x4a,0xc7,0x39,0x00,0x00,0x00,0x00,0xe0,0x07,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xbe,0xf7,0x6d,0x6b,0x41,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x41,0x08,0xcf,0x7b,
+    0xdf,0xff,0x71,0x8c,0x00,0x00,0x00,0x00,0xe0,0x07,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xbe,0xf7,0x18,0xc6,0x96,0xb5,0x18,0xc6,0x9e,0xf7,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe0,0x07,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe0,0x07,0xff,0xff,0xff,0xff,0xfe,0x07,
+    0xfc,0x07,0xfa,0x07,0xf8,0x07,0xf6,0x07,0xf3,0x07,0xf1,0x07,0xef,0x07,0xed,0x07,
+    0xeb,0x07,0xe9,0x07,0xe7,0x07,0xe5,0x07,0xe0,0x07,0xff,0xff,0xff,0xff,0xfe,0x07,
+    0xfc,0x07,0xfa,0x07,0xf8,0x07,0xf6,0x07,0xf3,0x07,0xf1,0x07,0xef,0x07,0xed,0x07,
+    0xeb,0x07,0xe9,0x07,0xe7,0x07,0xe5,0x07,0xe0,0x07,0xff,0xff,0xff,0xff,0xfe,0x07,
+    0xfc,0x07,0xfa,0x07,0xf8,0x07,0xf6,0x07,0xf4,0x07,0xf1,0x07,0xef,0x07,0xed,0x07,
+    0xeb,0x07,0xe9,0x07,0xe7,0x07,0xe5,0x07,0xe0,0x07,0xff,0xff,0xff,0xff,0xfe,0x07,
+    0xfc,0x07,0xfa,0x07,0xf8,0x07,0xf6,0x07,0xf4,0x07,0xf1,0x07,0xef,0x07,0xed,0x07,
+    0xeb,0x07,0xe9,0x07,0xe7,0x07,0xe5,0x07,0xe0,0x07,0xff,0xff,0xff,0xff,0xfe,0x07,
+    0xfc,0x07,0xfa,0x07,0xf8,0x07,0xf6,0x07,0xf3,0x07,0xf1,0x07,0xef,0x07,0xed,0x07,
+    0xeb,0x07,0xe9,0x07,0xe7,0x07,0xe5,0x07,0xe0,0x07,0xff,0xff,0xff,0xff,0xfe,0x07,
+    0xfc,0x07,0xfa,0x07,0xf8,0x07,0xf6,0x07,0xf4,0x07,0xf1,0x07,0xef,0x07,0xed,0x07,
+    0xeb,0x07,0xe9,0x07,0xe7,0x07,0xe4,0x07,0x00,0x00,0x6d,0x6b,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7d,0xef,
+    0x55,0xad,0x30,0x84,0x8e,0x73,0x6d,0x6b,0x00,0x00,0x6d,0x6b,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x7b,0x20,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x6d,0x6b,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xef,0x7b,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x08,0x42,0x8e,0x73,0xae,0x73,0x00,0x00,0x6d,0x6b,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xdf,0xff,0x41,0x08,0x00,0x00,0x00,0x00,
+    0x8e,0x73,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x4d,0x6b,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x3c,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x55,0xad,0xff,0xff,0xff,0xff,0xdf,0xff,0x00,0x00,0x00,0x00,0x04,0x21,0x96,0xb5,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0xf7,0x20,0x00,0x00,0x00,0x00,0x00,
+    0x45,0x29,0x34,0xa5,0xf3,0x9c,0xc7,0x39,0x00,0x00,0x00,0x00,0x00,0x00,0xd3,0x9c,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x4d,0x6b,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xd3,0x9c,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0xf7,0x2c,0x63,0x20,0x00,
+    0x00,0x00,0x00,0x00,0x82,0x10,0x14,0xa5,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x9e,0xf7,
+    0x38,0xc6,0x79,0xce,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe2,0x07,0xe0,0x07,0xe0,0x0f,0xe0,0x1f,
+    0xe0,0x37,0xe0,0x47,0xe0,0x57,0xe0,0x67,0xe0,0x77,0xe0,0x87,0xe0,0x97,0xe0,0xaf,
+    0xe0,0xbf,0xe0,0xcf,0xe0,0xdf,0xe0,0xef,0xe2,0x07,0xe0,0x07,0xe0,0x0f,0xe0,0x1f,
+    0xe0,0x37,0xe0,0x47,0xe0,0x57,0xe0,0x67,0xe0,0x77,0xe0,0x87,0xe0,0x97,0xe0,0xaf,
+    0xe0,0xbf,0xe0,0xcf,0xe0,0xdf,0xe0,0xef,0xe2,0x07,0xe0,0x07,0xe0,0x0f,0xe0,0x1f,
+    0xe0,0x37,0xe0,0x47,0xe0,0x57,0xe0,0x67,0xe0,0x77,0xe0,0x87,0xe0,0x97,0xe0,0xaf,
+    0xe0,0xbf,0xe0,0xcf,0xe0,0xdf,0xe0,0xef,0xe2,0x07,0xe0,0x07,0xe0,0x0f,0xe0,0x1f,
+    0xe0,0x37,0xe0,0x47,0xe0,0x57,0xe0,0x67,0xe0,0x77,0xe0,0x87,0xe0,0x97,0xe0,0xaf,
+    0xe0,0xbf,0xe0,0xcf,0xe0,0xdf,0xe0,0xef,0xe2,0x07,0xe0,0x07,0xe0,0x0f,0xe0,0x1f,
+    0xe0,0x37,0xe0,0x47,0xe0,0x57,0xe0,0x67,0xe0,0x77,0xe0,0x87,0xe0,0x97,0xe0,0xaf,
+    0xe0,0xbf,0xe0,0xcf,0xe0,0xdf,0xe0,0xef,0xe2,0x07,0xe0,0x07,0xe0,0x0f,0xe0,0x1f,
+    0xe0,0x37,0xe0,0x47,0xe0,0x57,0xe0,0x67,0xe0,0x77,0xe0,0x87,0xe0,0x97,0xe0,0xaf,
+    0xe0,0xbf,0xe0,0xcf,0xe0,0xdf,0xe0,0xef,0xc3,0x18,0x00,0x00,0x00,0x00,0x8a,0x52,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0x5d,0xef,0x14,0xa5,0x10,0x84,0x92,0x94,0x00,0x00,0x00,0x00,0x00,0x00,0x8a,0x52,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7d,0xef,
+    0x20,0x00,0x00,0x00,0xe3,0x18,0x00,0x00,0xe3,0x18,0x00,0x00,0x00,0x00,0x8a,0x52,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x5d,0xef,
+    0x00,0x00,0x10,0x84,0xff,0xff,0x14,0xa5,0xe7,0x39,0x00,0x00,0x00,0x00,0x8a,0x52,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xfb,0xde,0xb6,0xb5,0xf3,0x9c,0xcf,0x7b,0x45,0x29,0x00,0x00,0x00,0x00,0x8a,0x52,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x7d,0xef,
+    0x86,0x31,0x00,0x00,0x04,0x21,0x24,0x21,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x39,
+    0xfb,0xde,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x92,0x94,
+    0x00,0x00,0xcb,0x5a,0xff,0xff,0x79,0xce,0xe3,0x18,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x9e,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xd3,0x9c,
+    0x00,0x00,0x45,0x29,0xd3,0x9c,0x08,0x42,0xf3,0x9c,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x9e,0xf7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xbe,0xf7,
+    0x08,0x42,0x00,0x00,0x00,0x00,0xcf,0x7b,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0x5d,0xef,0x7d,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe0,0xff,0xe0,0xff,0xe0,0xff,0xe0,0xff,
+    0xe0,0xff,0xe1,0xff,0xe2,0xff,0xe3,0xff,0xe4,0xff,0xe5,0xff,0xe6,0xff,0xe7,0xff,
+    0xe9,0xff,0xea,0xff,0xeb,0xff,0xec,0xff,0xe0,0xff,0xe0,0xff,0xe0,0xff,0xe0,0xff,
+    0xe0,0xff,0xe1,0xff,0xe2,0xff,0xe3,0xff,0xe4,0xff,0xe5,0xff,0xe6,0xff,0xe8,0xff,
+    0xe9,0xff,0xea,0xff,0xeb,0xff,0xec,0xff,0xe0,0xff,0xe0,0xff,0xe0,0xff,0xe0,0xff,
+    0xe0,0xff,0xe1,0xff,0xe2,0xff,0xe3,0xff,0xe4,0xff,0xe5,0xff,0xe6,0xff,0xe8,0xff,
+    0xe9,0xff,0xea,0xff,0xeb,0xff,0xec,0xff,0xe0,0xff,0xe0,0xff,0xe0,0xff,0xe0,0xff,
+    0xe0,0xff,0xe1,0xff,0xe2,0xff,0xe3,0xff,0xe4,0xff,0xe5,0xff,0xe6,0xff,0xe8,0xff,
+    0xe9,0xff,0xea,0xff,0xeb,0xff,0xec,0xff,0xe0,0xff,0xe0,0xff,0xe0,0xff,0xe0,0xff,
+    0xe0,0xff,0xe1,0xff,0xe2,0xff,0xe3,0xff,0xe4,0xff,0xe5,0xff,0xe6,0xff,0xe7,0xff,
+    0xe9,0xff,0xea,0xff,0xeb,0xff,0xec,0xff,0xe0,0xff,0xe0,0xff,0xe0,0xff,0xe0,0xff,
+    0xe0,0xff,0xe1,0xff,0xe2,0xff,0xe3,0xff,0xe4,0xff,0xe5,0xff,0xe6,0xff,0xe7,0xff,
+    0xe9,0xff,0xea,0xff,0xeb,0xff,0xec,0xff,0x1c,0xe7,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x20,0x00,0xf7,0xbd,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x49,0x4a,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0x00,0x00,0x65,0x29,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x65,0x29,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x65,0x29,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0x00,0x00,0xe3,0x18,0xdb,0xde,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x20,0x00,0x00,0x00,0x0c,0x63,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0x00,0x00,
+    0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xed,0xff,0xee,0xff,0xef,0xff,0xf0,0xff,
+    0xf1,0xff,0xf2,0xff,0xf3,0xff,0xf4,0xff,0xf5,0xff,0xf6,0xff,0xf8,0xff,0xf9,0xff,
+    0xfa,0xff,0xfb,0xff,0xfc,0xff,0xfd,0xff,0xed,0xff,0xee,0xff,0xef,0xff,0xf0,0xff,
+    0xf1,0xff,0xf2,0xff,0xf3,0xff,0xf4,0xff,0xf5,0xff,0xf6,0xff,0xf8,0xff,0xf9,0xff,
+    0xfa,0xff,0xfb,0xff,0xfc,0xff,0xfd,0xff,0xed,0xff,0xee,0xff,0xef,0xff,0xf0,0xff,
+    0xf1,0xff,0xf2,0xff,0xf3,0xff,0xf4,0xff,0xf5,0xff,0xf6,0xff,0xf8,0xff,0xf9,0xff,
+    0xfa,0xff,0xfb,0xff,0xfc,0xff,0xfd,0xff,0xed,0xff,0xee,0xff,0xef,0xff,0xf0,0xff,
+    0xf1,0xff,0xf2,0xff,0xf3,0xff,0xf4,0xff,0xf5,0xff,0xf6,0xff,0xf8,0xff,0xf9,0xff,
+    0xfa,0xff,0xfb,0xff,0xfc,0xff,0xfd,0xff,0xed,0xff,0xee,0xff,0xef,0xff,0xf0,0xff,
+    0xf1,0xff,0xf2,0xff,0xf3,0xff,0xf4,0xff,0xf5,0xff,0xf6,0xff,0xf8,0xff,0xf9,0xff,
+    0xfa,0xff,0xfb,0xff,0xfc,0xff,0xfd,0xff,0xed,0xff,0xee,0xff,0xef,0xff,0xf0,0xff,
+    0xf1,0xff,0xf2,0xff,0xf3,0xff,0xf4,0xff,0xf5,0xff,0xf6,0xff,0xf8,0xff,0xf9,0xff,
+    0xfa,0xff,0xfb,0xff,0xfc,0xff,0xfd,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x07,0xff,0xff,0xff,0xff,0xfe,0x07,
+    0xfc,0x07,0xfa,0x07,0xf8,0x07,0xf6,0x07,0xf4,0x07,0xf1,0x07,0xef,0x07,0xed,0x07,
+    0xeb,0x07,0xe9,0x07,0xe7,0x07,0xe5,0x07,0xe0,0x07,0xff,0xff,0xff,0xff,0xfe,0x07,
+    0xfc,0x07,0xfa,0x07,0xf8,0x07,0xf6,0x07,0xf4,0x07,0xf1,0x07,0xef,0x07,0xed,0x07,
+    0xeb,0x07,0xe9,0x07,0xe7,0x07,0xe4,0x07,0xe0,0x07,0xff,0xff,0xff,0xff,0xfe,0x07,
+    0xfc,0x07,0xfa,0x07,0xf8,0x07,0xf6,0x07,0xf4,0x07,0xf1,0x07,0xef,0x07,0xed,0x07,
+    0xeb,0x07,0xe9,0x07,0xe7,0x07,0xe4,0x07,0xe0,0x07,0xff,0xff,0xff,0xff,0xfe,0x07,
+    0xfc,0x07,0xfa,0x07,0xf8,0x07,0xf6,0x07,0xf3,0x07,0xf1,0x07,0xef,0x07,0xed,0x07,
+    0xeb,0x07,0xe9,0x07,0xe7,0x07,0xe4,0x07,0xe0,0x07,0xff,0xff,0xff,0xff,0xfe,0x07,
+    0xfc,0x07,0xfa,0x07,0xf8,0x07,0xf6,0x07,0xf3,0x07,0xf1,0x07,0xef,0x07,0xed,0x07,
+    0xeb,0x07,0xe9,0x07,0xe6,0x07,0xe4,0x07,0xe0,0x07,0xff,0xff,0xff,0xff,0xfe,0x07,
+    0xfc,0x07,0xfa,0x07,0xf8,0x07,0xf6,0x07,0xf3,0x07,0xf1,0x07,0xef,0x07,0xed,0x07,
+    0xeb,0x07,0xe9,0x07,0xe6,0x07,0xe4,0x07,0xe0,0x07,0xff,0xff,0xff,0xff,0xfe,0x07,
+    0xfc,0x07,0xfa,0x07,0xf8,0x07,0xf6,0x07,0xf4,0x07,0xf1,0x07,0xef,0x07,0xed,0x07,
+    0xeb,0x07,0xe9,0x07,0xe6,0x07,0xe4,0x07,0xe0,0x07,0xff,0xff,0xff,0xff,0xfe,0x07,
+    0xfc,0x07,0xfa,0x07,0xf8,0x07,0xf6,0x07,0xf4,0x07,0xf1,0x07,0xef,0x07,0xed,0x07,
+    0xeb,0x07,0xe8,0x07,0xe6,0x07,0xe4,0x07,0xe0,0x07,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe0,0x07,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe0,0x07,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,
+    0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,
+    0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe2,0x07,0xe0,0x07,0xe0,0x0f,0xe0,0x1f,
+    0xe0,0x37,0xe0,0x47,0xe0,0x57,0xe0,0x67,0xe0,0x77,0xe0,0x87,0xe0,0x97,0xe0,0xaf,
+    0xe0,0xbf,0xe0,0xcf,0xe0,0xdf,0xe0,0xef,0xe2,0x07,0xe0,0x07,0xe0,0x0f,0xe0,0x1f,
+    0xe0,0x37,0xe0,0x47,0xe0,0x57,0xe0,0x67,0xe0,0x77,0xe0,0x87,0xe0,0x97,0xe0,0xaf,
+    0xe0,0xbf,0xe0,0xcf,0xe0,0xdf,0xe0,0xef,0xe2,0x07,0xe0,0x07,0xe0,0x0f,0xe0,0x27,
+    0xe0,0x37,0xe0,0x47,0xe0,0x57,0xe0,0x67,0xe0,0x77,0xe0,0x87,0xe0,0x97,0xe0,0xaf,
+    0xe0,0xbf,0xe0,0xcf,0xe0,0xdf,0xe0,0xef,0xe2,0x07,0xe0,0x07,0xe0,0x0f,0xe0,0x27,
+    0xe0,0x37,0xe0,0x47,0xe0,0x57,0xe0,0x67,0xe0,0x77,0xe0,0x87,0xe0,0x97,0xe0,0xaf,
+    0xe0,0xbf,0xe0,0xcf,0xe0,0xdf,0xe0,0xef,0xe2,0x07,0xe0,0x07,0xe0,0x0f,0xe0,0x1f,
+    0xe0,0x37,0xe0,0x47,0xe0,0x57,0xe0,0x67,0xe0,0x77,0xe0,0x87,0xe0,0x97,0xe0,0xaf,
+    0xe0,0xbf,0xe0,0xcf,0xe0,0xdf,0xe0,0xef,0xe2,0x07,0xe0,0x07,0xe0,0x0f,0xe0,0x1f,
+    0xe0,0x37,0xe0,0x47,0xe0,0x57,0xe0,0x67,0xe0,0x77,0xe0,0x87,0xe0,0x97,0xe0,0xaf,
+    0xe0,0xbf,0xe0,0xcf,0xe0,0xdf,0xe0,0xef,0xe2,0x07,0xe0,0x07,0xe0,0x0f,0xe0,0x1f,
+    0xe0,0x37,0xe0,0x47,0xe0,0x57,0xe0,0x67,0xe0,0x77,0xe0,0x87,0xe0,0x97,0xe0,0xaf,
+    0xe0,0xbf,0xe0,0xcf,0xe0,0xdf,0xe0,0xef,0xe2,0x07,0xe0,0x07,0xe0,0x0f,0xe0,0x1f,
+    0xe0,0x37,0xe0,0x47,0xe0,0x57,0xe0,0x67,0xe0,0x77,0xe0,0x87,0xe0,0x9f,0xe0,0xaf,
+    0xe0,0xbf,0xe0,0xcf,0xe0,0xdf,0xe0,0xef,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,
+    0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,
+    0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0xff,0xe0,0xff,0xe0,0xff,0xe0,0xff,
+    0xe0,0xff,0xe1,0xff,0xe2,0xff,0xe3,0xff,0xe4,0xff,0xe5,0xff,0xe6,0xff,0xe7,0xff,
+    0xe9,0xff,0xea,0xff,0xeb,0xff,0xec,0xff,0xe0,0xff,0xe0,0xff,0xe0,0xff,0xe0,0xff,
+    0xe0,0xff,0xe1,0xff,0xe2,0xff,0xe3,0xff,0xe4,0xff,0xe5,0xff,0xe6,0xff,0xe8,0xff,
+    0xe9,0xff,0xea,0xff,0xeb,0xff,0xec,0xff,0xe0,0xff,0xe0,0xff,0xe0,0xff,0xe0,0xff,
+    0xe0,0xff,0xe1,0xff,0xe2,0xff,0xe3,0xff,0xe4,0xff,0xe5,0xff,0xe6,0xff,0xe7,0xff,
+    0xe9,0xff,0xea,0xff,0xeb,0xff,0xec,0xff,0xe0,0xff,0xe0,0xff,0xe0,0xff,0xe0,0xff,
+    0xe0,0xff,0xe1,0xff,0xe2,0xff,0xe3,0xff,0xe4,0xff,0xe5,0xff,0xe6,0xff,0xe7,0xff,
+    0xe9,0xff,0xea,0xff,0xeb,0xff,0xec,0xff,0xe0,0xff,0xe0,0xff,0xe0,0xff,0xe0,0xff,
+    0xe0,0xff,0xe1,0xff,0xe2,0xff,0xe3,0xff,0xe4,0xff,0xe5,0xff,0xe6,0xff,0xe7,0xff,
+    0xe9,0xff,0xea,0xff,0xeb,0xff,0xec,0xff,0xe0,0xff,0xe0,0xff,0xe0,0xff,0xe0,0xff,
+    0xe0,0xff,0xe1,0xff,0xe2,0xff,0xe3,0xff,0xe4,0xff,0xe5,0xff,0xe6,0xff,0xe7,0xff,
+    0xe9,0xff,0xea,0xff,0xeb,0xff,0xec,0xff,0xe0,0xff,0xe0,0xff,0xe0,0xff,0xe0,0xff,
+    0xe0,0xff,0xe1,0xff,0xe2,0xff,0xe3,0xff,0xe4,0xff,0xe5,0xff,0xe6,0xff,0xe7,0xff,
+    0xe9,0xff,0xea,0xff,0xeb,0xff,0xec,0xff,0xe0,0xff,0xe0,0xff,0xe0,0xff,0xe0,0xff,
+    0xe0,0xff,0xe1,0xff,0xe2,0xff,0xe3,0xff,0xe4,0xff,0xe5,0xff,0xe6,0xff,0xe7,0xff,
+    0xe9,0xff,0xea,0xff,0xeb,0xff,0xec,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,
+    0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,
+    0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xed,0xff,0xee,0xff,0xef,0xff,0xf0,0xff,
+    0xf1,0xff,0xf2,0xff,0xf3,0xff,0xf4,0xff,0xf5,0xff,0xf6,0xff,0xf8,0xff,0xf9,0xff,
+    0xfa,0xff,0xfb,0xff,0xfc,0xff,0xfd,0xff,0xed,0xff,0xee,0xff,0xef,0xff,0xf0,0xff,
+    0xf1,0xff,0xf2,0xff,0xf3,0xff,0xf4,0xff,0xf5,0xff,0xf6,0xff,0xf8,0xff,0xf9,0xff,
+    0xfa,0xff,0xfb,0xff,0xfc,0xff,0xfd,0xff,0xed,0xff,0xee,0xff,0xef,0xff,0xf0,0xff,
+    0xf1,0xff,0xf2,0xff,0xf3,0xff,0xf4,0xff,0xf5,0xff,0xf6,0xff,0xf8,0xff,0xf9,0xff,
+    0xfa,0xff,0xfb,0xff,0xfc,0xff,0xfd,0xff,0xed,0xff,0xee,0xff,0xef,0xff,0xf0,0xff,
+    0xf1,0xff,0xf2,0xff,0xf3,0xff,0xf4,0xff,0xf5,0xff,0xf7,0xff,0xf8,0xff,0xf9,0xff,
+    0xfa,0xff,0xfb,0xff,0xfc,0xff,0xfd,0xff,0xed,0xff,0xee,0xff,0xef,0xff,0xf0,0xff,
+    0xf1,0xff,0xf2,0xff,0xf3,0xff,0xf4,0xff,0xf5,0xff,0xf7,0xff,0xf7,0xff,0xf9,0xff,
+    0xfa,0xff,0xfb,0xff,0xfc,0xff,0xfd,0xff,0xed,0xff,0xee,0xff,0xef,0xff,0xf0,0xff,
+    0xf1,0xff,0xf2,0xff,0xf3,0xff,0xf4,0xff,0xf5,0xff,0xf7,0xff,0xf8,0xff,0xf9,0xff,
+    0xfa,0xff,0xfb,0xff,0xfc,0xff,0xfd,0xff,0xed,0xff,0xee,0xff,0xef,0xff,0xf0,0xff,
+    0xf1,0xff,0xf2,0xff,0xf3,0xff,0xf4,0xff,0xf5,0xff,0xf6,0xff,0xf8,0xff,0xf9,0xff,
+    0xfa,0xff,0xfb,0xff,0xfc,0xff,0xfd,0xff,0xed,0xff,0xee,0xff,0xef,0xff,0xf0,0xff,
+    0xf1,0xff,0xf2,0xff,0xf3,0xff,0xf4,0xff,0xf5,0xff,0xf6,0xff,0xf7,0xff,0xf9,0xff,
+    0xfa,0xff,0xfb,0xff,0xfc,0xff,0xfd,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,
+    0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,
+    0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfe,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
+    0xff,0xff,0xff,0xff,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x07,0xe0,0x07,0xe0,0x07,0xe0,0x07,
+    0xe0,0x07,0xe0,0x07,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+
+};
+
+const lv_image_dsc_t test_RGB565_NONE_tiled = {
+  .header.magic = LV_IMAGE_HEADER_MAGIC,
+  .header.cf = LV_COLOR_FORMAT_RGB565,
+  .header.flags = 0 | LV_IMAGE_FLAGS_TILED,
+  .header.w = 71,
+  .header.h = 60,
+  .header.stride = 144,
+  .data_size = sizeof(test_RGB565_NONE_tiled_map),
+  .data = test_RGB565_NONE_tiled_map,
+};
+